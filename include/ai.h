@@ -12,6 +12,19 @@
 // Inclusion du fichier d'en-tête contenant les définitions de types
 // Ce fichier contient probablement les définitions de Player et AIState
 #include "types.h"
+#include <stdint.h>     // Pour uint64_t
+#include "ttable.h"     // Cache de transposition (TTable)
+#include "solver.h"     // Résolution exacte (SolverResult)
+
+// Solveur exact de l'IA experte : taille estimée de l'espace de recherche
+// en dessous de laquelle il remplace la carte de densité, et budget de temps
+// (jeu seulement : une échéance rend le coup dépendant de la charge de la
+// machine, le tournoi et l'auto-jeu s'en passent)
+#define AI_SOLVER_MAX_SEARCH 1e5
+#define AI_SOLVER_BUDGET_US 20000
+
+// IA « info » : nombre de flottes tirées quand le solveur exact ne s'applique pas
+#define AI_INFO_SAMPLES 512
 
 // ========================================================================
 // DÉCLARATIONS DES FONCTIONS D'INTELLIGENCE ARTIFICIELLE
@@ -46,6 +59,191 @@ void enemyMedium(Player *target, AIState *ai);
 // Retour : aucun (void)
 void enemyHard(Player *target, AIState *ai);
 
+// Fonction : aiObserveShot
+// Description : Met à jour l'observation de l'IA et son hachage de Zobrist
+//               après un tir en (x, y) (à appeler une fois le tir résolu)
+//               Si le tir a coulé un bateau, toutes ses cases passent à l'état coulé
+// Paramètres :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+//   - x, y   : case qui vient d'être visée
+// Retour : aucun (void)
+void aiObserveShot(Player *target, AIState *ai, int x, int y);
+
+// Fonction : aiSetCache
+// Description : Branche un cache de transposition partagé sur l'IA experte
+//               (NULL = pas de cache)
+// Paramètres :
+//   - cache : table à utiliser (peut être partagée entre plusieurs parties)
+// Retour : aucun (void)
+void aiSetCache(TTable *cache);
+
+// Fonction : aiSetSolver
+// Description : Règle le solveur exact de l'IA experte
+// Paramètres :
+//   - maxSearch : taille estimée maximale de l'espace de recherche (0 = désactivé)
+//   - budgetUs  : budget de temps par coup en microsecondes (0 = illimité)
+// Retour : aucun (void)
+void aiSetSolver(double maxSearch, uint64_t budgetUs);
+
+// Fonction : aiSolverStats
+// Description : Compteurs du solveur exact depuis le lancement
+// Paramètres :
+//   - calls  : résolutions tentées en sortie (peut être NULL)
+//   - solved : résolutions menées à bien en sortie (peut être NULL)
+// Retour : aucun (void)
+void aiSolverStats(uint64_t *calls, uint64_t *solved);
+
+// Fonction : computeDensityMap
+// Description : Calcule la carte de densité des placements encore possibles
+//               à partir de ce que l'IA a observé (tirs manqués, touchés, coulés)
+//               Seuls les bateaux non coulés sont comptés
+// Paramètres :
+//   - target  : pointeur vers le joueur cible
+//   - ai      : pointeur vers l'état de l'IA (historique des tirs)
+//   - weights : carte de sortie (GRID * GRID entrées, index = x * GRID + y)
+// Retour : aucun (void)
+void computeDensityMap(Player *target, AIState *ai, int weights[GRID * GRID]);
+
+// Fonction : aiObservationRows
+// Description : Traduit l'observation de l'IA en entrées du solveur : cases
+//               où un bateau restant peut se trouver, touches non coulées et
+//               bateaux encore à flot
+// Paramètres :
+//   - target    : pointeur vers le joueur cible (seules les cases visées sont lues)
+//   - ai        : pointeur vers l'état de l'IA
+//   - rows      : cases libres en sortie (masques de lignes)
+//   - hits      : touches non coulées en sortie (peut être NULL)
+//   - remaining : bateaux encore à flot en sortie
+// Retour : aucun (void)
+void aiObservationRows(Player *target, AIState *ai, uint16_t rows[GRID],
+                       uint16_t hits[GRID], ShipConfig *remaining);
+
+// Fonction : aiSolvedShot
+// Description : Tir de l'IA experte d'après une résolution exacte : case non
+//               visée la plus probablement occupée
+// Paramètres :
+//   - ai     : pointeur vers l'état de l'IA
+//   - solved : résolution terminée (SOLVER_DONE)
+//   - outX   : ligne choisie en sortie (-1 si aucune)
+//   - outY   : colonne choisie en sortie
+// Retour : nombre de flottes occupant la case retenue
+double aiSolvedShot(AIState *ai, const SolverResult *solved, int *outX, int *outY);
+
+// Fonction : expertChooseShot
+// Description : Choisit le tir de l'IA experte sans le jouer (bibliothèque
+//               d'ouvertures, puis cache, puis carte de densité)
+//               Le choix ne dépend que de l'observation de l'IA
+// Paramètres :
+//   - target : pointeur vers le joueur cible (seules les cases visées sont lues)
+//   - ai     : pointeur vers l'état de l'IA
+//   - outX   : ligne choisie en sortie (-1 si toutes les cases sont visées)
+//   - outY   : colonne choisie en sortie
+// Retour : aucun (void)
+void expertChooseShot(Player *target, AIState *ai, int *outX, int *outY);
+
+// Fonction : expertChooseShotEx
+// Description : Comme expertChooseShot, avec des réglages explicites du
+//               solveur exact (au lieu de ceux fixés par aiSetSolver)
+// Paramètres :
+//   - maxSearch : seuil du solveur (0 = carte de densité seule)
+//   - budgetNs  : budget de temps du solveur en nanosecondes
+//   - autres    : voir expertChooseShot
+// Retour : aucun (void)
+void expertChooseShotEx(Player *target, AIState *ai, double maxSearch, uint64_t budgetNs,
+                        int *outX, int *outY);
+
+// Fonction : aiResolveShot
+// Description : Joue un tir déjà choisi : met à jour la grille cible
+//               (touché, coulé ou manqué) et l'observation de l'IA
+// Paramètres :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+//   - x, y   : case visée (pas encore visée)
+// Retour : aucun (void)
+void aiResolveShot(Player *target, AIState *ai, int x, int y);
+
+// Fonction : enemyExpert
+// Description : Implémente une IA de niveau expert
+//               Stratégie : tire sur la case la plus probable selon la carte
+//               de densité, en se limitant aux voisines des touches en cours
+// Paramètres :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+// Retour : aucun (void)
+void enemyExpert(Player *target, AIState *ai);
+
+// Fonction : aiSetThreads
+// Description : Fixe le nombre de fils d'exécution de l'IA « info »
+// Paramètres :
+//   - threads : nombre de fils, appelant compris (0 = nombre de processeurs)
+// Retour : nombre de fils effectivement utilisés
+int aiSetThreads(int threads);
+
+// Fonction : infoChooseShot
+// Description : Choisit le tir de gain d'information maximal sans le jouer :
+//               entropie de l'issue (eau, touché, coulé) sur les flottes
+//               compatibles, exactes (solveur) ou tirées au hasard
+// Paramètres :
+//   - target : pointeur vers le joueur cible (seules les cases visées sont lues)
+//   - ai     : pointeur vers l'état de l'IA
+//   - outX   : ligne choisie en sortie (-1 si toutes les cases sont visées)
+//   - outY   : colonne choisie en sortie
+// Retour : aucun (void)
+void infoChooseShot(Player *target, AIState *ai, int *outX, int *outY);
+
+// Fonction : infoExactCounts
+// Description : Poids exacts des issues (SOLVER_OUT_*) de chaque case
+// Paramètres :
+//   - target, ai : voir infoChooseShot
+//   - maxSearch  : seuil du solveur exact
+//   - budgetNs   : budget de temps du solveur en nanosecondes
+//   - counts     : poids par case et par issue en sortie (remplacés)
+// Retour : 1 si le solveur a abouti, 0 sinon (counts inchangé)
+int infoExactCounts(Player *target, AIState *ai, double maxSearch, uint64_t budgetNs,
+                    double counts[GRID * GRID][3]);
+
+// Fonction : infoSolvedCounts
+// Description : Poids des issues de chaque case d'après une résolution exacte
+// Paramètres :
+//   - solved : résolution terminée (SOLVER_DONE)
+//   - counts : poids par case et par issue en sortie (remplacés)
+// Retour : 1 si au moins une flotte est compatible, 0 sinon (counts inchangé)
+int infoSolvedCounts(const SolverResult *solved, double counts[GRID * GRID][3]);
+
+// Fonction : infoSampleCounts
+// Description : Tire les flottes numéros first à first + samples - 1 et
+//               ajoute leurs issues aux poids (lots successifs cumulables)
+// Paramètres :
+//   - target, ai : voir infoChooseShot
+//   - first      : numéro du premier tirage
+//   - samples    : nombre de tirages
+//   - counts     : poids par case et par issue (complétés)
+// Retour : nombre de flottes effectivement tirées
+int infoSampleCounts(Player *target, AIState *ai, int first, int samples,
+                     double counts[GRID * GRID][3]);
+
+// Fonction : infoBestCell
+// Description : Case non visée dont l'issue a l'entropie maximale
+// Paramètres :
+//   - ai     : pointeur vers l'état de l'IA (cases visées)
+//   - counts : poids par case et par issue
+//   - outX   : ligne choisie en sortie (-1 si aucune)
+//   - outY   : colonne choisie en sortie
+// Retour : 1 si une case a été trouvée, 0 sinon
+int infoBestCell(AIState *ai, double counts[GRID * GRID][3], int *outX, int *outY);
+
+// Fonction : enemyInfo
+// Description : Implémente l'IA « info »
+//               Stratégie : tire là où le résultat apprend le plus sur la
+//               position de la flotte (gain d'information maximal)
+//               L'évaluation des tirs est répartie sur un groupe de fils
+// Paramètres :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+// Retour : aucun (void)
+void enemyInfo(Player *target, AIState *ai);
+
 // Fin de la condition #ifndef AI_H
 #endif
 // Note : Ce fichier d'en-tête ne contient QUE des déclarations (prototypes)
@@ -0,0 +1,47 @@
+// ========================================================================
+// FICHIER : aiqueue.h (AI Job Queue Header)
+// DESCRIPTION : File de travaux de l'IA servie par un fil dédié : la
+//               boucle de jeu dépose des instantanés de l'observation
+//               (réflexions démarrées par anytimeStart) et relève chaque
+//               image les coups calculés, sans jamais attendre l'IA
+//               Les deux sens passent par des boîtes aux lettres sans verrou
+//               à un producteur et un consommateur
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef AIQUEUE_H
+#define AIQUEUE_H
+
+#include "anytime.h"    // AnytimeAI (travail et résultat)
+
+// Capacité de chaque boîte aux lettres (puissance de 2)
+#define AIQUEUE_CAPACITY 8
+
+// Fonction : aiQueueStart
+// Description : Démarre le fil de l'IA (sans effet s'il tourne déjà)
+// Retour : 1 si le fil tourne, 0 s'il n'a pas pu être créé (les travaux
+//          sont alors calculés en séquence au dépôt, premier affinage seul)
+int aiQueueStart(void);
+
+// Fonction : aiQueueStop
+// Description : Arrête le fil après le travail en cours (les travaux en
+//               attente sont abandonnés, les résultats non relevés perdus)
+// Retour : aucun (void)
+void aiQueueStop(void);
+
+// Fonction : aiQueueSubmit
+// Description : Dépose un travail (un seul fil producteur : la boucle de jeu)
+//               Le travail appartient au fil de l'IA jusqu'à son retour par
+//               aiQueuePoll ; seul anytimeCancel peut y toucher entre-temps
+// Paramètres :
+//   - job : réflexion démarrée par anytimeStart
+// Retour : 1 si le travail est accepté, 0 si la file est pleine
+int aiQueueSubmit(AnytimeAI *job);
+
+// Fonction : aiQueuePoll
+// Description : Relève sans bloquer un travail terminé (dans l'ordre de dépôt)
+// Retour : travail terminé (coup prêt pour anytimeCommit), NULL si aucun
+AnytimeAI *aiQueuePoll(void);
+
+// Fin de la condition #ifndef AIQUEUE_H
+#endif
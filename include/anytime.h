@@ -0,0 +1,152 @@
+// ========================================================================
+// FICHIER : anytime.h (Anytime AI Header)
+// DESCRIPTION : IA « à tout moment » : la réflexion sur le prochain coup
+//               démarre dès que le coup précédent de l'IA est joué (elle ne
+//               dépend pas des tirs du joueur), s'affine pendant le tour du
+//               joueur et le délai qui suit, et le meilleur coup trouvé est
+//               joué à l'expiration du délai
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef ANYTIME_H
+#define ANYTIME_H
+
+#include <stdatomic.h>  // Demande d'arrêt depuis un autre fil
+#include "types.h"      // GRID, Player, AIState
+#include "solver.h"     // Résolution exacte par tranches
+
+// Réglages de la réflexion longue (le délai entre les tours absorbe le coût)
+#define ANYTIME_SOLVER_MAX_SEARCH 1e7      // Seuil du solveur exact
+#define ANYTIME_SOLVER_BUDGET_US 300000    // Budget de temps du solveur exact
+#define ANYTIME_INFO_BATCH 64              // Flottes tirées au plus par affinage (IA « info »)
+#define ANYTIME_INFO_MAX_SAMPLES 4096      // Flottes tirées au plus (IA « info »)
+#define ANYTIME_INFO_PROBE 2               // Flottes du premier lot en mode découpé (mesure du coût)
+
+// Tranche de réflexion par image en mode coopératif (sans fil d'exécution),
+// aussi utilisée par le fil de l'IA entre deux vérifications d'annulation
+#define ANYTIME_FRAME_BUDGET_US 4000
+
+// Phase de la réflexion (niveaux expert et info)
+typedef enum {
+    ANYTIME_FIRST,               // Premier coup (bibliothèque, cache ou densité)
+    ANYTIME_SOLVER,              // Solveur exact par tranches
+    ANYTIME_SAMPLE               // Échantillonnage par lots (IA « info »)
+} AnytimePhase;
+
+// Niveau d'IA
+typedef enum {
+    AI_EASY,
+    AI_MEDIUM,
+    AI_HARD,
+    AI_EXPERT,
+    AI_INFO
+} AILevel;
+
+// Réflexion en cours (une par tour de l'IA)
+typedef struct {
+    AILevel level;               // Niveau d'IA
+    Player board;                // Copie de la grille cible au démarrage
+    AIState state;               // Copie de l'état de l'IA au démarrage
+    uint64_t key;                // Hachage de l'observation au démarrage
+    unsigned int startSeed;      // Graine de myRand() au démarrage
+    unsigned int seed;           // Graine de myRand() de la copie (niveaux facile à difficile)
+    int bestX, bestY;            // Meilleur coup connu (-1 = aucun)
+    int step;                    // Nombre d'affinages effectués
+    int finished;                // Plus rien à affiner
+    double counts[GRID * GRID][3];  // Poids des issues par case (IA « info »)
+    int samples;                 // Flottes tirées (IA « info »)
+    AnytimePhase phase;          // Phase en cours
+    SolverTask *task;            // Résolution exacte en cours (NULL = aucune)
+    uint64_t solverNs;           // Temps passé dans le solveur exact
+    uint64_t sampleNs;           // Temps passé à tirer des flottes (IA « info »)
+    uint64_t sampleWorstNs;      // Coût par flotte du lot le plus cher (IA « info »)
+    atomic_int cancel;           // Demande d'arrêt de l'affinage
+} AnytimeAI;
+
+// Fonction : anytimeStart
+// Description : Démarre une réflexion sur une copie de l'état courant
+//               (l'état réel n'est plus lu ni modifié jusqu'à anytimeCommit)
+// Paramètres :
+//   - t      : réflexion à initialiser
+//   - level  : niveau d'IA
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+// Retour : aucun (void)
+void anytimeStart(AnytimeAI *t, AILevel level, const Player *target, const AIState *ai);
+
+// Fonction : anytimeRefine
+// Description : Effectue un affinage (le premier donne toujours un coup)
+// Paramètres :
+//   - t : réflexion en cours
+// Retour : 1 si un autre affinage peut améliorer le coup, 0 sinon
+int anytimeRefine(AnytimeAI *t);
+
+// Fonction : anytimeRefineFor
+// Description : Affine pendant au plus sliceNs : chaque pas est borné (carte
+//               de densité, préparation du solveur, tranche du solveur
+//               interrompue à l'échéance, lot de tirages dimensionné d'après
+//               le plus cher des lots précédents) et le pas suivant n'est
+//               lancé que s'il a le temps de finir ; le premier pas (carte de
+//               densité) est toujours fait pour qu'un coup soit connu
+// Paramètres :
+//   - t       : réflexion en cours
+//   - sliceNs : durée de la tranche en nanosecondes
+// Retour : 1 s'il reste de quoi affiner, 0 sinon
+int anytimeRefineFor(AnytimeAI *t, uint64_t sliceNs);
+
+// Fonction : anytimeBestMove
+// Description : Meilleur coup trouvé jusqu'ici
+// Paramètres :
+//   - t    : réflexion en cours
+//   - outX : ligne en sortie
+//   - outY : colonne en sortie
+// Retour : 1 si un coup est disponible, 0 sinon
+int anytimeBestMove(const AnytimeAI *t, int *outX, int *outY);
+
+// Fonction : anytimeValid
+// Description : Vérifie qu'une réflexion démarrée à l'avance (spéculation)
+//               porte toujours sur l'état courant de l'IA
+// Paramètres :
+//   - t  : réflexion en cours
+//   - ai : pointeur vers l'état de l'IA
+// Retour : 1 si le coup trouvé peut être joué, 0 s'il faut recommencer
+int anytimeValid(const AnytimeAI *t, const AIState *ai);
+
+// Fonction : anytimeRelease
+// Description : Libère une résolution exacte en cours (réflexion abandonnée
+//               avant anytimeCommit)
+// Paramètres :
+//   - t : réflexion en cours
+// Retour : aucun (void)
+void anytimeRelease(AnytimeAI *t);
+
+// Fonction : anytimeCommit
+// Description : Joue le meilleur coup sur l'état réel (affine d'abord si
+//               aucun coup n'est encore connu) et libère la réflexion
+// Paramètres :
+//   - t      : réflexion terminée ou arrêtée
+//   - target : pointeur vers le joueur cible (celui de anytimeStart)
+//   - ai     : pointeur vers l'état de l'IA (celui de anytimeStart)
+// Retour : aucun (void)
+void anytimeCommit(AnytimeAI *t, Player *target, AIState *ai);
+
+// Fonction : anytimeCancel
+// Description : Demande l'arrêt de l'affinage (depuis un autre fil)
+// Paramètres :
+//   - t : réflexion en cours
+// Retour : aucun (void)
+void anytimeCancel(AnytimeAI *t);
+
+// Fonction : anytimeRun
+// Description : Affine jusqu'à la fin ou jusqu'à anytimeCancel (le premier
+//               affinage est toujours mené à terme)
+//               Les niveaux facile à difficile tirent avec la graine copiée
+//               par anytimeStart (celle du fil appelant), rendue à ce fil
+//               par anytimeCommit
+// Paramètres :
+//   - t : réflexion démarrée par anytimeStart
+// Retour : aucun (void)
+void anytimeRun(AnytimeAI *t);
+
+// Fin de la condition #ifndef ANYTIME_H
+#endif
@@ -0,0 +1,91 @@
+// ========================================================================
+// FICHIER : book.h (Opening Book Header)
+// DESCRIPTION : Bibliothèque d'ouvertures de l'IA experte : table précalculée
+//               (outil bookgen) associant le hachage d'une observation de
+//               début de partie au tir à jouer, projetée en mémoire au démarrage
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef BOOK_H
+#define BOOK_H
+
+#include <stddef.h>     // Pour size_t
+#include <stdint.h>     // Pour uint64_t, uint32_t
+#include "types.h"      // GRID, SHIP_COUNT, ShipConfig
+
+// Fichier par défaut (généré par « make book »)
+#define BOOK_DEFAULT_PATH "opening.book"
+
+// Version du format de fichier
+#define BOOK_VERSION 1
+
+// ========================================================================
+// FORMAT DU FICHIER (ordre des octets de la machine, vérifié par le magique)
+//   BookHeader                       (48 octets)
+//   uint64_t keys[count]             (hachages triés par ordre croissant)
+//   uint8_t  moves[count]            (tir = x * GRID + y)
+// ========================================================================
+typedef struct {
+    char magic[4];              // "BNBK"
+    uint32_t version;           // BOOK_VERSION
+    uint32_t count;             // Nombre d'entrées
+    uint32_t grid;              // Taille de grille utilisée à la génération
+    int32_t sizes[SHIP_COUNT];  // Configuration des bateaux utilisée
+    uint32_t depth;             // Profondeur explorée (nombre de tirs)
+    uint32_t reserved;          // Alignement des clés sur 8 octets
+} BookHeader;
+
+// Entrée utilisée lors de la génération
+typedef struct {
+    uint64_t key;               // Hachage de Zobrist de l'observation
+    uint8_t move;               // Tir à jouer (x * GRID + y)
+} BookEntry;
+
+// Fonction : bookOpen
+// Description : Projette un fichier d'ouvertures en mémoire (mmap, ou lecture
+//               complète sous Windows) et le rend actif pour l'IA experte
+//               Le fichier est refusé s'il a été généré pour une autre grille
+//               ou une autre configuration de bateaux, si ses clés ne
+//               sont pas triées ou si un tir sort de la grille
+// Paramètres :
+//   - path   : chemin du fichier
+//   - config : configuration des bateaux de la partie
+// Retour : nombre d'entrées chargées, 0 si le fichier est absent ou invalide
+size_t bookOpen(const char *path, const ShipConfig *config);
+
+// Fonction : bookClose
+// Description : Libère la bibliothèque active (sans effet si aucune)
+// Retour : aucun (void)
+void bookClose(void);
+
+// Fonction : bookLookup
+// Description : Recherche dichotomique d'une observation dans la bibliothèque
+// Paramètres :
+//   - key  : hachage de Zobrist de l'observation
+//   - outX : ligne du tir en sortie
+//   - outY : colonne du tir en sortie
+// Retour : 1 si l'observation est présente, 0 sinon
+int bookLookup(uint64_t key, int *outX, int *outY);
+
+// Fonction : bookStats
+// Description : Compteurs de consultations depuis l'ouverture
+// Paramètres :
+//   - probes : nombre de consultations en sortie (peut être NULL)
+//   - hits   : nombre de consultations fructueuses en sortie (peut être NULL)
+// Retour : aucun (void)
+void bookStats(uint64_t *probes, uint64_t *hits);
+
+// Fonction : bookWrite
+// Description : Trie les entrées, supprime les doublons et écrit le fichier
+// Paramètres :
+//   - path    : chemin du fichier à créer
+//   - entries : entrées générées (triées sur place)
+//   - count   : nombre d'entrées
+//   - config  : configuration des bateaux utilisée
+//   - depth   : profondeur explorée
+// Retour : nombre d'entrées écrites, 0 en cas d'erreur
+size_t bookWrite(const char *path, BookEntry *entries, size_t count,
+                 const ShipConfig *config, int depth);
+
+// Fin de la condition #ifndef BOOK_H
+#endif
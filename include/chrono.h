@@ -0,0 +1,20 @@
+// ========================================================================
+// FICHIER : chrono.h (Chronometer Header)
+// DESCRIPTION : Horloge monotone haute résolution pour les mesures de
+//               performance (outils de tournoi, bancs d'essai, IA)
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef CHRONO_H
+#define CHRONO_H
+
+#include <stdint.h>     // Pour uint64_t
+
+// Fonction : chronoNowNs
+// Description : Retourne le temps écoulé depuis une origine arbitraire
+//               (horloge monotone, insensible aux changements d'heure)
+// Retour : temps en nanosecondes (uint64_t)
+uint64_t chronoNowNs(void);
+
+// Fin de la condition #ifndef CHRONO_H
+#endif
@@ -0,0 +1,107 @@
+// ========================================================================
+// FICHIER : density.h (Density Header)
+// DESCRIPTION : Déclaration des noyaux de calcul de carte de densité
+//               (nombre de placements possibles couvrant chaque case)
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef DENSITY_H
+#define DENSITY_H
+
+#include <stdint.h>     // Pour uint16_t (masques de lignes)
+
+// Inclusion du fichier d'en-tête contenant les définitions de types
+// (GRID, ShipConfig)
+#include "types.h"
+
+// ========================================================================
+// REPRÉSENTATION DU PLATEAU EN MASQUES DE LIGNES
+// ========================================================================
+// Chaque ligne x de la grille est codée sur 16 bits :
+//   bit y de rows[x] = 1  si la case (x, y) peut accueillir un bateau
+//   bit y de rows[x] = 0  sinon (tir manqué, bateau coulé, zone interdite)
+// Seuls les GRID (14) bits de poids faible sont utilisés.
+
+// Masque des bits valides d'une ligne (14 bits à 1)
+#define ROW_MASK ((uint16_t)((1u << GRID) - 1))
+
+// Nombre de plans de bits des compteurs vectorisés (valeurs de 0 à 255 par case)
+#define DENSITY_PLANES 8
+
+// Énumération des noyaux de calcul disponibles
+typedef enum {
+    DENSITY_SCALAR,   // Implémentation de référence, case par case
+    DENSITY_SWAR,     // Implémentation vectorisée (4 lignes par mot de 64 bits)
+    DENSITY_SIMD      // Variante SSE4.2/AVX2/AVX-512 choisie par le dispatch (kernels.h)
+} DensityKernel;
+
+// Fonction : densitySetKernel
+// Description : Choisit le noyau utilisé par densityMap (sélection à l'exécution)
+// Paramètres :
+//   - kernel : noyau à utiliser
+// Retour : aucun (void)
+void densitySetKernel(DensityKernel kernel);
+
+// Fonction : densityGetKernel
+// Description : Retourne le noyau actuellement sélectionné
+// Retour : noyau courant (DensityKernel)
+DensityKernel densityGetKernel(void);
+
+// Fonction : densityKernelName
+// Description : Retourne le nom lisible d'un noyau (pour l'affichage)
+// Paramètres :
+//   - kernel : noyau dont on veut le nom
+// Retour : chaîne constante ("scalar", "swar", ...)
+const char *densityKernelName(DensityKernel kernel);
+
+// Fonction : densityMapScalar
+// Description : Calcule la carte de densité de façon naïve (référence)
+//               Pour chaque bateau et chaque orientation, compte les placements
+//               entièrement contenus dans des cases libres
+// Paramètres :
+//   - rows    : masques des cases libres (GRID lignes)
+//   - config  : bateaux à compter (taille 0 = bateau ignoré, -10 = bateau 5x2)
+//   - weights : carte de sortie (GRID * GRID entrées, index = x * GRID + y)
+// Retour : aucun (void)
+void densityMapScalar(const uint16_t rows[GRID], const ShipConfig *config,
+                      int weights[GRID * GRID]);
+
+// Fonction : densityMapSwar
+// Description : Calcule la même carte de densité par fenêtres glissantes
+//               (décalages et ET logiques sur les masques de lignes)
+//               Les compteurs sont tenus en tranches de bits (un plan par bit)
+// Paramètres : identiques à densityMapScalar
+// Retour : aucun (void)
+void densityMapSwar(const uint16_t rows[GRID], const ShipConfig *config,
+                    int weights[GRID * GRID]);
+
+// Fonction : densityShipShape
+// Description : Calcule les dimensions d'un bateau selon sa taille et son orientation
+//               (utilisée par tous les noyaux, y compris les unités SIMD)
+// Paramètres :
+//   - size     : taille du bateau (> 0 normal, < 0 bateau 5x2, 0 = ignoré)
+//   - vertical : orientation (1 = vertical, 0 = horizontal)
+//   - width    : largeur en sortie (colonnes)
+//   - height   : hauteur en sortie (lignes)
+// Retour : 1 si le bateau doit être compté, 0 sinon
+int densityShipShape(int size, int vertical, int *width, int *height);
+
+// Fonction : densityUnpackPlanes
+// Description : Recompose la carte de densité à partir de compteurs en tranches
+//               de bits (un masque de 16 bits par ligne et par plan)
+// Paramètres :
+//   - planes  : plans de bits (planes[p][x] = bit p des compteurs de la ligne x)
+//   - weights : carte de sortie (GRID * GRID entrées)
+// Retour : aucun (void)
+void densityUnpackPlanes(const uint16_t planes[DENSITY_PLANES][16],
+                         int weights[GRID * GRID]);
+
+// Fonction : densityMap
+// Description : Calcule la carte de densité avec le noyau sélectionné
+// Paramètres : identiques à densityMapScalar
+// Retour : aucun (void)
+void densityMap(const uint16_t rows[GRID], const ShipConfig *config,
+                int weights[GRID * GRID]);
+
+// Fin de la condition #ifndef DENSITY_H
+#endif
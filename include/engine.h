@@ -0,0 +1,128 @@
+// ========================================================================
+// FICHIER : engine.h (Game Engine Header)
+// DESCRIPTION : Moteur de partie sans interface : machine à états explicite
+//               (visée, délai après un tir, changement de joueur, tour de
+//               l'IA, fin de partie) avancée par engineStep(entrée) et cadencée
+//               par une horloge fournie par l'appelant
+//               L'interface SDL, les outils sans affichage et le serveur
+//               réseau pilotent le même moteur ; il ne dépend pas de SDL
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <stdint.h>     // Pour uint64_t
+#include "types.h"      // Player, GRID, TURN_DELAY, PVP_DELAY
+
+// Horloge injectable : temps en millisecondes depuis une origine arbitraire
+typedef struct {
+    uint64_t (*now)(void *ctx);  // Lecture de l'horloge
+    void *ctx;                   // Contexte passé à now
+} EngineClock;
+
+// Occupant d'une place
+typedef enum {
+    ENGINE_HUMAN,                // Joueur humain (tirs par ENGINE_INPUT_SHOT)
+    ENGINE_REMOTE,               // Joueur distant (tirs par ENGINE_INPUT_SHOT, sans écran
+                                 // de changement ni délai : le réseau impose son rythme)
+    ENGINE_AI                    // IA (coup joué par l'appelant, puis ENGINE_INPUT_AI_DONE)
+} EngineSeat;
+
+// Phase de la partie
+typedef enum {
+    ENGINE_AIM,                  // Un joueur humain ou distant doit tirer
+    ENGINE_SHOT_DELAY,           // Délai après un tir, avant de passer la main
+    ENGINE_HANDOVER,             // Écran de changement de joueur (attend ENGINE_INPUT_CONFIRM)
+    ENGINE_AI_TURN,              // L'IA doit jouer son coup
+    ENGINE_OVER                  // Partie terminée
+} EnginePhase;
+
+// Type d'entrée
+typedef enum {
+    ENGINE_INPUT_NONE,           // Rien : fait seulement avancer le temps
+    ENGINE_INPUT_SHOT,           // Tir du joueur courant (humain ou distant) en (x, y)
+    ENGINE_INPUT_CONFIRM,        // Le joueur suivant est prêt (écran de changement)
+    ENGINE_INPUT_AI_DONE,        // L'IA a joué son coup sur la grille adverse
+    ENGINE_INPUT_QUIT            // Abandon de la partie
+} EngineInputType;
+
+// Entrée de engineStep
+typedef struct {
+    EngineInputType type;
+    int x, y;                    // Case visée (ENGINE_INPUT_SHOT)
+} EngineInput;
+
+// Événement rendu par engineStep
+typedef enum {
+    ENGINE_EVENT_NONE,           // Rien de nouveau
+    ENGINE_EVENT_IGNORED,        // Entrée refusée (mauvaise phase, case déjà visée)
+    ENGINE_EVENT_MISS,           // Tir dans l'eau
+    ENGINE_EVENT_HIT,            // Bateau touché
+    ENGINE_EVENT_SUNK,           // Bateau coulé
+    ENGINE_EVENT_PHASE,          // Changement de phase (délai écoulé, confirmation, coup de l'IA)
+    ENGINE_EVENT_OVER            // La partie vient de se terminer
+} EngineEvent;
+
+// Partie en cours
+typedef struct {
+    Player *players[2];          // Joueurs (0 commence)
+    EngineSeat seats[2];         // Occupants des places
+    EngineClock clock;           // Horloge de la partie
+    EnginePhase phase;           // Phase en cours
+    int current;                 // Joueur qui tire (0 ou 1)
+    int winner;                  // Vainqueur (-1 = aucun ou abandon)
+    int handover;                // Écran de changement entre deux humains
+    uint32_t shotDelay;          // Délai après un tir (ms)
+    uint64_t phaseStart;         // Début de la phase en cours (ms)
+    int shots[2];                // Tirs de chaque joueur
+} Engine;
+
+// Fonction : engineInit
+// Description : Démarre une partie sur des grilles déjà placées
+//               Deux humains : délai PVP_DELAY puis écran de changement
+//               (la partie commence sur cet écran) ; sinon délai TURN_DELAY
+//               avant chaque coup de l'IA, sans délai avant un tour humain
+//               ou distant
+// Paramètres :
+//   - e       : partie à initialiser
+//   - p1, p2  : joueurs (p1 commence)
+//   - s1, s2  : occupants des places
+//   - clock   : horloge de la partie
+// Retour : aucun (void)
+void engineInit(Engine *e, Player *p1, Player *p2, EngineSeat s1, EngineSeat s2,
+                EngineClock clock);
+
+// Fonction : engineStep
+// Description : Applique une entrée puis fait avancer le temps (fin de délai)
+//               Les tirs humains sont résolus et comptés ici : -1 dans l'eau,
+//               +10/-5 touché, +20/-10 coulé, +100/-50 en fin de partie
+// Paramètres :
+//   - e     : partie en cours
+//   - input : entrée à appliquer (type ENGINE_INPUT_NONE pour attendre)
+// Retour : événement produit (voir EngineEvent)
+EngineEvent engineStep(Engine *e, EngineInput input);
+
+// Fonction : engineWakeTime
+// Description : Instant où la phase en cours se termine d'elle-même
+//               (permet aux pilotes sans affichage de sauter le délai)
+// Paramètres :
+//   - e : partie en cours
+// Retour : instant en ms, 0 si la phase attend une entrée
+uint64_t engineWakeTime(const Engine *e);
+
+// Fonction : engineCurrent / engineOpponent
+// Description : Joueur qui tire et joueur visé
+// Paramètres :
+//   - e : partie en cours
+// Retour : pointeur vers le joueur
+Player *engineCurrent(const Engine *e);
+Player *engineOpponent(const Engine *e);
+
+// Fonction : engineMonotonicClock
+// Description : Horloge monotone du système (sans SDL)
+// Retour : horloge en millisecondes
+EngineClock engineMonotonicClock(void);
+
+// Fin de la condition #ifndef ENGINE_H
+#endif
@@ -69,12 +69,18 @@ void sortScores(Score scores[], int count);
 //   - nh       : nombre de scores en mode difficile
 //   - pvp[]    : tableau des scores en mode PVP
 //   - np       : nombre de scores en mode PVP
+//   - expert[] : tableau des scores en mode expert
+//   - nx       : nombre de scores en mode expert
+//   - info[]   : tableau des scores en mode info
+//   - ni       : nombre de scores en mode info
 // Retour : aucun (void)
 void writeAllScores(const char *filename,
                     Score easy[], int ne,
                     Score medium[], int nm,
                     Score hard[], int nh,
-                    Score pvp[], int np);
+                    Score pvp[], int np,
+                    Score expert[], int nx,
+                    Score info[], int ni);
 
 // Fonction : updateTopScoresOneFile
 // Description : Met à jour les meilleurs scores dans un fichier unique
@@ -0,0 +1,115 @@
+// ========================================================================
+// FICHIER : kernels.h (Kernels Header)
+// DESCRIPTION : Détection des extensions du processeur et aiguillage
+//               (dispatch) des noyaux de calcul critiques vers la meilleure
+//               variante compilée (générique, SSE4.2, AVX2, AVX-512)
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stdint.h>     // Pour uint16_t (masques de lignes)
+
+// Inclusion du fichier d'en-tête contenant les définitions de types
+#include "types.h"
+
+// ========================================================================
+// NIVEAUX D'EXTENSIONS SUPPORTÉS
+// ========================================================================
+
+// Niveaux classés du moins au plus performant
+typedef enum {
+    CPU_GENERIC,   // Code C portable uniquement
+    CPU_SSE42,     // SSE4.2 (registres de 128 bits)
+    CPU_AVX2,      // AVX2 (registres de 256 bits)
+    CPU_AVX512     // AVX-512 F/BW/VL (registres de 512 bits, masques)
+} CpuLevel;
+
+// ========================================================================
+// TABLE DES NOYAUX (pointeurs de fonctions liés au démarrage)
+// ========================================================================
+
+typedef struct {
+    // Noyau plateau : masque des cases dont la valeur est dans [lo, hi]
+    //   rows[x] bit y = 1 si lo <= g[x][y] <= hi
+    void (*gridRowMask)(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]);
+
+    // Noyau densité : même contrat que densityMapScalar (density.h)
+    void (*densityMap)(const uint16_t rows[GRID], const ShipConfig *config,
+                       int weights[GRID * GRID]);
+
+    // Remplissage en bloc : produit exactement la suite des appels à myRand()
+    //   et avance la graine globale d'autant
+    void (*randFill)(int *out, int count);
+} Kernels;
+
+// Table globale utilisée par le reste du jeu (variantes génériques par défaut)
+extern Kernels kernels;
+
+// ========================================================================
+// DÉCLARATIONS DES FONCTIONS DE DISPATCH
+// ========================================================================
+
+// Fonction : cpuDetect
+// Description : Détecte le meilleur niveau d'extensions utilisable
+//               (processeur ET système d'exploitation)
+// Retour : niveau détecté (CpuLevel)
+CpuLevel cpuDetect(void);
+
+// Fonction : cpuLevelName
+// Description : Retourne le nom lisible d'un niveau ("generic", "sse4.2", ...)
+// Paramètres :
+//   - level : niveau dont on veut le nom
+// Retour : chaîne constante
+const char *cpuLevelName(CpuLevel level);
+
+// Fonction : cpuLevelFromName
+// Description : Convertit un nom de niveau en CpuLevel
+// Paramètres :
+//   - name  : nom du niveau ("generic", "sse4.2", "avx2", "avx512")
+//   - level : niveau en sortie
+// Retour : 1 si le nom est reconnu, 0 sinon
+int cpuLevelFromName(const char *name, CpuLevel *level);
+
+// Fonction : dispatchInit
+// Description : Lie la table des noyaux au meilleur niveau disponible,
+//               sans dépasser le plafond demandé
+// Paramètres :
+//   - maxLevel : niveau maximal autorisé (CPU_AVX512 = pas de limite)
+// Retour : niveau effectivement retenu (CpuLevel)
+CpuLevel dispatchInit(CpuLevel maxLevel);
+
+// Fonction : dispatchLevel
+// Description : Retourne le niveau lié par le dernier appel à dispatchInit
+// Retour : niveau courant (CPU_GENERIC si dispatchInit n'a pas été appelé)
+CpuLevel dispatchLevel(void);
+
+// ========================================================================
+// VARIANTES (une unité de compilation par jeu d'instructions)
+// ========================================================================
+
+// Variantes génériques (kernels.c)
+void gridRowMaskGeneric(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]);
+void randFillGeneric(int *out, int count);
+
+// Variantes SSE4.2 (kernels_sse42.c, compilé avec -msse4.2)
+void gridRowMaskSse42(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]);
+void densityMapSse42(const uint16_t rows[GRID], const ShipConfig *config,
+                     int weights[GRID * GRID]);
+void randFillSse42(int *out, int count);
+
+// Variantes AVX2 (kernels_avx2.c, compilé avec -mavx2)
+void gridRowMaskAvx2(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]);
+void densityMapAvx2(const uint16_t rows[GRID], const ShipConfig *config,
+                    int weights[GRID * GRID]);
+void randFillAvx2(int *out, int count);
+
+// Variantes AVX-512 (kernels_avx512.c, compilé avec -mavx512f -mavx512bw -mavx512vl)
+void gridRowMaskAvx512(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]);
+void densityMapAvx512(const uint16_t rows[GRID], const ShipConfig *config,
+                      int weights[GRID * GRID]);
+void randFillAvx512(int *out, int count);
+
+// Fin de la condition #ifndef KERNELS_H
+#endif
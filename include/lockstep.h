@@ -0,0 +1,244 @@
+// ========================================================================
+// FICHIER : lockstep.h (Lockstep Network Play Header)
+// DESCRIPTION : Partie à deux en réseau sans serveur, en lockstep : les
+//               pairs n'échangent que leurs tirs, la réponse au dernier tir
+//               reçu et un octet de contrôle de leur état (quelques
+//               centaines d'octets par partie)
+//
+//   COMMIT  version, empreintes SHA-256 (sel || flotte)
+//           et (jeton du tirage au sort)                    66 octets
+//   COIN    jeton du tirage au sort                         17 octets
+//   MOVE    tir, réponse au tir adverse, contrôle           4 octets
+//   REVEAL  sel, flotte, hachage final de l'état            43 octets
+//
+//   Chaque pair envoie d'abord COMMIT : sa flotte et un jeton aléatoire
+//   sont engagés sans être dévoilés. Une fois les deux COMMIT reçus,
+//   chacun dévoile son jeton (COIN) ; le premier tireur est tiré des deux
+//   jetons vérifiés. Engagé avant de connaître le jeton adverse, aucun
+//   pair ne peut choisir le tirage : il peut seulement refuser de dévoiler
+//   le sien, ce qui interrompt la partie. Un MOVE
+//   porte le résultat du tir adverse précédent (case codée comme
+//   protoCellCode, LOCKSTEP_NONE au premier coup) puis le tir du joueur
+//   (x * GRID + y) ; celui dont la flotte vient d'être détruite répond
+//   avec le tir LOCKSTEP_NONE. L'octet de contrôle est le bas du hachage
+//   de Zobrist des deux grilles publiques : une divergence se voit au
+//   coup suivant. En fin de partie, REVEAL dévoile sel et flotte ; chaque
+//   pair vérifie l'engagement puis rejoue tous les tirs dans le moteur
+//   (engine.c, même code que le jeu) pour contrôler chaque réponse
+//
+//   Les grilles vraies ne quittent jamais leur pair pendant la partie :
+//   seul le défenseur sait résoudre un tir, sa réponse est donc crue sur
+//   parole jusqu'au REVEAL, qui détecte toute réponse fausse
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include <stddef.h>     // Pour size_t
+#include <stdint.h>     // Types entiers de taille fixe
+#include "types.h"      // GRID, SHIP_COUNT
+#include "proto.h"      // ProtoShip, codage des cases
+#include "sha256.h"     // SHA256_SIZE
+
+// Version du protocole (COMMIT)
+#define LOCKSTEP_VERSION 2
+
+// Taille du sel ajouté à la flotte avant hachage
+#define LOCKSTEP_SALT 16
+
+// Taille du jeton du tirage au sort du premier tireur
+#define LOCKSTEP_NONCE 16
+
+// Tir ou réponse absents (premier coup, flotte détruite)
+#define LOCKSTEP_NONE 0xFF
+
+// Taille du plus long message (COMMIT, type compris)
+#define LOCKSTEP_MAX_MESSAGE (2 + 2 * SHA256_SIZE)
+
+// Types de messages
+typedef enum {
+    LS_COMMIT = 1,               // Engagement de la flotte
+    LS_MOVE,                     // Réponse au tir adverse et nouveau tir
+    LS_REVEAL,                   // Flotte dévoilée en fin de partie
+    LS_COIN,                     // Jeton du tirage au sort dévoilé
+    LS_TYPES                     // Nombre de types + 1
+} LockstepType;
+
+// Message décodé
+typedef struct {
+    LockstepType type;
+    union {
+        struct {
+            uint8_t version;
+            uint8_t digest[SHA256_SIZE];
+            uint8_t coin[SHA256_SIZE];       // Empreinte du jeton
+        } commit;                            // COMMIT
+        struct { uint8_t nonce[LOCKSTEP_NONCE]; } coin;  // COIN
+        struct { uint8_t shot, answer, check; } move;  // MOVE
+        struct {
+            uint8_t salt[LOCKSTEP_SALT];
+            ProtoShip fleet[SHIP_COUNT];
+            uint64_t hash;                   // Hachage de l'état final
+        } reveal;                            // REVEAL
+    } u;
+} LockstepMsg;
+
+// Résultat d'une étape
+typedef enum {
+    LOCKSTEP_OK,                 // Message accepté
+    LOCKSTEP_BAD_MESSAGE,        // Message inattendu ou invalide (tir hors grille, déjà joué)
+    LOCKSTEP_DESYNC,             // États différents (octet de contrôle ou hachage final)
+    LOCKSTEP_BAD_COMMIT,         // Flotte dévoilée différente de la flotte engagée
+    LOCKSTEP_BAD_FLEET,          // Flotte dévoilée invalide
+    LOCKSTEP_LIE,                // Réponse contredite par la flotte dévoilée
+    LOCKSTEP_BAD_COIN            // Jeton dévoilé différent du jeton engagé
+} LockstepStatus;
+
+// Un tir joué : place du tireur, case, réponse du défenseur (protoCellCode)
+typedef struct {
+    uint8_t seat, index, code;
+} LockstepShot;
+
+// Partie en cours, vue d'un pair
+typedef struct {
+    int seat;                    // Place locale (0 ou 1)
+    int started;                 // Engagement adverse reçu
+    int first;                   // Place qui tire la première (-1 = pas encore tirée)
+    int turn;                    // Place qui doit envoyer MOVE (-1 = fin des échanges)
+    int over;                    // Une flotte est détruite
+    int winner;                  // Vainqueur (-1 = partie en cours)
+    int grid[GRID][GRID];        // Grille locale, résolue au fil des tirs adverses
+    ProtoShip fleet[SHIP_COUNT]; // Flotte locale engagée
+    uint8_t salt[LOCKSTEP_SALT]; // Sel de l'engagement local
+    uint8_t nonce[LOCKSTEP_NONCE];    // Jeton local du tirage au sort
+    uint8_t commits[2][SHA256_SIZE];  // Engagements des deux places
+    uint8_t coins[2][SHA256_SIZE];    // Empreintes des jetons des deux places
+    int boards[2][GRID][GRID];   // Grilles publiques (résultats connus des deux pairs)
+    int sunk[2];                 // Bateaux coulés de chaque place
+    int pending;                 // Case du dernier tir local sans réponse (-1 = aucun)
+    int answer;                  // Réponse à envoyer avec le prochain MOVE
+    int shots;                   // Tirs joués
+    LockstepShot log[2 * GRID * GRID];  // Tirs joués, dans l'ordre
+} Lockstep;
+
+// Fonction : lockstepSize
+// Description : Taille d'un message de ce type, octet de type compris
+// Paramètres :
+//   - type : type de message
+// Retour : taille en octets, 0 si le type est inconnu
+size_t lockstepSize(int type);
+
+// Fonction : lockstepEncode
+// Description : Écrit un message dans un tampon
+// Paramètres :
+//   - msg : message à écrire
+//   - buf : tampon de sortie
+//   - cap : place disponible
+// Retour : octets écrits, 0 si la place manque ou si le type est inconnu
+size_t lockstepEncode(const LockstepMsg *msg, uint8_t *buf, size_t cap);
+
+// Fonction : lockstepDecode
+// Description : Lit un message en tête d'un tampon
+// Paramètres :
+//   - buf : octets reçus
+//   - len : nombre d'octets reçus
+//   - msg : message en sortie
+// Retour : octets consommés, 0 si le message est incomplet, -1 si le type
+//          est inconnu
+int lockstepDecode(const uint8_t *buf, size_t len, LockstepMsg *msg);
+
+// Fonction : lockstepInit
+// Description : Prépare une partie sur une flotte placée (par exemple par
+//               placeShips) et produit son engagement et celui du jeton
+// Paramètres :
+//   - ls     : partie à initialiser
+//   - seat   : place locale (0 pour l'hôte, 1 pour l'invité)
+//   - grid   : grille avec les bateaux 1 à SHIP_COUNT
+//   - salt   : sel secret, imprévisible pour l'adversaire
+//   - nonce  : jeton du tirage au sort, imprévisible pour l'adversaire
+//   - commit : message COMMIT à envoyer
+// Retour : aucun (void)
+void lockstepInit(Lockstep *ls, int seat, int grid[GRID][GRID],
+                  const uint8_t salt[LOCKSTEP_SALT], const uint8_t nonce[LOCKSTEP_NONCE],
+                  LockstepMsg *commit);
+
+// Fonction : lockstepStart
+// Description : Enregistre l'engagement adverse et produit le COIN local
+//               (à envoyer seulement après avoir reçu ce COMMIT)
+// Paramètres :
+//   - ls   : partie en cours
+//   - peer : message COMMIT reçu
+//   - coin : message COIN à envoyer
+// Retour : LOCKSTEP_OK, ou LOCKSTEP_BAD_MESSAGE (type, version, doublon)
+LockstepStatus lockstepStart(Lockstep *ls, const LockstepMsg *peer, LockstepMsg *coin);
+
+// Fonction : lockstepFlip
+// Description : Vérifie le jeton adverse et fixe le premier tireur
+// Paramètres :
+//   - ls   : partie en cours (engagement adverse reçu)
+//   - peer : message COIN reçu
+// Retour : LOCKSTEP_OK, LOCKSTEP_BAD_MESSAGE ou LOCKSTEP_BAD_COIN
+LockstepStatus lockstepFlip(Lockstep *ls, const LockstepMsg *peer);
+
+// Fonction : lockstepMyTurn
+// Description : Indique si le pair local doit envoyer le prochain MOVE
+// Paramètres :
+//   - ls : partie en cours
+// Retour : 1 si c'est au pair local, 0 sinon
+int lockstepMyTurn(const Lockstep *ls);
+
+// Fonction : lockstepMove
+// Description : Prépare le MOVE local : réponse au dernier tir adverse et
+//               tir en (x, y), ou aucun tir si la flotte locale est détruite
+// Paramètres :
+//   - ls   : partie en cours (c'est au pair local)
+//   - x, y : case visée sur la grille adverse (ignorée si la partie est finie)
+//   - out  : message MOVE à envoyer
+// Retour : LOCKSTEP_OK, ou LOCKSTEP_BAD_MESSAGE (pas son tour, case invalide)
+LockstepStatus lockstepMove(Lockstep *ls, int x, int y, LockstepMsg *out);
+
+// Fonction : lockstepReceive
+// Description : Applique le MOVE adverse : réponse au tir local, contrôle
+//               de l'état, puis résolution du tir adverse sur la grille locale
+// Paramètres :
+//   - ls  : partie en cours
+//   - msg : message MOVE reçu
+// Retour : LOCKSTEP_OK, LOCKSTEP_BAD_MESSAGE ou LOCKSTEP_DESYNC
+LockstepStatus lockstepReceive(Lockstep *ls, const LockstepMsg *msg);
+
+// Fonction : lockstepHash
+// Description : Hachage de Zobrist des deux grilles publiques et du nombre
+//               de tirs (identique chez les deux pairs s'ils sont d'accord)
+// Paramètres :
+//   - ls : partie en cours
+// Retour : hachage de 64 bits
+uint64_t lockstepHash(const Lockstep *ls);
+
+// Fonction : lockstepReveal
+// Description : Prépare le REVEAL local (fin de partie)
+// Paramètres :
+//   - ls  : partie terminée
+//   - out : message REVEAL à envoyer
+// Retour : aucun (void)
+void lockstepReveal(const Lockstep *ls, LockstepMsg *out);
+
+// Fonction : lockstepVerify
+// Description : Vérifie le REVEAL adverse : engagement, validité de la
+//               flotte, puis partie rejouée dans le moteur pour contrôler
+//               chaque réponse, le vainqueur et le hachage final
+// Paramètres :
+//   - ls   : partie terminée
+//   - peer : message REVEAL reçu
+// Retour : LOCKSTEP_OK ou la première anomalie trouvée
+LockstepStatus lockstepVerify(const Lockstep *ls, const LockstepMsg *peer);
+
+// Fonction : lockstepStatusName
+// Description : Nom lisible d'un résultat
+// Paramètres :
+//   - status : résultat
+// Retour : chaîne constante
+const char *lockstepStatusName(LockstepStatus status);
+
+// Fin de la condition #ifndef LOCKSTEP_H
+#endif
@@ -0,0 +1,108 @@
+// ========================================================================
+// FICHIER : perfcount.h (Performance Counters Header)
+// DESCRIPTION : Compteurs matériels du processeur (perf_event_open, Linux)
+//               autour des zones mesurées par les bancs d'essai : cycles,
+//               instructions, défauts de cache et branchements mal prédits.
+//               Les compteurs forment un groupe lu d'un seul appel (valeurs
+//               cohérentes entre elles), limité au fil appelant et au mode
+//               utilisateur ; si le processeur les partage entre plusieurs
+//               groupes, les valeurs sont extrapolées au temps d'activité
+//               Ailleurs, ou si le noyau les refuse (perf_event_paranoid,
+//               machine virtuelle), perfOpen ne trouve aucun compteur
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef PERFCOUNT_H
+#define PERFCOUNT_H
+
+#include <stdio.h>      // Pour FILE
+#include <stdint.h>     // Pour uint64_t
+
+// Compteurs lus
+typedef enum {
+    PERF_CYCLES,                 // Cycles du processeur
+    PERF_INSTRUCTIONS,           // Instructions exécutées
+    PERF_CACHE_MISSES,           // Défauts du dernier niveau de cache
+    PERF_BRANCH_MISSES,          // Branchements mal prédits
+    PERF_EVENT_COUNT
+} PerfEvent;
+
+// Groupe de compteurs ouvert pour le fil appelant
+typedef struct {
+    int fd[PERF_EVENT_COUNT];          // Descripteur de chaque compteur (-1 = absent)
+    int slot[PERF_EVENT_COUNT];        // Rang de chaque compteur dans le groupe
+    int leader;                        // Descripteur du groupe (-1 = aucun compteur)
+    int members;                       // Compteurs du groupe
+    unsigned available;                // Compteurs ouverts (bit 1 << PerfEvent)
+} PerfCounters;
+
+// Lecture instantanée d'un groupe
+typedef struct {
+    uint64_t value[PERF_EVENT_COUNT];  // Valeurs brutes
+    uint64_t enabled;                  // Temps d'activation du groupe (ns)
+    uint64_t running;                  // Temps de comptage effectif (ns)
+} PerfReading;
+
+// Compteurs cumulés sur des zones mesurées
+typedef struct {
+    double value[PERF_EVENT_COUNT];    // Valeurs (extrapolées si partagées)
+    uint64_t regions;                  // Zones cumulées
+} PerfTotals;
+
+// Fonction : perfOpen
+// Description : Ouvre les compteurs disponibles pour le fil appelant ; ils
+//               comptent dès l'ouverture
+// Paramètres :
+//   - pc : groupe en sortie
+// Retour : nombre de compteurs ouverts (0 : aucun, pc reste utilisable)
+int perfOpen(PerfCounters *pc);
+
+// Fonction : perfClose
+// Description : Ferme les compteurs
+// Paramètres :
+//   - pc : groupe
+// Retour : aucun (void)
+void perfClose(PerfCounters *pc);
+
+// Fonction : perfBegin
+// Description : Lit les compteurs en entrée de zone
+// Paramètres :
+//   - pc    : groupe
+//   - start : lecture en sortie
+// Retour : aucun (void)
+void perfBegin(const PerfCounters *pc, PerfReading *start);
+
+// Fonction : perfEnd
+// Description : Lit les compteurs en sortie de zone et ajoute l'écart à des
+//               totaux
+// Paramètres :
+//   - pc     : groupe
+//   - start  : lecture faite par perfBegin
+//   - totals : totaux complétés
+// Retour : aucun (void)
+void perfEnd(const PerfCounters *pc, const PerfReading *start, PerfTotals *totals);
+
+// Fonction : perfTotalsInit
+// Description : Remet des totaux à zéro
+// Paramètres :
+//   - totals : totaux
+// Retour : aucun (void)
+void perfTotalsInit(PerfTotals *totals);
+
+// Fonction : perfPrint
+// Description : Une ligne : IPC, puis cycles, instructions, défauts de cache
+//               et branchements mal prédits divisés par units (par appel, par
+//               partie...) ; « n/d » pour un compteur absent
+// Paramètres :
+//   - pc     : groupe (compteurs disponibles)
+//   - totals : totaux
+//   - out    : flux de sortie
+//   - label  : libellé en tête de ligne
+//   - units  : diviseur des compteurs
+//   - unit   : nom de l'unité (« appel », « partie »...)
+// Retour : aucun (void)
+void perfPrint(const PerfCounters *pc, const PerfTotals *totals, FILE *out, const char *label,
+               double units, const char *unit);
+
+// Fin de la condition #ifndef PERFCOUNT_H
+#endif
@@ -0,0 +1,83 @@
+// ========================================================================
+// FICHIER : philox.h (Counter-Based Random Generator Header)
+// DESCRIPTION : Générateur à compteur Philox4x32-10 (Salmon et al., 2011) :
+//               chaque bloc de 4 mots est une fonction pure de (clé,
+//               compteur). La clé est la graine de la série, le compteur
+//               porte le numéro de partie, le flux et la position : le tirage
+//               numéro i de la partie N ne dépend ni des autres parties, ni
+//               du fil qui la joue, ni du nombre de fils, et s'obtient en
+//               temps constant (saut sans calculer les tirages précédents)
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <stdint.h>     // Types entiers de taille fixe
+
+// Flux d'une partie (tirages indépendants les uns des autres)
+#define RNG_STREAM_FLEET 0       // Placement des flottes
+#define RNG_STREAM_AI    1       // Tirages des IA
+
+// Générateur positionné dans un flux
+typedef struct {
+    uint32_t key[2];             // Graine de la série
+    uint32_t counter[4];         // {bloc (64 bits), partie, flux}
+    uint32_t block[4];           // Bloc du compteur courant
+    int used;                    // Mots du bloc déjà rendus (4 = à recalculer)
+} Philox;
+
+// Fonction : philoxBlock
+// Description : Dix tours de Philox4x32 sur un compteur
+// Paramètres :
+//   - counter : compteur de 128 bits
+//   - key     : clé de 64 bits
+//   - out     : 4 mots pseudo-aléatoires en sortie
+// Retour : aucun (void)
+void philoxBlock(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+// Fonction : philoxInit
+// Description : Place un générateur au début d'un flux d'une partie
+// Paramètres :
+//   - p       : générateur à initialiser
+//   - runSeed : graine de la série
+//   - game    : numéro de la partie dans la série
+//   - stream  : flux (RNG_STREAM_*)
+// Retour : aucun (void)
+void philoxInit(Philox *p, uint64_t runSeed, uint32_t game, uint32_t stream);
+
+// Fonction : philoxNext
+// Description : Mot suivant du flux
+// Paramètres :
+//   - p : générateur
+// Retour : 32 bits pseudo-aléatoires
+uint32_t philoxNext(Philox *p);
+
+// Fonction : philoxSkip
+// Description : Avance de n mots en temps constant
+// Paramètres :
+//   - p : générateur
+//   - n : nombre de mots à sauter
+// Retour : aucun (void)
+void philoxSkip(Philox *p, uint64_t n);
+
+// Fonction : philoxPosition
+// Description : Nombre de mots déjà tirés dans le flux (avec philoxInit et
+//               philoxSkip, suffit à reprendre exactement au même point)
+// Paramètres :
+//   - p : générateur
+// Retour : position en mots
+uint64_t philoxPosition(const Philox *p);
+
+// Fonction : philoxSeed
+// Description : Premier mot d'un flux, pour amorcer myRand() dans une partie
+//               (raccourci de philoxInit puis philoxNext)
+// Paramètres :
+//   - runSeed : graine de la série
+//   - game    : numéro de la partie
+//   - stream  : flux (RNG_STREAM_*)
+// Retour : graine de 32 bits
+unsigned int philoxSeed(uint64_t runSeed, uint32_t game, uint32_t stream);
+
+// Fin de la condition #ifndef PHILOX_H
+#endif
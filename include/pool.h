@@ -0,0 +1,84 @@
+// ========================================================================
+// FICHIER : pool.h (Thread Pool Header)
+// DESCRIPTION : Groupe de fils d'exécution persistants à vol de travail :
+//               chaque fil a sa propre file (deque de Chase-Lev) où il
+//               dépose les moitiés des tranches qu'il découpe ; un fil sans
+//               travail en vole une au bout de la file d'un autre
+//               Sert aux boucles de calcul des IA (tirages, évaluation des
+//               cases) comme aux parties du tournoi, de durées très inégales,
+//               les boucles imbriquées étant elles aussi réparties
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>     // Pour uint64_t
+
+// Nombre maximal de fils d'exécution du groupe
+#define POOL_MAX_THREADS 64
+
+// Nombre maximal de fils extérieurs au groupe appelant poolParallelFor
+// (au-delà, leurs appels s'exécutent en séquence)
+#define POOL_MAX_CALLERS 8
+
+// Tâche exécutée sur une tranche d'indices [begin, end)
+typedef void (*PoolTask)(void *ctx, int begin, int end);
+
+// Activité d'un fil depuis poolResetStats
+typedef struct {
+    int caller;                  // 1 pour un fil extérieur au groupe
+    uint64_t tasks;              // Tranches exécutées
+    uint64_t steals;             // Tranches volées à un autre fil
+    uint64_t idleNs;             // Temps passé sans travail (recherche, attente)
+    uint64_t wallNs;             // Temps écoulé
+} PoolWorkerStats;
+
+// Fonction : poolInit
+// Description : Démarre le groupe (remplace le groupe existant)
+// Paramètres :
+//   - threads : nombre total de fils, appelant compris (0 = nombre de processeurs)
+// Retour : nombre de fils effectivement utilisés
+int poolInit(int threads);
+
+// Fonction : poolShutdown
+// Description : Arrête et libère les fils du groupe
+// Retour : aucun (void)
+void poolShutdown(void);
+
+// Fonction : poolThreads
+// Description : Nombre de fils du groupe (démarre le groupe au premier appel)
+// Retour : nombre de fils, appelant compris
+int poolThreads(void);
+
+// Fonction : poolParallelFor
+// Description : Exécute task sur [0, count) découpé en tranches de grain
+//               indices, réparties entre les fils par vol de travail ;
+//               l'appelant participe et la fonction ne rend la main qu'une
+//               fois tout terminé (en attendant, l'appelant exécute d'autres
+//               tranches). Un appel depuis une tâche est lui aussi réparti ;
+//               plusieurs fils extérieurs peuvent appeler en même temps
+// Paramètres :
+//   - count : nombre d'indices
+//   - grain : taille d'une tranche (>= 1)
+//   - task  : fonction à exécuter
+//   - ctx   : contexte transmis à task
+// Retour : aucun (void)
+void poolParallelFor(int count, int grain, PoolTask task, void *ctx);
+
+// Fonction : poolResetStats
+// Description : Remet à zéro l'activité de tous les fils
+// Retour : aucun (void)
+void poolResetStats(void);
+
+// Fonction : poolStats
+// Description : Activité des fils du groupe puis des fils extérieurs qui
+//               ont appelé poolParallelFor
+// Paramètres :
+//   - out : tableau de sortie
+//   - max : taille du tableau
+// Retour : nombre d'entrées écrites
+int poolStats(PoolWorkerStats *out, int max);
+
+// Fin de la condition #ifndef POOL_H
+#endif
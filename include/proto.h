@@ -0,0 +1,174 @@
+// ========================================================================
+// FICHIER : proto.h (Network Protocol Header)
+// DESCRIPTION : Protocole binaire compact entre le serveur de parties et
+//               ses clients : chaque message est un octet de type suivi
+//               d'une charge de taille fixe pour ce type
+//
+//   Client -> serveur         Serveur -> client
+//   HELLO  version            MATCHED  place (0 commence)
+//   PLACE  6 x (x, y, vert.)  START    numéro de partie
+//   FIRE   x, y               RESULT   place du tireur, x, y, case (int16)
+//   WATCH  version, partie    OVER     vainqueur, raison
+//                             ERROR    code
+//                             KEYFRAME joueur courant, 2 grilles (codes)
+//                             DELTA    grille, case, code (16 bits)
+//
+//   La case de RESULT reprend le codage de Player.grid après le tir :
+//   -99 manqué, -id touché, -200-id coulé (tout le bateau l'est alors)
+//   La main passe à l'adversaire après chaque tir ; après OVER, le client
+//   peut renvoyer HELLO pour une nouvelle partie
+//
+//   Spectateurs : WATCH donne une image complète (KEYFRAME) puis un DELTA
+//   par tir, et OVER en fin de partie ; un KEYFRAME est rediffusé à
+//   intervalles réguliers pour les spectateurs arrivés en cours de partie
+//   Les cases y sont codées sur un octet (protoCellCode), flottes révélées
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef PROTO_H
+#define PROTO_H
+
+#include <stddef.h>     // Pour size_t
+#include <stdint.h>     // Types entiers de taille fixe
+#include "types.h"      // GRID, SHIP_COUNT, ShipConfig
+
+// Version du protocole (HELLO)
+#define PROTO_VERSION 2
+
+// Numéro de partie de WATCH pour suivre n'importe quelle partie en cours
+#define PROTO_ANY_MATCH 0xFFFFFFFFu
+
+// Taille du plus long message (KEYFRAME, type compris)
+#define PROTO_MAX_MESSAGE (2 + 2 * GRID * GRID)
+
+// Types de messages
+typedef enum {
+    MSG_HELLO = 1,               // Demande de partie
+    MSG_MATCHED,                 // Adversaire trouvé
+    MSG_PLACE,                   // Flotte du client
+    MSG_START,                   // Les deux flottes sont placées
+    MSG_FIRE,                    // Tir du client
+    MSG_RESULT,                  // Résultat d'un tir (envoyé aux deux joueurs)
+    MSG_OVER,                    // Fin de partie
+    MSG_ERROR,                   // Message refusé
+    MSG_WATCH,                   // Demande à suivre une partie (spectateur)
+    MSG_KEYFRAME,                // Image complète d'une partie suivie
+    MSG_DELTA,                   // Un tir dans une partie suivie
+    MSG_TYPES                    // Nombre de types + 1
+} MsgType;
+
+// Raisons de fin de partie
+typedef enum {
+    OVER_FLEET_DESTROYED,        // Flotte adverse détruite
+    OVER_FORFEIT                 // Adversaire déconnecté
+} OverReason;
+
+// Codes d'erreur
+typedef enum {
+    ERR_BAD_VERSION = 1,             // Version du protocole différente
+    ERR_BAD_STATE,               // Message inattendu à ce stade
+    ERR_BAD_FLEET,               // Flotte invalide (chevauchement, hors grille)
+    ERR_NOT_YOUR_TURN,           // Tir hors de son tour
+    ERR_BAD_SHOT,                // Case hors grille ou déjà visée
+    ERR_NO_MATCH,                // Partie à suivre introuvable ou pas commencée
+    ERR_FULL                     // Plus de place pour suivre une partie
+} ProtoError;
+
+// Position d'un bateau : coin supérieur gauche (ligne x, colonne y) et sens
+typedef struct {
+    uint8_t x, y, vertical;
+} ProtoShip;
+
+// Message décodé
+typedef struct {
+    MsgType type;
+    union {
+        uint8_t version;                     // HELLO
+        uint8_t seat;                        // MATCHED
+        uint32_t match;                      // START
+        ProtoShip fleet[SHIP_COUNT];         // PLACE
+        struct { uint8_t x, y; } fire;       // FIRE
+        struct {
+            uint8_t seat, x, y;
+            int16_t cell;
+        } result;                            // RESULT
+        struct { uint8_t winner, reason; } over;  // OVER (vainqueur 255 = aucun)
+        uint8_t error;                       // ERROR
+        struct { uint8_t version; uint32_t match; } watch;   // WATCH
+        struct {
+            uint8_t current;                 // Joueur qui doit tirer
+            uint8_t cells[2][GRID * GRID];   // Codes des cases (protoCellCode)
+        } keyframe;                          // KEYFRAME
+        struct { uint8_t board, index, code; } delta;  // DELTA (case = x * GRID + y)
+    } u;
+} ProtoMsg;
+
+// Fonction : protoSize
+// Description : Taille d'un message de ce type, octet de type compris
+// Paramètres :
+//   - type : type de message
+// Retour : taille en octets, 0 si le type est inconnu
+size_t protoSize(int type);
+
+// Fonction : protoEncode
+// Description : Écrit un message dans un tampon
+// Paramètres :
+//   - msg : message à écrire
+//   - buf : tampon de sortie
+//   - cap : place disponible
+// Retour : octets écrits, 0 si la place manque ou si le type est inconnu
+size_t protoEncode(const ProtoMsg *msg, uint8_t *buf, size_t cap);
+
+// Fonction : protoDecode
+// Description : Lit un message en tête d'un tampon
+// Paramètres :
+//   - buf : octets reçus
+//   - len : nombre d'octets reçus
+//   - msg : message en sortie
+// Retour : octets consommés, 0 si le message est incomplet, -1 si le type
+//          est inconnu (flux désynchronisé)
+int protoDecode(const uint8_t *buf, size_t len, ProtoMsg *msg);
+
+// Fonction : protoCellCode / protoCellValue
+// Description : Codage d'une case de Player.grid sur un octet (0 eau, id
+//               bateau intact, 0x10 | id touché, 0x20 manqué, 0x30 | id coulé)
+//               et décodage inverse
+// Paramètres :
+//   - v / code : valeur de la case ou code
+// Retour : code (< 64) ou valeur de la case
+uint8_t protoCellCode(int v);
+int protoCellValue(uint8_t code);
+
+// Fonction : protoApplyCell
+// Description : Reporte le résultat d'un tir sur une grille : la case prend
+//               sa nouvelle valeur, et si le bateau est coulé ses autres
+//               cases touchées passent aussi à -200-id
+// Paramètres :
+//   - g    : grille à mettre à jour
+//   - x, y : case visée
+//   - cell : nouvelle valeur de la case (RESULT, DELTA)
+// Retour : aucun (void)
+void protoApplyCell(int g[GRID][GRID], int x, int y, int cell);
+
+// Fonction : protoPlaceFleet
+// Description : Vérifie une flotte reçue et la place dans une grille vide
+//               (mêmes règles que le placement manuel : dans la grille,
+//               sans contact avec un autre bateau)
+// Paramètres :
+//   - fleet  : positions des bateaux (dans l'ordre de config)
+//   - config : tailles des bateaux
+//   - g      : grille vide en sortie
+// Retour : 1 si la flotte est valide et placée, 0 sinon
+int protoPlaceFleet(const ProtoShip fleet[SHIP_COUNT], const ShipConfig *config, int g[GRID][GRID]);
+
+// Fonction : protoFleetFromGrid
+// Description : Retrouve la position des bateaux d'une grille placée (par
+//               exemple par placeShips) pour l'envoyer dans PLACE
+// Paramètres :
+//   - g     : grille avec les bateaux 1 à SHIP_COUNT intacts
+//   - fleet : positions en sortie
+// Retour : aucun (void)
+void protoFleetFromGrid(int g[GRID][GRID], ProtoShip fleet[SHIP_COUNT]);
+
+// Fin de la condition #ifndef PROTO_H
+#endif
@@ -9,6 +9,28 @@
 // Inclusion du fichier d'en-tête contenant les définitions de types personnalisés
 // Ce fichier contient les définitions de GraphicsContext, Player, ShipConfig, etc.
 #include "types.h"
+#include "engine.h"     // EngineClock (horloge des animations)
+#include "spectate.h"   // Instantanés des parties du tableau de bord
+
+// Structure de contexte graphique SDL
+typedef struct {
+    // Pointeur vers la fenêtre SDL (gestion de la fenêtre graphique)
+    SDL_Window *window;
+    
+    // Pointeur vers le renderer SDL (contexte de dessin)
+    SDL_Renderer *renderer;
+} GraphicsContext;
+
+// Contexte graphique SDL (défini dans render.c)
+extern GraphicsContext graphics;
+
+// Fonction : renderSetClock
+// Description : Choisit l'horloge lue par les animations de drawGrid
+//               (vagues, fumée, épaves) ; par défaut le temps SDL
+// Paramètres :
+//   - clock : horloge en millisecondes (now à NULL = temps SDL)
+// Retour : aucun (void)
+void renderSetClock(EngineClock clock);
 
 // ========================================================================
 // DÉCLARATIONS DES FONCTIONS DE DESSIN PRIMITIVES ET EFFETS
@@ -170,6 +192,47 @@ void drawShipGhost(GraphicsContext *gfx, int grid[GRID][GRID], int mouseX, int m
 // Retour : aucun (void)
 void placeShipsSDL(GraphicsContext *gfx, Player *p, ShipConfig *config, int playerNum);
 
+// Fonction : showInfoBox
+// Description : Affiche une boîte de dialogue d'information SDL
+// Paramètres :
+//   - window : fenêtre SDL parente
+//   - format : format du message (comme printf)
+//   - a, b   : valeurs à formater
+// Retour : aucun (void)
+void showInfoBox(SDL_Window *window, const char *format, int a, int b);
+
+// ========================================================================
+// TABLEAU DE BORD DES SPECTATEURS (spectate.h)
+// ========================================================================
+
+// Plateaux par ligne et taille d'une case du tableau de bord (en pixels) :
+// 8 x 8 parties de deux grilles remplissent exactement la fenêtre
+#define DASH_COLS 8
+#define DASH_CELL (WIDTH / (DASH_COLS * 2 * GRID))
+
+// Fonction : dashboardInit
+// Description : Prépare la planche de sprites (un par état de case) et la
+//               toile du tableau de bord, qui garde les cases déjà dessinées
+// Paramètres :
+//   - gfx : contexte graphique
+// Retour : 1 si les textures sont prêtes, 0 sinon
+int dashboardInit(GraphicsContext *gfx);
+
+// Fonction : dashboardDraw
+// Description : Relève le dernier instantané de chaque plateau, redessine
+//               sur la toile les seules cases qui ont changé (un seul appel
+//               de géométrie pour tous les plateaux), affiche la toile puis
+//               encadre les plateaux (vainqueur en or quand la partie est finie)
+// Paramètres :
+//   - gfx : contexte graphique
+// Retour : nombre de cases redessinées
+int dashboardDraw(GraphicsContext *gfx);
+
+// Fonction : dashboardFree
+// Description : Libère les textures du tableau de bord
+// Retour : aucun (void)
+void dashboardFree(void);
+
 // Fin de la condition #ifndef RENDER_H
 #endif
 // Note : Ce fichier d'en-tête contient uniquement les déclarations (prototypes)
@@ -0,0 +1,51 @@
+// ========================================================================
+// FICHIER : sha256.h (SHA-256 Header)
+// DESCRIPTION : Empreinte SHA-256 (FIPS 180-4) pour les engagements du
+//               mode réseau en lockstep : une flotte est annoncée par son
+//               empreinte avant la partie et révélée à la fin
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stddef.h>     // Pour size_t
+#include <stdint.h>     // Types entiers de taille fixe
+
+// Taille d'une empreinte en octets
+#define SHA256_SIZE 32
+
+// Calcul en cours
+typedef struct {
+    uint32_t state[8];           // Variables de hachage
+    uint64_t length;             // Octets reçus
+    uint8_t block[64];           // Bloc en attente
+    size_t used;                 // Octets du bloc en attente
+} Sha256;
+
+// Fonction : sha256Init
+// Description : Démarre un calcul d'empreinte
+// Paramètres :
+//   - ctx : calcul à initialiser
+// Retour : aucun (void)
+void sha256Init(Sha256 *ctx);
+
+// Fonction : sha256Update
+// Description : Ajoute des octets au message
+// Paramètres :
+//   - ctx  : calcul en cours
+//   - data : octets à ajouter
+//   - len  : nombre d'octets
+// Retour : aucun (void)
+void sha256Update(Sha256 *ctx, const void *data, size_t len);
+
+// Fonction : sha256Final
+// Description : Termine le message (remplissage) et écrit l'empreinte
+// Paramètres :
+//   - ctx : calcul en cours (inutilisable ensuite)
+//   - out : empreinte en sortie
+// Retour : aucun (void)
+void sha256Final(Sha256 *ctx, uint8_t out[SHA256_SIZE]);
+
+// Fin de la condition #ifndef SHA256_H
+#endif
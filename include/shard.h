@@ -0,0 +1,276 @@
+// ========================================================================
+// FICHIER : shard.h (Sharded Simulation Header)
+// DESCRIPTION : Simulation répartie entre plusieurs processus : chaque
+//               processus (fragment) reçoit une plage de numéros de parties,
+//               est épinglé sur ses propres processeurs et publie ses
+//               résultats (victoires, défaites, histogramme des coups) dans
+//               une zone de mémoire partagée, un emplacement par fragment
+//               aligné sur une ligne de cache. Le coordinateur lit ces
+//               compteurs pendant le calcul ; un fragment qui plante ne perd
+//               que ses parties en cours, les autres ne sont pas touchés
+//               Un point de reprise (fichier) garde les compteurs publiés et
+//               la prochaine partie de chaque fragment : une longue série
+//               interrompue reprend sans rejouer les parties déjà publiées
+//               POSIX seulement (fork, mmap) ; ailleurs shardCreate échoue
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef SHARD_H
+#define SHARD_H
+
+#include <stdint.h>     // Pour uint64_t
+#include <stdatomic.h>  // Compteurs partagés entre processus
+#include "types.h"      // Pour GRID
+
+// Nombre maximal de fragments
+#define SHARD_MAX 64
+
+// Cases de l'histogramme des coups pour gagner (0 à GRID * GRID)
+#define SHARD_HIST_SIZE (GRID * GRID + 1)
+
+// État d'un fragment (vu du coordinateur)
+typedef enum {
+    SHARD_IDLE,                  // Pas encore lancé
+    SHARD_RUNNING,               // Processus en cours
+    SHARD_DONE,                  // Plage entièrement jouée
+    SHARD_FAILED                 // Processus arrêté avant la fin
+} ShardState;
+
+// Compteurs publiés par un fragment
+typedef struct {
+    _Alignas(64) atomic_int next;      // Prochaine partie à jouer
+    atomic_ullong games;               // Parties jouées
+    atomic_ullong wins;                // Flottes coulées
+    atomic_ullong losses;              // Flottes restées à flot (limite de coups)
+    atomic_ullong shots;               // Somme des coups
+    atomic_ullong hist[SHARD_HIST_SIZE];  // Parties par nombre de coups
+} ShardCounters;
+
+// Emplacement d'un fragment dans la zone partagée
+// Écrit par le seul fragment, lu à tout moment par le coordinateur : la
+// mise à jour se fait dans la copie non publiée, puis seq bascule d'une
+// copie à l'autre ; un fragment qui s'arrête en pleine mise à jour laisse
+// donc la dernière copie publiée intacte
+typedef struct {
+    _Alignas(64) atomic_uint seq;      // Version (copie publiée : seq & 1)
+    ShardCounters copies[2];           // Copie publiée et copie en écriture
+    _Alignas(64) int first;            // Première partie de la plage
+    int end;                           // Fin de la plage (exclue)
+    int cpus;                          // Processeurs attribués
+    int pid;                           // Processus (coordinateur)
+    ShardState state;                  // État (coordinateur)
+    int status;                        // Code de sortie ou signal (coordinateur)
+    int signaled;                      // 1 si arrêté par un signal
+} ShardSlot;
+
+// Zone partagée d'une exécution
+typedef struct {
+    int shards;                        // Nombre de fragments
+    int first;                         // Première partie de l'exécution
+    int games;                         // Nombre de parties
+    ShardSlot slots[SHARD_MAX];        // Un emplacement par fragment
+} ShardRun;
+
+// Résultats lus dans un ou plusieurs emplacements
+typedef struct {
+    uint64_t games;
+    uint64_t wins;
+    uint64_t losses;
+    uint64_t shots;
+    uint64_t hist[SHARD_HIST_SIZE];
+} ShardTotals;
+
+// Longueur maximale du nom d'une série (fin de chaîne comprise)
+#define SHARD_NAME_SIZE 16
+
+// Nombre maximal de séries dans un point de reprise
+#define SHARD_MAX_SECTIONS 8
+
+// Version du format des points de reprise
+#define SHARD_CHECKPOINT_VERSION 1
+
+// Série d'un point de reprise (une par IA)
+typedef struct {
+    char name[SHARD_NAME_SIZE];        // Nom de la série
+    double seconds;                    // Temps de calcul cumulé
+    int next[SHARD_MAX];               // Prochaine partie de chaque fragment
+    ShardTotals totals[SHARD_MAX];     // Compteurs publiés de chaque fragment
+} ShardSection;
+
+// ========================================================================
+// FORMAT DU POINT DE REPRISE (ordre des octets de la machine, vérifié par
+// le magique)
+//   ShardFileHeader                  (40 octets)
+//   pour chaque série :
+//     char name[SHARD_NAME_SIZE], double seconds
+//     pour chaque fragment : int32_t next, uint32_t reserved, ShardTotals
+// Les tirages de la partie n°g ne dépendent que de la graine de la série
+// et de g (philox.h) : l'état du générateur d'un fragment se résume donc
+// à la graine et à sa prochaine partie
+// ========================================================================
+typedef struct {
+    char magic[4];                     // "BNCK"
+    uint32_t version;                  // SHARD_CHECKPOINT_VERSION
+    uint32_t grid;                     // Taille de grille
+    int32_t shards;                    // Nombre de fragments
+    int32_t first;                     // Première partie de l'exécution
+    int32_t games;                     // Nombre de parties
+    uint64_t runSeed;                  // Graine de la série
+    uint32_t sections;                 // Nombre de séries
+    uint32_t reserved;                 // Alignement sur 8 octets
+} ShardFileHeader;
+
+// Point de reprise en mémoire
+typedef struct {
+    uint64_t runSeed;                  // Graine de la série
+    int first;                         // Première partie de l'exécution
+    int games;                         // Nombre de parties
+    int shards;                        // Nombre de fragments
+    int sections;                      // Séries utilisées
+    ShardSection section[SHARD_MAX_SECTIONS];
+} ShardCheckpoint;
+
+// Travail d'un fragment, exécuté dans le processus fils
+// Retour : code de sortie du processus (0 = plage terminée)
+typedef int (*ShardMain)(ShardSlot *slot, void *ctx);
+
+// Fonction : shardCreate
+// Description : Crée la zone partagée et découpe les parties en plages
+//               contiguës de tailles égales (à une partie près)
+// Paramètres :
+//   - shards : nombre de fragments (1 à SHARD_MAX)
+//   - first  : numéro de la première partie
+//   - games  : nombre de parties
+// Retour : zone créée, NULL en cas d'échec
+ShardRun *shardCreate(int shards, int first, int games);
+
+// Fonction : shardFree
+// Description : Libère la zone partagée
+// Paramètres :
+//   - run : zone à libérer
+// Retour : aucun (void)
+void shardFree(ShardRun *run);
+
+// Fonction : shardLaunch
+// Description : Lance un processus par fragment, épinglé (Linux) sur une
+//               part des processeurs autorisés ; le fils exécute fn puis se
+//               termine sans revenir à l'appelant
+// Paramètres :
+//   - run : zone partagée
+//   - fn  : travail d'un fragment
+//   - ctx : contexte transmis à fn (copié par fork)
+// Retour : nombre de fragments lancés
+int shardLaunch(ShardRun *run, ShardMain fn, void *ctx);
+
+// Fonction : shardStop
+// Description : Demande l'arrêt (SIGTERM) des fragments encore en cours ;
+//               shardWait les recueille ensuite
+// Paramètres :
+//   - run : zone partagée
+// Retour : aucun (void)
+void shardStop(ShardRun *run);
+
+// Fonction : shardWait
+// Description : Recueille les fragments terminés, en attendant au plus
+//               timeoutMs millisecondes qu'il s'en termine un
+// Paramètres :
+//   - run       : zone partagée
+//   - timeoutMs : attente maximale
+// Retour : nombre de fragments encore en cours
+int shardWait(ShardRun *run, int timeoutMs);
+
+// Fonction : shardBegin
+// Description : Ouvre une mise à jour des compteurs d'un fragment (fils) :
+//               la copie non publiée repart de la copie publiée
+// Paramètres :
+//   - slot : emplacement du fragment
+// Retour : aucun (void)
+void shardBegin(ShardSlot *slot);
+
+// Fonction : shardRecord
+// Description : Ajoute le résultat d'une partie (entre shardBegin et shardEnd)
+// Paramètres :
+//   - slot  : emplacement du fragment
+//   - shots : coups tirés
+//   - won   : 1 si la flotte a été coulée
+// Retour : aucun (void)
+void shardRecord(ShardSlot *slot, int shots, int won);
+
+// Fonction : shardEnd
+// Description : Fixe la prochaine partie à jouer et publie la copie mise à
+//               jour
+// Paramètres :
+//   - slot : emplacement du fragment
+//   - next : prochaine partie à jouer
+// Retour : aucun (void)
+void shardEnd(ShardSlot *slot, int next);
+
+// Fonction : shardSnapshot
+// Description : Lit la copie publiée d'un fragment sans le bloquer (relit
+//               si elle a basculé pendant la lecture)
+// Paramètres :
+//   - slot : emplacement du fragment
+//   - out  : résultats en sortie
+// Retour : prochaine partie à jouer par le fragment
+int shardSnapshot(const ShardSlot *slot, ShardTotals *out);
+
+// Fonction : shardMerge
+// Description : Somme les résultats de tous les fragments
+// Paramètres :
+//   - run : zone partagée
+//   - out : résultats en sortie
+// Retour : aucun (void)
+void shardMerge(const ShardRun *run, ShardTotals *out);
+
+// Fonction : shardCheckpointLoad
+// Description : Prépare un point de reprise pour une exécution, en
+//               reprenant le fichier s'il existe
+// Paramètres :
+//   - ck      : point de reprise en sortie (vide si le fichier n'existe pas)
+//   - path    : chemin du fichier
+//   - runSeed : graine de la série
+//   - first   : première partie
+//   - games   : nombre de parties
+//   - shards  : nombre de fragments
+// Retour : 1 si le fichier a été repris, 0 s'il n'existe pas, -1 s'il est
+//          illisible ou vient d'une autre exécution (ck est alors vide)
+int shardCheckpointLoad(ShardCheckpoint *ck, const char *path, uint64_t runSeed, int first,
+                        int games, int shards);
+
+// Fonction : shardCheckpointSave
+// Description : Écrit le point de reprise de façon atomique : fichier
+//               temporaire voisin, vidé sur le disque puis renommé ; une
+//               interruption pendant l'écriture laisse l'ancien fichier
+// Paramètres :
+//   - ck   : point de reprise
+//   - path : chemin du fichier
+// Retour : 1 en cas de succès, 0 sinon
+int shardCheckpointSave(const ShardCheckpoint *ck, const char *path);
+
+// Fonction : shardCheckpointSection
+// Description : Série d'un point de reprise, ajoutée si elle n'y est pas
+// Paramètres :
+//   - ck   : point de reprise
+//   - name : nom de la série
+// Retour : série, NULL si le point de reprise est plein
+ShardSection *shardCheckpointSection(ShardCheckpoint *ck, const char *name);
+
+// Fonction : shardCapture
+// Description : Copie les compteurs publiés des fragments dans une série
+// Paramètres :
+//   - run : zone partagée
+//   - sec : série en sortie
+// Retour : aucun (void)
+void shardCapture(const ShardRun *run, ShardSection *sec);
+
+// Fonction : shardRestore
+// Description : Recharge une série dans une zone pas encore lancée : chaque
+//               fragment reprendra à sa prochaine partie
+// Paramètres :
+//   - run : zone partagée
+//   - sec : série reprise
+// Retour : aucun (void)
+void shardRestore(ShardRun *run, const ShardSection *sec);
+
+// Fin de la condition #ifndef SHARD_H
+#endif
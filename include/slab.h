@@ -0,0 +1,82 @@
+// ========================================================================
+// FICHIER : slab.h (Slab Table Header)
+// DESCRIPTION : Table d'objets de taille fixe allouée en un seul bloc, avec
+//               liste d'emplacements libres : allocation et libération en
+//               temps constant, sans appel à malloc une fois la table créée
+//               Chaque emplacement occupe un multiple de 64 octets (une
+//               ligne de cache) ; un numéro de génération par emplacement
+//               permet de reconnaître une référence périmée
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef SLAB_H
+#define SLAB_H
+
+#include <stddef.h>     // Pour size_t
+#include <stdint.h>     // Pour uint32_t
+
+// Table d'objets
+typedef struct {
+    unsigned char *items;        // Bloc des emplacements
+    int *next;                   // Emplacement libre suivant (-1 = fin)
+    uint32_t *gens;              // Génération de chaque emplacement
+    size_t stride;               // Taille d'un emplacement (multiple de 64)
+    int capacity;                // Nombre d'emplacements
+    int freeHead;                // Premier emplacement libre (-1 = table pleine)
+    int used;                    // Emplacements occupés
+} Slab;
+
+// Fonction : slabInit
+// Description : Alloue une table de capacity objets de itemSize octets,
+//               tous à zéro
+// Paramètres :
+//   - s        : table à initialiser
+//   - itemSize : taille d'un objet
+//   - capacity : nombre d'objets
+// Retour : 1 en cas de succès, 0 si l'allocation échoue
+int slabInit(Slab *s, size_t itemSize, int capacity);
+
+// Fonction : slabFree
+// Description : Libère la table
+// Paramètres :
+//   - s : table à libérer
+// Retour : aucun (void)
+void slabFree(Slab *s);
+
+// Fonction : slabAlloc
+// Description : Prend un emplacement libre, remis à zéro
+// Paramètres :
+//   - s : table
+// Retour : indice de l'emplacement, -1 si la table est pleine
+int slabAlloc(Slab *s);
+
+// Fonction : slabRelease
+// Description : Rend un emplacement à la table ; sa génération augmente
+// Paramètres :
+//   - s     : table
+//   - index : emplacement alloué par slabAlloc
+// Retour : aucun (void)
+void slabRelease(Slab *s, int index);
+
+// Fonction : slabGet
+// Description : Objet d'un emplacement
+// Paramètres :
+//   - s     : table
+//   - index : emplacement
+// Retour : pointeur vers l'objet
+static inline void *slabGet(const Slab *s, int index) {
+    return s->items + (size_t)index * s->stride;
+}
+
+// Fonction : slabGen
+// Description : Génération courante d'un emplacement
+// Paramètres :
+//   - s     : table
+//   - index : emplacement
+// Retour : numéro de génération
+static inline uint32_t slabGen(const Slab *s, int index) {
+    return s->gens[index];
+}
+
+// Fin de la condition #ifndef SLAB_H
+#endif
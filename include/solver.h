@@ -0,0 +1,114 @@
+// ========================================================================
+// FICHIER : solver.h (Endgame Solver Header)
+// DESCRIPTION : Solveur exact de fin de partie : énumère toutes les flottes
+//               compatibles avec les observations (manqués, touchés, coulés)
+//               et donne la probabilité exacte d'occupation de chaque case
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <stdint.h>     // Pour uint16_t, uint64_t
+#include "types.h"      // GRID, ShipConfig
+
+// Nombre maximal de nœuds mémorisés par résolution (borne mémoire)
+#define SOLVER_MAX_NODES (1 << 18)
+
+// Issue d'une résolution
+typedef enum {
+    SOLVER_DONE,        // Énumération complète : résultat exact
+    SOLVER_SKIPPED,     // Espace de recherche estimé trop grand : rien calculé
+    SOLVER_ABORTED,     // Budget de temps ou de nœuds dépassé
+    SOLVER_PENDING      // Résolution par tranches pas encore terminée
+} SolverStatus;
+
+// Résultat d'une résolution complète
+typedef struct {
+    double total;                 // Nombre de flottes compatibles
+    double cells[GRID * GRID];    // Nombre de flottes occupant chaque case
+    double sunk[GRID * GRID];     // Nombre de flottes où un tir sur la case coule un bateau
+    double estimate;              // Taille estimée de l'espace de recherche
+    uint64_t nodes;               // Nœuds distincts explorés
+} SolverResult;
+
+// Fonction : solverRun
+// Description : Compte les flottes compatibles par parcours en profondeur,
+//               un bateau par niveau, avec propagation de contraintes et
+//               mémoïsation des sous-problèmes identiques
+//               Les bateaux ne se touchent pas (même en diagonale), chaque
+//               case touchée doit être couverte par un bateau restant
+// Paramètres :
+//   - freeRows  : cases où un bateau restant peut se trouver (masques de lignes)
+//   - hitRows   : cases touchées d'un bateau non coulé (incluses dans freeRows)
+//   - remaining : bateaux encore à flot (taille 0 = bateau coulé)
+//   - maxSearch : taille estimée au-delà de laquelle la résolution est refusée
+//   - budgetNs  : budget de temps en nanosecondes (0 = illimité)
+//   - out       : résultat (probabilité d'une case = cells[k] / total)
+// Retour : issue de la résolution (out n'est exploitable que si SOLVER_DONE)
+SolverStatus solverRun(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                       const ShipConfig *remaining, double maxSearch, uint64_t budgetNs,
+                       SolverResult *out);
+
+// Résolution découpée en tranches (mode coopératif sans fil d'exécution) :
+// chaque tranche s'arrête à son échéance et la suivante reprend le travail
+typedef struct SolverTask SolverTask;
+
+// Fonction : solverTaskCreate
+// Description : Prépare une résolution (placements, ordre des bateaux) ;
+//               une position trop grande ou sans flotte est tranchée ici
+// Paramètres : voir solverRun
+// Retour : résolution (NULL si la mémoire manque)
+SolverTask *solverTaskCreate(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                             const ShipConfig *remaining, double maxSearch);
+
+// Fonction : solverTaskStep
+// Description : Avance la résolution pendant au plus une tranche
+// Paramètres :
+//   - task    : résolution en cours
+//   - sliceNs : durée de la tranche en nanosecondes (0 = jusqu'au bout)
+//   - out     : résultat, rempli quand l'issue n'est plus SOLVER_PENDING (peut être NULL)
+// Retour : SOLVER_PENDING tant qu'il reste du travail, sinon l'issue finale
+SolverStatus solverTaskStep(SolverTask *task, uint64_t sliceNs, SolverResult *out);
+
+// Fonction : solverTaskFree
+// Description : Libère une résolution (terminée ou non)
+// Retour : aucun (void)
+void solverTaskFree(SolverTask *task);
+
+// Issue d'un tir sur une case pour une flotte donnée
+#define SOLVER_OUT_MISS 0   // Eau
+#define SOLVER_OUT_HIT  1   // Bateau touché
+#define SOLVER_OUT_SUNK 2   // Dernière case intacte d'un bateau : coulé
+
+// Échantillonneur de flottes compatibles (placements précalculés, lecture seule
+// pendant les tirages : utilisable depuis plusieurs fils d'exécution)
+typedef struct SolverSampler SolverSampler;
+
+// Fonction : samplerCreate
+// Description : Prépare le tirage de flottes compatibles avec les observations
+// Paramètres : voir solverRun
+// Retour : échantillonneur (NULL si la mémoire manque)
+SolverSampler *samplerCreate(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                             const ShipConfig *remaining);
+
+// Fonction : samplerDraw
+// Description : Tire une flotte compatible : les cases touchées sont d'abord
+//               couvertes une à une par un placement choisi au hasard, puis les
+//               bateaux restants sont posés au hasard ; recommence en cas
+//               d'impasse (tirage approché, pas exactement uniforme)
+// Paramètres :
+//   - sampler : échantillonneur
+//   - rngSeed : graine du tirage (même graine = même flotte)
+//   - outcome : issue d'un tir sur chaque case (SOLVER_OUT_*) en sortie
+// Retour : 1 si une flotte a été tirée, 0 après trop d'impasses
+int samplerDraw(const SolverSampler *sampler, uint64_t rngSeed,
+                unsigned char outcome[GRID * GRID]);
+
+// Fonction : samplerFree
+// Description : Libère l'échantillonneur
+// Retour : aucun (void)
+void samplerFree(SolverSampler *sampler);
+
+// Fin de la condition #ifndef SOLVER_H
+#endif
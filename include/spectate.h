@@ -0,0 +1,91 @@
+// ========================================================================
+// FICHIER : spectate.h (Spectator Feed Header)
+// DESCRIPTION : Simulation de SPECTATE_BOARDS parties IA contre IA sur un
+//               fil dédié, publiées après chaque tir dans un anneau
+//               d'instantanés par partie (sans verrou : le fil de simulation
+//               n'attend jamais le lecteur, le lecteur relit si l'instantané
+//               a été réécrit pendant sa copie)
+//               Le tableau de bord (render.h) lit les instantanés à son rythme
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef SPECTATE_H
+#define SPECTATE_H
+
+#include <stdint.h>     // Pour uint8_t, uint32_t
+#include "types.h"      // GRID
+#include "anytime.h"    // AILevel
+
+// Nombre de parties simultanées et profondeur de l'anneau par partie
+#define SPECTATE_BOARDS 64
+#define SPECTATE_RING 4
+
+// Passes du fil de simulation pendant lesquelles une partie finie reste affichée
+#define SPECTATE_HOLD_PASSES 40
+
+// État d'une case vu par le spectateur (flottes révélées)
+typedef enum {
+    SPECTATE_WATER,              // Eau non visée
+    SPECTATE_SHIP,               // Bateau intact
+    SPECTATE_MISS,               // Tir dans l'eau
+    SPECTATE_HIT,                // Bateau touché
+    SPECTATE_SUNK,               // Bateau coulé
+    SPECTATE_KINDS               // Nombre d'états
+} SpectateCell;
+
+// Instantané d'une partie
+typedef struct {
+    uint32_t version;            // Numéro de publication (croissant)
+    uint32_t game;               // Numéro de la partie sur ce plateau
+    int winner;                  // Vainqueur (-1 = partie en cours)
+    uint8_t cells[2][GRID][GRID];  // Grilles des deux joueurs (SpectateCell)
+} BoardSnapshot;
+
+// Compteurs globaux de la simulation
+typedef struct {
+    uint64_t games;              // Parties terminées
+    uint64_t shots;              // Tirs joués
+    uint64_t wins[2];            // Victoires de chaque IA
+} SpectateStats;
+
+// Fonction : spectateStart
+// Description : Lance le fil de simulation (les deux IA jouent sur chaque
+//               plateau ; la première commence)
+//               La graine de myRand() est propre à chaque fil : celle du fil
+//               de simulation part de startSeed (graine de l'appelant)
+// Paramètres :
+//   - levels    : niveaux des deux IA
+//   - startSeed : graine de myRand() du fil de simulation
+// Retour : 1 si le fil tourne, 0 sinon
+int spectateStart(const AILevel levels[2], unsigned int startSeed);
+
+// Fonction : spectateStop
+// Description : Arrête le fil de simulation et l'attend
+// Retour : aucun (void)
+void spectateStop(void);
+
+// Fonction : spectateVersion
+// Description : Numéro du dernier instantané publié d'un plateau (lecture
+//               sans copie, pour ignorer les plateaux inchangés)
+// Paramètres :
+//   - board : plateau (0 à SPECTATE_BOARDS - 1)
+// Retour : numéro de publication (0 = rien de publié)
+uint32_t spectateVersion(int board);
+
+// Fonction : spectateRead
+// Description : Copie le dernier instantané cohérent d'un plateau
+// Paramètres :
+//   - board : plateau (0 à SPECTATE_BOARDS - 1)
+//   - out   : instantané en sortie
+// Retour : 1 si un instantané a été copié, 0 si rien n'est encore publié
+int spectateRead(int board, BoardSnapshot *out);
+
+// Fonction : spectateStats
+// Description : Compteurs globaux (lus sans verrou)
+// Paramètres :
+//   - out : compteurs en sortie
+// Retour : aucun (void)
+void spectateStats(SpectateStats *out);
+
+// Fin de la condition #ifndef SPECTATE_H
+#endif
@@ -0,0 +1,171 @@
+// ========================================================================
+// FICHIER : stats.h (Statistics Header)
+// DESCRIPTION : Histogrammes log-linéaires à la manière de HdrHistogram :
+//               chaque puissance de deux est découpée en HIST_SUB cases
+//               égales, si bien que l'erreur relative d'une valeur reste
+//               sous 1 / HIST_SUB quelle que soit son ordre de grandeur
+//               (valeurs exactes sous 2 * HIST_SUB, donc pour les coups).
+//               Enregistrer une valeur coûte un calcul d'indice et une
+//               addition ; chaque fil a sa propre instance dans un
+//               HistogramSet (sans verrou ni atomique), fusionnée à la fin
+//               Servent aux outils (coups pour gagner, latence par décision,
+//               aller-retour réseau) et au temps des images du jeu
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>      // Pour FILE
+#include <stdint.h>     // Pour uint64_t
+#include <stdatomic.h>  // Instances des fils publiées dans un ensemble
+
+// Cases par puissance de deux (log2) : 64 cases, erreur relative < 1,6 %
+#define HIST_SUB_BITS 6
+#define HIST_SUB (1 << HIST_SUB_BITS)
+
+// Plus grande valeur distinguée : 2^40 - 1 (18 minutes en ns) ; au-delà,
+// les valeurs sont seulement comptées à part (hors plage) : un centile qui
+// y tombe vaut le maximum (exact), et les résumés signalent ces valeurs
+#define HIST_MAX_BITS 40
+
+// Nombre de cases
+#define HIST_BUCKETS ((HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB)
+
+// Fils d'exécution distincts au plus dans un ensemble
+#define HIST_MAX_THREADS 256
+
+// Histogramme (un seul fil écrit dedans)
+typedef struct {
+    uint64_t count;                    // Valeurs enregistrées
+    uint64_t min;                      // Plus petite valeur (exacte)
+    uint64_t max;                      // Plus grande valeur (exacte)
+    double sum;                        // Somme (moyenne exacte)
+    uint64_t overflow;                 // Valeurs hors plage (2^HIST_MAX_BITS et plus)
+    uint64_t buckets[HIST_BUCKETS];    // Valeurs par case
+} Histogram;
+
+// Ensemble d'instances, une par fil qui y enregistre
+typedef struct {
+    _Atomic(Histogram *) local[HIST_MAX_THREADS];  // Instance de chaque fil
+    atomic_ullong dropped;             // Valeurs perdues (mémoire, trop de fils)
+} HistogramSet;
+
+// Fonction : histInit
+// Description : Vide un histogramme
+// Paramètres :
+//   - h : histogramme
+// Retour : aucun (void)
+void histInit(Histogram *h);
+
+// Fonction : histRecord
+// Description : Enregistre une valeur (temps constant)
+// Paramètres :
+//   - h     : histogramme
+//   - value : valeur
+// Retour : aucun (void)
+void histRecord(Histogram *h, uint64_t value);
+
+// Fonction : histRecordCount
+// Description : Enregistre plusieurs fois la même valeur (reprise d'un
+//               histogramme à cases fixes, par exemple)
+// Paramètres :
+//   - h     : histogramme
+//   - value : valeur
+//   - count : nombre d'occurrences
+// Retour : aucun (void)
+void histRecordCount(Histogram *h, uint64_t value, uint64_t count);
+
+// Fonction : histMerge
+// Description : Ajoute les valeurs d'un histogramme à un autre
+// Paramètres :
+//   - dst : histogramme complété
+//   - src : histogramme ajouté
+// Retour : aucun (void)
+void histMerge(Histogram *dst, const Histogram *src);
+
+// Fonction : histPercentile
+// Description : Valeur sous laquelle se trouvent p % des valeurs (plus
+//               grande valeur de sa case, bornée par le maximum ; le
+//               maximum si le rang tombe dans les valeurs hors plage)
+// Paramètres :
+//   - h : histogramme
+//   - p : centile (0 à 100)
+// Retour : valeur, 0 si l'histogramme est vide
+uint64_t histPercentile(const Histogram *h, double p);
+
+// Fonction : histMean
+// Description : Moyenne des valeurs
+// Paramètres :
+//   - h : histogramme
+// Retour : moyenne, 0 si l'histogramme est vide
+double histMean(const Histogram *h);
+
+// Fonction : histPrint
+// Description : Une ligne de résumé : nombre, moyenne, p50, p90, p99,
+//               p99,9 et maximum, les valeurs divisées par scale, puis le
+//               nombre de valeurs hors plage s'il y en a
+// Paramètres :
+//   - h     : histogramme
+//   - out   : flux de sortie
+//   - label : libellé en tête de ligne
+//   - unit  : unité affichée après chaque valeur
+//   - scale : diviseur (1000 pour afficher des ns en µs)
+// Retour : aucun (void)
+void histPrint(const Histogram *h, FILE *out, const char *label, const char *unit, double scale);
+
+// Fonction : histCsvHeader
+// Description : En-tête des lignes écrites par histCsvRow
+// Paramètres :
+//   - out : flux de sortie
+// Retour : aucun (void)
+void histCsvHeader(FILE *out);
+
+// Fonction : histCsvRow
+// Description : Une ligne CSV : série, mesure, unité, nombre, minimum,
+//               moyenne, p50, p90, p99, p99,9, maximum, valeurs hors plage
+// Paramètres :
+//   - h      : histogramme
+//   - out    : flux de sortie
+//   - series : série (nom de l'IA, du test...)
+//   - metric : mesure (coups, décision...)
+//   - unit   : unité des valeurs
+//   - scale  : diviseur appliqué aux valeurs
+// Retour : aucun (void)
+void histCsvRow(const Histogram *h, FILE *out, const char *series, const char *metric,
+                const char *unit, double scale);
+
+// Fonction : histSetInit
+// Description : Prépare un ensemble vide
+// Paramètres :
+//   - set : ensemble
+// Retour : aucun (void)
+void histSetInit(HistogramSet *set);
+
+// Fonction : histSetRecord
+// Description : Enregistre une valeur dans l'instance du fil appelant
+//               (créée à son premier enregistrement)
+// Paramètres :
+//   - set   : ensemble
+//   - value : valeur
+// Retour : aucun (void)
+void histSetRecord(HistogramSet *set, uint64_t value);
+
+// Fonction : histSetMerge
+// Description : Fusionne les instances de tous les fils (une fois leurs
+//               enregistrements terminés)
+// Paramètres :
+//   - set : ensemble
+//   - out : histogramme en sortie
+// Retour : aucun (void)
+void histSetMerge(HistogramSet *set, Histogram *out);
+
+// Fonction : histSetFree
+// Description : Libère les instances et vide l'ensemble
+// Paramètres :
+//   - set : ensemble
+// Retour : aucun (void)
+void histSetFree(HistogramSet *set);
+
+// Fin de la condition #ifndef STATS_H
+#endif
@@ -0,0 +1,87 @@
+// ========================================================================
+// FICHIER : ttable.h (Transposition Table Header)
+// DESCRIPTION : Cache de transposition partagé et sans verrou : associe le
+//               hachage d'une observation (zobrist.h) au meilleur tir calculé
+//               et à un résumé de la carte de densité
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef TTABLE_H
+#define TTABLE_H
+
+#include <stdint.h>     // Pour uint64_t
+#include <stdatomic.h>  // Accès atomiques (partage entre fils d'exécution)
+
+// Résultat mémorisé pour une observation
+typedef struct {
+    int bestX, bestY;   // Meilleur tir trouvé
+    int maxWeight;      // Densité de la case choisie
+    int totalWeight;    // Somme des densités de la carte
+} TTResult;
+
+// Entrée de la table : la vérification vaut (clé XOR données), ce qui
+// permet de détecter une entrée déchirée par deux écritures concurrentes
+// sans verrou (la lecture est alors simplement considérée comme un échec)
+typedef struct {
+    _Atomic uint64_t check;
+    _Atomic uint64_t data;
+} TTEntry;
+
+// Table de taille fixe (puissance de 2), remplacement systématique
+typedef struct {
+    TTEntry *entries;        // Tableau des entrées
+    uint64_t mask;           // Nombre d'entrées - 1
+    atomic_ullong probes;    // Nombre de consultations
+    atomic_ullong hits;      // Nombre de consultations fructueuses
+    atomic_ullong stores;    // Nombre d'écritures
+} TTable;
+
+// Fonction : ttInit
+// Description : Alloue une table de 2^log2Entries entrées (16 octets chacune)
+// Paramètres :
+//   - tt          : table à initialiser
+//   - log2Entries : logarithme en base 2 du nombre d'entrées
+// Retour : 1 si l'allocation a réussi, 0 sinon
+int ttInit(TTable *tt, int log2Entries);
+
+// Fonction : ttFree
+// Description : Libère la mémoire de la table
+// Paramètres :
+//   - tt : table à libérer
+// Retour : aucun (void)
+void ttFree(TTable *tt);
+
+// Fonction : ttClear
+// Description : Vide la table et remet les compteurs à zéro
+// Paramètres :
+//   - tt : table à vider
+// Retour : aucun (void)
+void ttClear(TTable *tt);
+
+// Fonction : ttProbe
+// Description : Cherche une observation dans la table
+// Paramètres :
+//   - tt  : table à consulter
+//   - key : hachage de l'observation
+//   - out : résultat mémorisé (rempli si trouvé)
+// Retour : 1 si l'observation est présente, 0 sinon
+int ttProbe(TTable *tt, uint64_t key, TTResult *out);
+
+// Fonction : ttStore
+// Description : Mémorise le résultat d'une observation (écrase l'entrée existante)
+// Paramètres :
+//   - tt  : table à modifier
+//   - key : hachage de l'observation
+//   - in  : résultat à mémoriser
+// Retour : aucun (void)
+void ttStore(TTable *tt, uint64_t key, const TTResult *in);
+
+// Fonction : ttHitRate
+// Description : Taux de succès des consultations
+// Paramètres :
+//   - tt : table à consulter
+// Retour : proportion entre 0 et 1 (0 si aucune consultation)
+double ttHitRate(TTable *tt);
+
+// Fin de la condition #ifndef TTABLE_H
+#endif
@@ -3,11 +3,14 @@
 #ifndef TYPES_H
 #define TYPES_H
 
+#include <stdint.h>     // Types entiers de taille fixe (uint64_t)
+
 // ==================== DÉCLARATIONS EXTERNES (variables globales définies ailleurs) ====================
 
 // Déclaration externe de la variable globale 'seed' utilisée par myRand()
 // 'extern' indique que la variable est définie dans un autre fichier (probablement types.c ou main.c)
-extern unsigned int seed;
+// _Thread_local : chaque fil d'exécution a sa propre graine (parties en parallèle)
+extern _Thread_local unsigned int seed;
 
 // Déclaration (prototype) de la fonction de génération aléatoire
 // 'void' dans les paramètres indique que la fonction ne prend aucun paramètre
@@ -91,37 +94,14 @@ typedef struct {
     //   0 = pas encore tiré ici
     //   1 = déjà tiré ici
     int shots[GRID][GRID];
-} AIState;
 
-// Structure d'état général du jeu (gestion des tours et délais)
-typedef struct {
-    // Joueur dont c'est le tour : 0 = joueur 1, 1 = joueur 2/IA
-    int currentPlayer;
-    
-    // Flag : en attente que le prochain joueur confirme son tour (mode PvP)
-    int waitingNextPlayer;
-    
-    // Flag : en attente du délai IA (mode solo)
-    int waitingDelay;
-    
-    // Flag : en attente du délai PvP (mode joueur contre joueur)
-    int waitingPvPDelay;
-    
-    // Timestamp (en millisecondes) de la dernière action de l'IA
-    Uint32 lastActionTime;
-    
-    // Timestamp (en millisecondes) de la dernière action d'un joueur (mode PvP)
-    Uint32 lastPlayerActionTime;
-} GameState;
+    // Observation de la grille adverse (ce que l'IA sait, voir zobrist.h) :
+    //   0 = inconnu, 1 = manqué, 2 = touché, 3 = coulé
+    unsigned char obs[GRID][GRID];
 
-// Structure de contexte graphique SDL
-typedef struct {
-    // Pointeur vers la fenêtre SDL (gestion de la fenêtre graphique)
-    SDL_Window *window;
-    
-    // Pointeur vers le renderer SDL (contexte de dessin)
-    SDL_Renderer *renderer;
-} GraphicsContext;
+    // Hachage de Zobrist de l'observation (mis à jour à chaque tir)
+    uint64_t hash;
+} AIState;
 
 // Structure pour stocker un score avec le nom du joueur
 typedef struct {
@@ -137,7 +117,9 @@ typedef enum {
     SCORE_EASY,     // Mode facile contre IA
     SCORE_MEDIUM,   // Mode moyen contre IA
     SCORE_HARD,     // Mode difficile contre IA
-    SCORE_PVP       // Mode joueur contre joueur
+    SCORE_PVP,      // Mode joueur contre joueur
+    SCORE_EXPERT,   // Mode expert contre IA
+    SCORE_INFO      // Mode info contre IA
 } ScoreMode;
 
 // ==================== DÉCLARATIONS EXTERNES DES VARIABLES GLOBALES ====================
@@ -155,12 +137,6 @@ extern ShipConfig shipConfig;
 // État de l'intelligence artificielle
 extern AIState aiState;
 
-// État général du jeu
-extern GameState gameState;
-
-// Contexte graphique SDL
-extern GraphicsContext graphics;
-
 // Mode de placement des bateaux (1 = automatique, 2 = manuel)
 extern int placementMode;
 
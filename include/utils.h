@@ -4,7 +4,7 @@
 #define UTILS_H
 
 // Inclusion du fichier d'en-tête contenant les définitions de types personnalisés
-// Ce fichier contient les définitions de Player, AIState, GameState, etc.
+// Ce fichier contient les définitions de Player, AIState, ShipConfig, etc.
 #include "types.h"
 
 // ========================================================================
@@ -32,13 +32,6 @@ void initPlayer(Player *p);
 // Retour : aucun (void)
 void initAIState(AIState *ai);
 
-// Fonction : initGameState
-// Description : Initialise l'état du jeu (début de partie)
-// Paramètres :
-//   - gs : pointeur vers l'état du jeu à initialiser
-// Retour : aucun (void)
-void initGameState(GameState *gs);
-
 // Fonction : isAreaFree
 // Description : Vérifie si une zone rectangulaire est libre de tout bateau (avec marge)
 // Paramètres :
@@ -109,35 +102,11 @@ int isShipSunk(int g[GRID][GRID], int shipId);
 // Retour : aucun (void)
 void markShipSunk(int g[GRID][GRID], int shipId);
 
-// Fonction : getCurrentPlayer
-// Description : Retourne le joueur dont c'est le tour
-// Paramètres :
-//   - mode : mode de jeu (1 = PvP, autre = solo)
-//   - gs   : état du jeu
-// Retour : pointeur vers le joueur actuel
-Player* getCurrentPlayer(int mode, GameState *gs);
-
-// Fonction : getOpponent
-// Description : Retourne l'adversaire du joueur actuel
-// Paramètres :
-//   - mode : mode de jeu (1 = PvP, autre = solo)
-//   - gs   : état du jeu
-// Retour : pointeur vers l'adversaire
-Player* getOpponent(int mode, GameState *gs);
-
-// Fonction : showInfoBox
-// Description : Affiche une boîte de dialogue d'information SDL
-// Paramètres :
-//   - window : fenêtre SDL parente
-//   - format : format du message (comme printf)
-//   - a, b   : valeurs à formater
-// Retour : aucun (void)
-void showInfoBox(SDL_Window *window, const char *format, int a, int b);
-
 // Fonction : getScoreModeFromGameMode
-// Description : Convertit le mode de jeu (1-4) en mode de score (enum ScoreMode)
+// Description : Convertit le mode de jeu (1-6) en mode de score (enum ScoreMode)
 // Paramètres :
-//   - mode : mode de jeu (1 = PvP, 2 = facile, 3 = moyen, 4 = difficile)
+//   - mode : mode de jeu (1 = PvP, 2 = facile, 3 = moyen, 4 = difficile,
+//            5 = expert, 6 = info)
 // Retour : ScoreMode correspondant
 ScoreMode getScoreModeFromGameMode(int mode);
 
@@ -0,0 +1,57 @@
+// ========================================================================
+// FICHIER : vclock.h (Virtual Clock Header)
+// DESCRIPTION : Horloge virtuelle : temps réel multiplié par une vitesse
+//               réglable (pause, x1, x10, x100) sans saut au changement de
+//               vitesse ; les tours de la partie (engine.h) et les
+//               animations du rendu la lisent toutes deux
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef VCLOCK_H
+#define VCLOCK_H
+
+#include <stdint.h>     // Pour uint64_t
+#include "engine.h"     // EngineClock (source et lecture de l'horloge)
+
+// Horloge virtuelle (en millisecondes)
+typedef struct {
+    EngineClock source;          // Horloge réelle
+    uint64_t realBase;           // Temps réel au dernier changement de vitesse
+    uint64_t virtualBase;        // Temps virtuel au dernier changement de vitesse
+    unsigned rate;               // Vitesse (multiplicateur, 0 = pause)
+} VirtualClock;
+
+// Fonction : vclockInit
+// Description : Démarre l'horloge virtuelle à l'instant 0
+// Paramètres :
+//   - vc     : horloge à initialiser
+//   - source : horloge réelle (en millisecondes)
+//   - rate   : vitesse de départ (0 = pause)
+// Retour : aucun (void)
+void vclockInit(VirtualClock *vc, EngineClock source, unsigned rate);
+
+// Fonction : vclockNow
+// Description : Temps virtuel courant
+// Paramètres :
+//   - vc : horloge virtuelle
+// Retour : temps virtuel en millisecondes
+uint64_t vclockNow(const VirtualClock *vc);
+
+// Fonction : vclockSetRate
+// Description : Change la vitesse (le temps virtuel reste continu)
+// Paramètres :
+//   - vc   : horloge virtuelle
+//   - rate : nouvelle vitesse (0 = pause)
+// Retour : aucun (void)
+void vclockSetRate(VirtualClock *vc, unsigned rate);
+
+// Fonction : vclockEngineClock
+// Description : Présente l'horloge virtuelle sous la forme d'une EngineClock
+//               (l'horloge virtuelle doit rester en vie tant qu'elle sert)
+// Paramètres :
+//   - vc : horloge virtuelle
+// Retour : horloge à passer à engineInit ou renderSetClock
+EngineClock vclockEngineClock(VirtualClock *vc);
+
+// Fin de la condition #ifndef VCLOCK_H
+#endif
@@ -0,0 +1,55 @@
+// ========================================================================
+// FICHIER : zobrist.h (Zobrist Hashing Header)
+// DESCRIPTION : Hachage de Zobrist des grilles d'observation de l'IA
+//               (ce que l'IA sait de la grille adverse)
+// ========================================================================
+
+// Directive de préprocesseur pour éviter les inclusions multiples
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <stdint.h>     // Pour uint64_t
+
+// Inclusion du fichier d'en-tête contenant les définitions de types
+#include "types.h"
+
+// ========================================================================
+// ÉTATS D'UNE CASE OBSERVÉE
+// ========================================================================
+#define OBS_UNKNOWN 0   // Case pas encore visée
+#define OBS_MISS    1   // Tir dans l'eau
+#define OBS_HIT     2   // Bateau touché (pas encore coulé)
+#define OBS_SUNK    3   // Bateau coulé
+#define OBS_STATES  4   // Nombre d'états
+
+// Fonction : zobristKey
+// Description : Clé aléatoire 64 bits associée à une case dans un état donné
+//               La clé de l'état OBS_UNKNOWN vaut 0 : une grille vierge a un
+//               hachage nul. Les clés sont fixes d'une exécution à l'autre
+//               (elles peuvent être stockées dans des fichiers)
+// Paramètres :
+//   - x, y  : coordonnées de la case
+//   - state : état de la case (OBS_*)
+// Retour : clé de 64 bits
+uint64_t zobristKey(int x, int y, int state);
+
+// Fonction : zobristHashBoard
+// Description : Calcule le hachage complet d'une grille d'observation
+// Paramètres :
+//   - obs : grille d'observation (états OBS_*)
+// Retour : hachage de 64 bits
+uint64_t zobristHashBoard(unsigned char obs[GRID][GRID]);
+
+// Fonction : zobristUpdate
+// Description : Met à jour un hachage quand une case change d'état
+//               (deux OU exclusifs : retire l'ancien état, ajoute le nouveau)
+// Paramètres :
+//   - hash     : hachage à mettre à jour
+//   - x, y     : coordonnées de la case
+//   - oldState : état précédent
+//   - newState : nouvel état
+// Retour : aucun (void)
+void zobristUpdate(uint64_t *hash, int x, int y, int oldState, int newState);
+
+// Fin de la condition #ifndef ZOBRIST_H
+#endif
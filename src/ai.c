@@ -1,8 +1,31 @@
 // Inclusion des bibliothèques nécessaires
-#include <SDL3/SDL.h>   // Bibliothèque graphique SDL3
+#include <limits.h>     // Pour INT_MIN
+#include <stdatomic.h>  // Compteurs partagés entre fils d'exécution
+#include <stdlib.h>     // Pour malloc, calloc, free
+#include <math.h>       // Pour log2
+#include <string.h>     // Pour memset
 #include "types.h"      // Définitions des types personnalisés (Player, AIState, etc.)
 #include "utils.h"      // Fonctions utilitaires (myRand, isShipSunk, markShipSunk)
 #include "ai.h"         // Déclarations des fonctions d'IA (prototypes)
+#include "density.h"    // Noyaux de calcul de la carte de densité
+#include "kernels.h"    // Noyaux plateau liés par le dispatch (gridRowMask)
+#include "zobrist.h"    // Hachage des observations (états OBS_*)
+#include "ttable.h"     // Cache de transposition partagé
+#include "book.h"       // Bibliothèque d'ouvertures précalculée
+#include "solver.h"     // Solveur exact de fin de partie
+#include "chrono.h"     // Budget de temps du solveur
+#include "pool.h"       // Groupe de fils pour l'évaluation des tirs
+
+// Cache de transposition de l'IA experte (NULL = désactivé)
+static TTable *expertCache = NULL;
+
+// Réglages du solveur exact de l'IA experte (voir aiSetSolver)
+static double solverMaxSearch = AI_SOLVER_MAX_SEARCH;
+static uint64_t solverBudgetNs = AI_SOLVER_BUDGET_US * 1000ULL;
+
+// Compteurs du solveur (appels et résolutions complètes)
+static atomic_ullong solverCalls;
+static atomic_ullong solverSolved;
 
 // ============================================================================
 // FONCTION : enemyEasy
@@ -38,6 +61,7 @@ void enemyEasy(Player *target, AIState *ai) {
         target->grid[x][y] = -99;  // Marque comme tir manqué dans l'eau
     }
     // Si target->grid[x][y] < 0, c'est déjà touché/manqué, rien à faire
+    aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
 }
 
 // ============================================================================
@@ -85,6 +109,7 @@ void enemyMedium(Player *target, AIState *ai) {
                     // MANQUÉ : Case contient de l'eau ou déjà touché
                     target->grid[x][y] = -99;  // Marque comme eau touchée
                 }
+                aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
                 return;  // Tir effectué, on quitte la fonction
             }
         }
@@ -121,6 +146,7 @@ void enemyMedium(Player *target, AIState *ai) {
         // MANQUÉ
         target->grid[x][y] = -99;  // Marque comme eau touchée
     }
+    aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
 }
 
 // ============================================================================
@@ -171,6 +197,7 @@ void enemyHard(Player *target, AIState *ai) {
                 ai->currentY = ai->anchorY;
                 ai->direction = 0;  // Arrête la recherche dans cette direction
             }
+            aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
             return;  // Tir effectué
         } else {
             // Case invalide (hors grille ou déjà visée)
@@ -216,6 +243,7 @@ void enemyHard(Player *target, AIState *ai) {
                     target->grid[x][y] = -99;  // Marque comme eau touchée
                 }
 
+                aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
                 shotMade = 1;  // Un tir a été effectué
             }
         }
@@ -261,6 +289,7 @@ void enemyHard(Player *target, AIState *ai) {
                                     target->grid[x][y] = -99;  // Marque comme eau touchée
                                 }
 
+                                aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
                                 shotMade = 1;  // Un tir a été effectué
                             }
                         }
@@ -298,4 +327,577 @@ void enemyHard(Player *target, AIState *ai) {
         // MANQUÉ
         target->grid[x][y] = -99;  // Marque comme eau touchée
     }
+    aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
+}
+
+// ============================================================================
+// FONCTION : aiObserveShot
+// DESCRIPTION : Met à jour l'observation de l'IA et son hachage après un tir
+// PARAMÈTRES :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+//   - x, y   : case qui vient d'être visée (tir déjà résolu)
+// ============================================================================
+void aiObserveShot(Player *target, AIState *ai, int x, int y) {
+    int value = target->grid[x][y];
+    int state;
+
+    if (value <= -200) {
+        // BATEAU COULÉ : toutes ses cases (même valeur) passent à l'état coulé
+        for (int i = 0; i < GRID; i++) {
+            for (int j = 0; j < GRID; j++) {
+                if (target->grid[i][j] == value && ai->obs[i][j] != OBS_SUNK) {
+                    zobristUpdate(&ai->hash, i, j, ai->obs[i][j], OBS_SUNK);
+                    ai->obs[i][j] = OBS_SUNK;
+                }
+            }
+        }
+        return;
+    }
+
+    if (value == -99)
+        state = OBS_MISS;     // Tir dans l'eau
+    else if (value < 0)
+        state = OBS_HIT;      // Bateau touché
+    else
+        return;               // Case non résolue : rien à observer
+
+    zobristUpdate(&ai->hash, x, y, ai->obs[x][y], state);
+    ai->obs[x][y] = (unsigned char)state;
+}
+
+// ============================================================================
+// FONCTION : aiSetCache
+// DESCRIPTION : Branche un cache de transposition sur l'IA experte
+// ============================================================================
+void aiSetCache(TTable *cache) {
+    expertCache = cache;
+}
+
+// ============================================================================
+// FONCTION : aiObservationRows
+// DESCRIPTION : Traduit les observations de l'IA en cases libres et bateaux restants
+// RÈGLES :
+//   - case non visée ou touchée (bateau pas encore coulé) = libre
+//   - tir manqué ou bateau coulé = occupé
+//   - voisins d'un bateau coulé = occupés (les bateaux ne se touchent pas)
+//   - les bateaux coulés sont retirés de la configuration
+// PARAMÈTRES :
+//   - target    : pointeur vers le joueur cible
+//   - ai        : pointeur vers l'état de l'IA
+//   - rows      : cases libres en sortie (masques de lignes)
+//   - hits      : cases touchées d'un bateau non coulé en sortie (peut être NULL)
+//   - remaining : bateaux encore à flot en sortie
+// ============================================================================
+void aiObservationRows(Player *target, AIState *ai, uint16_t rows[GRID],
+                       uint16_t hits[GRID], ShipConfig *remaining) {
+    uint16_t shot[GRID], missed[GRID], sunk[GRID], halo[GRID];
+
+    *remaining = shipConfig;
+
+    // Masques de lignes calculés par les noyaux plateau (variante SIMD si disponible)
+    kernels.gridRowMask(ai->shots, 1, 1, shot);
+    kernels.gridRowMask(target->grid, -99, -99, missed);
+    kernels.gridRowMask(target->grid, INT_MIN, -200, sunk);
+
+    for (int i = 0; i < GRID; i++) {
+        // L'IA ne connaît que les cases qu'elle a visées
+        missed[i] &= shot[i];
+        sunk[i] &= shot[i];
+
+        // BATEAU COULÉ : retire le bateau de la configuration
+        for (int j = 0; j < GRID; j++)
+            if ((sunk[i] >> j) & 1)
+                remaining->sizes[-200 - target->grid[i][j] - 1] = 0;
+
+        // Étend chaque case coulée à ses voisines de ligne
+        halo[i] = (uint16_t)(sunk[i] | (sunk[i] << 1) | (sunk[i] >> 1));
+    }
+
+    // Case libre = ni manquée, ni coulée, ni voisine (8 directions) d'un bateau coulé
+    for (int i = 0; i < GRID; i++) {
+        uint16_t blocked = missed[i] | halo[i];
+        if (i > 0)        blocked |= halo[i - 1];
+        if (i < GRID - 1) blocked |= halo[i + 1];
+        rows[i] = ROW_MASK & (uint16_t)~blocked;
+    }
+
+    // Touches en cours (d'après l'observation de l'IA)
+    for (int i = 0; hits && i < GRID; i++) {
+        hits[i] = 0;
+        for (int j = 0; j < GRID; j++)
+            if (ai->obs[i][j] == OBS_HIT)
+                hits[i] |= (uint16_t)(1u << j);
+    }
+}
+
+// ============================================================================
+// FONCTION : computeDensityMap
+// DESCRIPTION : Calcule la carte de densité à partir des observations de l'IA
+//               (voir aiObservationRows) ; seuls les bateaux non coulés sont comptés
+// PARAMÈTRES :
+//   - target  : pointeur vers le joueur cible
+//   - ai      : pointeur vers l'état de l'IA
+//   - weights : carte de sortie (GRID * GRID entrées)
+// ============================================================================
+void computeDensityMap(Player *target, AIState *ai, int weights[GRID * GRID]) {
+    uint16_t rows[GRID];
+    ShipConfig remaining;
+
+    aiObservationRows(target, ai, rows, NULL, &remaining);
+    densityMap(rows, &remaining, weights);
+}
+
+// ============================================================================
+// FONCTION : aiSetSolver / aiSolverStats
+// DESCRIPTION : Réglages et compteurs du solveur exact de l'IA experte
+// ============================================================================
+void aiSetSolver(double maxSearch, uint64_t budgetUs) {
+    solverMaxSearch = maxSearch;
+    solverBudgetNs = budgetUs * 1000ULL;
+}
+
+void aiSolverStats(uint64_t *calls, uint64_t *solved) {
+    if (calls)
+        *calls = atomic_load(&solverCalls);
+    if (solved)
+        *solved = atomic_load(&solverSolved);
+}
+
+// ============================================================================
+// FONCTION : expertSolveShot (interne)
+// DESCRIPTION : Tente la résolution exacte de la position ; en cas de succès,
+//               choisit la case non visée la plus probablement occupée
+// PARAMÈTRES :
+//   - target    : pointeur vers le joueur cible
+//   - ai        : pointeur vers l'état de l'IA
+//   - maxSearch : seuil du solveur (0 = désactivé)
+//   - budgetNs  : budget de temps du solveur
+//   - result    : résumé pour le cache en sortie (densités en millionièmes)
+// RETOUR : 1 si le solveur a tranché, 0 s'il faut revenir à la densité
+// ============================================================================
+static int expertSolveShot(Player *target, AIState *ai, double maxSearch, uint64_t budgetNs,
+                           TTResult *result) {
+    uint16_t rows[GRID], hits[GRID];
+    ShipConfig remaining;
+    SolverResult solved;
+    double best;
+
+    if (maxSearch <= 0.0)
+        return 0;  // Solveur désactivé
+
+    aiObservationRows(target, ai, rows, hits, &remaining);
+    SolverStatus status = solverRun(rows, hits, &remaining, maxSearch, budgetNs, &solved);
+    if (status == SOLVER_SKIPPED)
+        return 0;
+    atomic_fetch_add_explicit(&solverCalls, 1, memory_order_relaxed);
+    if (status != SOLVER_DONE || solved.total <= 0.0)
+        return 0;  // Budget dépassé ou observation incohérente
+    atomic_fetch_add_explicit(&solverSolved, 1, memory_order_relaxed);
+
+    best = aiSolvedShot(ai, &solved, &result->bestX, &result->bestY);
+    result->maxWeight = (int)(1e6 * best / solved.total);
+    result->totalWeight = 1000000;
+    return result->bestX != -1;
+}
+
+// ============================================================================
+// FONCTION : aiSolvedShot
+// DESCRIPTION : Case non visée la plus probablement occupée d'après une
+//               résolution exacte (la première en cas d'égalité)
+// RETOUR : nombre de flottes occupant la case retenue
+// ============================================================================
+double aiSolvedShot(AIState *ai, const SolverResult *solved, int *outX, int *outY) {
+    double best = -1.0;
+
+    *outX = *outY = -1;
+    for (int x = 0; x < GRID; x++) {
+        for (int y = 0; y < GRID; y++) {
+            if (!ai->shots[x][y] && solved->cells[x * GRID + y] > best) {
+                best = solved->cells[x * GRID + y];
+                *outX = x;
+                *outY = y;
+            }
+        }
+    }
+    return best;
+}
+
+// ============================================================================
+// FONCTION : expertChooseShot
+// DESCRIPTION : Choisit le tir de l'IA experte sans le jouer
+// STRATÉGIE :
+//   - Début de partie : tir lu dans la bibliothèque d'ouvertures (book.h)
+//   - Fin de partie : si peu de flottes restent possibles, probabilités
+//     exactes du solveur (solver.h), qui traitent aussi le mode cible
+//   - Mode cible : s'il reste des touches non coulées, choisit parmi leurs
+//     voisines non visées celle de plus forte densité
+//   - Mode chasse : sinon, choisit la case non visée de plus forte densité
+//   En cas d'égalité, la première case rencontrée est retenue : le choix ne
+//   dépend que de l'observation, ce qui permet de le mémoriser dans le cache
+// PARAMÈTRES :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+//   - maxSearch : seuil du solveur exact (0 = densité seule)
+//   - budgetNs  : budget de temps du solveur exact
+//   - outX   : ligne choisie en sortie (-1 si toutes les cases sont visées)
+//   - outY   : colonne choisie en sortie
+// ============================================================================
+void expertChooseShotEx(Player *target, AIState *ai, double maxSearch, uint64_t budgetNs,
+                        int *outX, int *outY) {
+    int dx[4] = {-1, 1, 0, 0};  // Déplacements en X : haut, bas, gauche, droite
+    int dy[4] = {0, 0, -1, 1};  // Déplacements en Y : haut, bas, gauche, droite
+    int weights[GRID * GRID];   // Carte de densité
+    int bestX = -1, bestY = -1, bestWeight = -1;
+    TTResult cached;
+
+    // Ouverture connue : simple lecture de la table projetée en mémoire
+    if (bookLookup(ai->hash, &bestX, &bestY) && !ai->shots[bestX][bestY]) {
+        *outX = bestX;
+        *outY = bestY;
+        return;
+    }
+    bestX = bestY = -1;
+
+    // Observation déjà rencontrée : réutilise le tir mémorisé
+    // (on vérifie quand même que la case n'a pas été visée, en cas de collision)
+    if (expertCache && ttProbe(expertCache, ai->hash, &cached)
+        && cached.bestX >= 0 && cached.bestX < GRID && cached.bestY < GRID
+        && !ai->shots[cached.bestX][cached.bestY]) {
+        *outX = cached.bestX;
+        *outY = cached.bestY;
+        return;
+    }
+
+    // Peu de flottes possibles : résolution exacte dans le budget de temps
+    TTResult solved;
+    if (expertSolveShot(target, ai, maxSearch, budgetNs, &solved)) {
+        if (expertCache)
+            ttStore(expertCache, ai->hash, &solved);
+        *outX = solved.bestX;
+        *outY = solved.bestY;
+        return;
+    }
+
+    computeDensityMap(target, ai, weights);
+
+    // ÉTAPE 1 : Mode cible autour des touches non coulées
+    for (int i = 0; i < GRID; i++) {
+        for (int j = 0; j < GRID; j++) {
+            if (ai->obs[i][j] != OBS_HIT)
+                continue;
+
+            for (int dir = 0; dir < 4; dir++) {
+                int x = i + dx[dir];
+                int y = j + dy[dir];
+                if (x >= 0 && x < GRID && y >= 0 && y < GRID && !ai->shots[x][y]
+                    && weights[x * GRID + y] > bestWeight) {
+                    bestWeight = weights[x * GRID + y];
+                    bestX = x;
+                    bestY = y;
+                }
+            }
+        }
+    }
+
+    // ÉTAPE 2 : Mode chasse sur toute la grille
+    if (bestX == -1) {
+        for (int x = 0; x < GRID; x++) {
+            for (int y = 0; y < GRID; y++) {
+                if (!ai->shots[x][y] && weights[x * GRID + y] > bestWeight) {
+                    bestWeight = weights[x * GRID + y];
+                    bestX = x;
+                    bestY = y;
+                }
+            }
+        }
+    }
+
+    // Mémorise le tir et le résumé de la carte pour cette observation
+    if (expertCache && bestX != -1) {
+        TTResult result = {bestX, bestY, bestWeight, 0};
+        for (int k = 0; k < GRID * GRID; k++)
+            result.totalWeight += weights[k];
+        ttStore(expertCache, ai->hash, &result);
+    }
+
+    *outX = bestX;
+    *outY = bestY;
+}
+
+// ============================================================================
+// FONCTION : expertChooseShot
+// DESCRIPTION : Choix de l'IA experte avec les réglages du solveur (aiSetSolver)
+// ============================================================================
+void expertChooseShot(Player *target, AIState *ai, int *outX, int *outY) {
+    expertChooseShotEx(target, ai, solverMaxSearch, solverBudgetNs, outX, outY);
+}
+
+// ============================================================================
+// FONCTION : aiResolveShot
+// DESCRIPTION : Joue un tir choisi et met à jour l'observation de l'IA
+// PARAMÈTRES :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+//   - x, y   : case visée (non encore visée)
+// ============================================================================
+void aiResolveShot(Player *target, AIState *ai, int x, int y) {
+    ai->shots[x][y] = 1;  // Marque comme visée
+
+    if (target->grid[x][y] > 0) {
+        // TOUCHÉ
+        int shipId = target->grid[x][y];  // ID du bateau
+        target->grid[x][y] = -shipId;     // Marque comme touché
+
+        // Vérifie si le bateau est coulé
+        if (isShipSunk(target->grid, shipId))
+            markShipSunk(target->grid, shipId);  // Marque comme coulé
+    } else {
+        // MANQUÉ
+        target->grid[x][y] = -99;  // Marque comme eau touchée
+    }
+    aiObserveShot(target, ai, x, y);  // Met à jour l'observation de l'IA
+}
+
+// ============================================================================
+// FONCTION : enemyExpert
+// DESCRIPTION : IA de niveau expert - tire sur la case de densité maximale
+//               (voir expertChooseShotEx pour la stratégie)
+// PARAMÈTRES :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+// ============================================================================
+void enemyExpert(Player *target, AIState *ai) {
+    int bestX, bestY;
+
+    expertChooseShot(target, ai, &bestX, &bestY);
+    if (bestX != -1)
+        aiResolveShot(target, ai, bestX, bestY);  // Sinon toutes les cases sont visées
+}
+
+// ============================================================================
+// IA « INFO » : GAIN D'INFORMATION MAXIMAL
+// Le résultat d'un tir (eau, touché, coulé) est une fonction de la flotte
+// cachée : le gain d'information espéré d'un tir est donc l'entropie de son
+// résultat sur la distribution des flottes compatibles
+// ============================================================================
+
+// Contexte partagé des tâches parallèles de l'IA « info »
+typedef struct {
+    const SolverSampler *sampler;     // Échantillonneur de flottes
+    uint64_t seedBase;                // Graine des tirages (hachage de l'observation)
+    int first;                        // Premier tirage du lot
+    int samples;                      // Nombre de tirages du lot
+    unsigned char *outcomes;          // Issues par flotte tirée (samples * GRID * GRID)
+    unsigned char *accepted;          // 1 si le tirage a abouti
+    int (*shots)[GRID];               // Cases déjà visées
+    double (*counts)[3];              // Poids de chaque issue par case
+    double score[GRID * GRID];        // Entropie de l'issue par case (bits)
+    double pHit[GRID * GRID];         // Probabilité de toucher (départage)
+} InfoContext;
+
+// Tâche : tirage des flottes [begin, end) du lot
+static void infoDrawTask(void *arg, int begin, int end) {
+    InfoContext *ctx = arg;
+    for (int i = begin; i < end; i++) {
+        uint64_t index = (uint64_t)(ctx->first + i);
+        ctx->accepted[i] = (unsigned char)samplerDraw(ctx->sampler,
+                                                      ctx->seedBase + index * 0xD1B54A32D192ED03ULL,
+                                                      &ctx->outcomes[(size_t)i * GRID * GRID]);
+    }
+}
+
+// Tâche : ajout des issues des cases [begin, end) sur les flottes du lot
+static void infoCountTask(void *arg, int begin, int end) {
+    InfoContext *ctx = arg;
+    for (int c = begin; c < end; c++) {
+        if (ctx->shots[c / GRID][c % GRID])
+            continue;
+        for (int i = 0; i < ctx->samples; i++)
+            if (ctx->accepted[i])
+                ctx->counts[c][ctx->outcomes[(size_t)i * GRID * GRID + c]] += 1.0;
+    }
+}
+
+// Tâche : entropie de l'issue des cases [begin, end)
+static void infoScoreTask(void *arg, int begin, int end) {
+    InfoContext *ctx = arg;
+    for (int c = begin; c < end; c++) {
+        double total = ctx->counts[c][0] + ctx->counts[c][1] + ctx->counts[c][2];
+        ctx->score[c] = -1.0;
+        ctx->pHit[c] = 0.0;
+        if (ctx->shots[c / GRID][c % GRID] || total <= 0.0)
+            continue;
+
+        double h = 0.0;
+        for (int o = 0; o < 3; o++) {
+            double p = ctx->counts[c][o] / total;
+            if (p > 0.0)
+                h -= p * log2(p);
+        }
+        ctx->score[c] = h;
+        ctx->pHit[c] = (ctx->counts[c][1] + ctx->counts[c][2]) / total;
+    }
+}
+
+// ============================================================================
+// FONCTION : aiSetThreads
+// DESCRIPTION : Fixe le nombre de fils de l'IA « info »
+// ============================================================================
+int aiSetThreads(int threads) {
+    return poolInit(threads);
+}
+
+// ============================================================================
+// FONCTION : infoExactCounts
+// DESCRIPTION : Poids exacts de chaque issue par case (solveur exact)
+// RETOUR : 1 si le solveur a abouti sur une observation cohérente, 0 sinon
+// ============================================================================
+int infoExactCounts(Player *target, AIState *ai, double maxSearch, uint64_t budgetNs,
+                    double counts[GRID * GRID][3]) {
+    uint16_t rows[GRID], hits[GRID];
+    ShipConfig remaining;
+    SolverResult *solved;
+    int ok = 0;
+
+    if (maxSearch <= 0.0 || !(solved = malloc(sizeof(SolverResult))))
+        return 0;
+
+    aiObservationRows(target, ai, rows, hits, &remaining);
+    if (solverRun(rows, hits, &remaining, maxSearch, budgetNs, solved) == SOLVER_DONE)
+        ok = infoSolvedCounts(solved, counts);
+    free(solved);
+    return ok;
+}
+
+// ============================================================================
+// FONCTION : infoSolvedCounts
+// DESCRIPTION : Poids des issues de chaque case d'après une résolution exacte
+// RETOUR : 1 si au moins une flotte est compatible, 0 sinon (counts inchangé)
+// ============================================================================
+int infoSolvedCounts(const SolverResult *solved, double counts[GRID * GRID][3]) {
+    if (solved->total <= 0.0)
+        return 0;
+    for (int c = 0; c < GRID * GRID; c++) {
+        counts[c][SOLVER_OUT_MISS] = solved->total - solved->cells[c];
+        counts[c][SOLVER_OUT_HIT] = solved->cells[c] - solved->sunk[c];
+        counts[c][SOLVER_OUT_SUNK] = solved->sunk[c];
+    }
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : infoSampleCounts
+// DESCRIPTION : Ajoute aux poids les issues d'un lot de flottes tirées au
+//               hasard (tirages répartis sur le groupe de fils) ; le tirage
+//               numéro i ne dépend que de l'observation et de i
+// RETOUR : nombre de flottes effectivement tirées
+// ============================================================================
+int infoSampleCounts(Player *target, AIState *ai, int first, int samples,
+                     double counts[GRID * GRID][3]) {
+    uint16_t rows[GRID], hits[GRID];
+    ShipConfig remaining;
+    InfoContext ctx;
+    int drawn = 0;
+
+    memset(&ctx, 0, sizeof(ctx));
+    aiObservationRows(target, ai, rows, hits, &remaining);
+    ctx.sampler = samplerCreate(rows, hits, &remaining);
+    ctx.seedBase = ai->hash;
+    ctx.first = first;
+    ctx.samples = samples;
+    ctx.outcomes = malloc((size_t)samples * GRID * GRID);
+    ctx.accepted = calloc((size_t)samples, 1);
+    ctx.shots = ai->shots;
+    ctx.counts = counts;
+
+    if (ctx.sampler && ctx.outcomes && ctx.accepted) {
+        poolParallelFor(samples, 16, infoDrawTask, &ctx);
+        for (int i = 0; i < samples; i++)
+            drawn += ctx.accepted[i];
+        if (drawn > 0)
+            poolParallelFor(GRID * GRID, GRID, infoCountTask, &ctx);
+    }
+
+    samplerFree((SolverSampler *)ctx.sampler);
+    free(ctx.outcomes);
+    free(ctx.accepted);
+    return drawn;
+}
+
+// ============================================================================
+// FONCTION : infoBestCell
+// DESCRIPTION : Case non visée d'entropie maximale (évaluation en parallèle)
+//               Égalité : la case la plus probablement touchée, puis la première
+// RETOUR : 1 si une case a été trouvée, 0 sinon
+// ============================================================================
+int infoBestCell(AIState *ai, double counts[GRID * GRID][3], int *outX, int *outY) {
+    InfoContext *ctx = calloc(1, sizeof(InfoContext));
+    double bestScore = -1.0, bestHit = -1.0;
+
+    *outX = *outY = -1;
+    if (!ctx)
+        return 0;
+    ctx->shots = ai->shots;
+    ctx->counts = counts;
+
+    poolParallelFor(GRID * GRID, GRID, infoScoreTask, ctx);
+    for (int c = 0; c < GRID * GRID; c++) {
+        if (ctx->score[c] < 0.0)
+            continue;
+        if (ctx->score[c] > bestScore + 1e-12
+            || (ctx->score[c] > bestScore - 1e-12 && ctx->pHit[c] > bestHit)) {
+            bestScore = ctx->score[c];
+            bestHit = ctx->pHit[c];
+            *outX = c / GRID;
+            *outY = c % GRID;
+        }
+    }
+
+    free(ctx);
+    return *outX != -1;
+}
+
+// ============================================================================
+// FONCTION : infoChooseShot
+// DESCRIPTION : Choisit le tir de gain d'information maximal sans le jouer
+// STRATÉGIE :
+//   - Distribution exacte (solveur) si l'espace de recherche est assez petit,
+//     sinon AI_INFO_SAMPLES flottes tirées au hasard (en parallèle)
+//   - Entropie de l'issue de chaque case non visée (en parallèle)
+// PARAMÈTRES :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+//   - outX   : ligne choisie en sortie (-1 si toutes les cases sont visées)
+//   - outY   : colonne choisie en sortie
+// ============================================================================
+void infoChooseShot(Player *target, AIState *ai, int *outX, int *outY) {
+    double (*counts)[3] = calloc(GRID * GRID, sizeof(*counts));
+
+    *outX = *outY = -1;
+    if (counts
+        && (infoExactCounts(target, ai, solverMaxSearch, solverBudgetNs, counts)
+            || infoSampleCounts(target, ai, 0, AI_INFO_SAMPLES, counts) > 0))
+        infoBestCell(ai, counts, outX, outY);
+    free(counts);
+
+    // Aucune flotte trouvée (ou plus de case candidate) : stratégie experte
+    if (*outX == -1)
+        expertChooseShot(target, ai, outX, outY);
+}
+
+// ============================================================================
+// FONCTION : enemyInfo
+// DESCRIPTION : IA « info » - tire sur la case de gain d'information maximal
+//               (voir infoChooseShot pour la stratégie)
+// PARAMÈTRES :
+//   - target : pointeur vers le joueur cible
+//   - ai     : pointeur vers l'état de l'IA
+// ============================================================================
+void enemyInfo(Player *target, AIState *ai) {
+    int bestX, bestY;
+
+    infoChooseShot(target, ai, &bestX, &bestY);
+    if (bestX != -1)
+        aiResolveShot(target, ai, bestX, bestY);  // Sinon toutes les cases sont visées
 }
\ No newline at end of file
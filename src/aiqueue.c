@@ -0,0 +1,147 @@
+// Active les sémaphores POSIX avec -std=c11
+#define _POSIX_C_SOURCE 200809L
+
+// Inclusion des bibliothèques nécessaires
+#include <pthread.h>    // Fil de l'IA
+#include <semaphore.h>  // Réveil du fil quand un travail arrive
+#include <sched.h>      // Pour sched_yield
+#include <stdatomic.h>  // Boîtes aux lettres sans verrou
+#include "aiqueue.h"    // Déclarations de la file (prototypes)
+
+// Boîte aux lettres à un producteur et un consommateur : le producteur
+// n'écrit que tail, le consommateur que head (sur des lignes de cache
+// séparées pour que les deux fils ne se gênent pas)
+typedef struct {
+    _Alignas(64) atomic_uint head;   // Prochain élément à lire
+    _Alignas(64) atomic_uint tail;   // Prochain emplacement à écrire
+    AnytimeAI *slots[AIQUEUE_CAPACITY];
+} Mailbox;
+
+static Mailbox jobs;             // Boucle de jeu -> fil de l'IA
+static Mailbox replies;          // Fil de l'IA -> boucle de jeu
+
+static pthread_t worker;         // Fil de l'IA
+static sem_t pending;            // Nombre de travaux déposés non pris
+static int started = 0;          // Fil démarré
+static atomic_int stopping;      // Demande d'arrêt
+
+// ============================================================================
+// FONCTIONS INTERNES : mailboxPush / mailboxPop
+// DESCRIPTION : Dépôt (producteur) et retrait (consommateur) sans verrou ;
+//               l'ordre acquire/release publie le contenu du travail
+// ============================================================================
+static int mailboxPush(Mailbox *m, AnytimeAI *item) {
+    unsigned tail = atomic_load_explicit(&m->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&m->head, memory_order_acquire);
+
+    if (tail - head == AIQUEUE_CAPACITY)
+        return 0;  // Pleine
+    m->slots[tail & (AIQUEUE_CAPACITY - 1)] = item;
+    atomic_store_explicit(&m->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+static AnytimeAI *mailboxPop(Mailbox *m) {
+    unsigned head = atomic_load_explicit(&m->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&m->tail, memory_order_acquire);
+
+    if (head == tail)
+        return NULL;  // Vide
+    AnytimeAI *item = m->slots[head & (AIQUEUE_CAPACITY - 1)];
+    atomic_store_explicit(&m->head, head + 1, memory_order_release);
+    return item;
+}
+
+static void mailboxReset(Mailbox *m) {
+    atomic_store(&m->head, 0);
+    atomic_store(&m->tail, 0);
+}
+
+// ============================================================================
+// FONCTION : workerMain (interne)
+// DESCRIPTION : Prend les travaux dans l'ordre, les affine jusqu'au bout ou
+//               jusqu'à leur annulation et poste le résultat
+// ============================================================================
+static void *workerMain(void *arg) {
+    (void)arg;
+
+    for (;;) {
+        while (sem_wait(&pending) != 0)
+            ;  // Interrompu par un signal : attend de nouveau
+        if (atomic_load(&stopping))
+            break;
+
+        AnytimeAI *job = mailboxPop(&jobs);
+        if (!job)
+            continue;
+        anytimeRun(job);
+
+        // La boîte des résultats a la même capacité que celle des travaux :
+        // elle ne peut être pleine que si la boucle de jeu ne relève plus rien
+        while (!mailboxPush(&replies, job) && !atomic_load(&stopping))
+            sched_yield();
+    }
+    return NULL;
+}
+
+// ============================================================================
+// FONCTION : aiQueueStart
+// DESCRIPTION : Initialise les boîtes aux lettres et lance le fil
+// ============================================================================
+int aiQueueStart(void) {
+    if (started)
+        return 1;
+
+    mailboxReset(&jobs);
+    mailboxReset(&replies);
+    atomic_store(&stopping, 0);
+    if (sem_init(&pending, 0, 0) != 0)
+        return 0;
+    if (pthread_create(&worker, NULL, workerMain, NULL) != 0) {
+        sem_destroy(&pending);
+        return 0;
+    }
+    started = 1;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : aiQueueStop
+// DESCRIPTION : Réveille le fil avec la demande d'arrêt et l'attend
+// ============================================================================
+void aiQueueStop(void) {
+    if (!started)
+        return;
+
+    atomic_store(&stopping, 1);
+    sem_post(&pending);
+    pthread_join(worker, NULL);
+    sem_destroy(&pending);
+    mailboxReset(&jobs);
+    mailboxReset(&replies);
+    started = 0;
+}
+
+// ============================================================================
+// FONCTION : aiQueueSubmit
+// DESCRIPTION : Dépose le travail et réveille le fil ; sans fil, calcule le
+//               premier affinage sur place et poste directement le résultat
+// ============================================================================
+int aiQueueSubmit(AnytimeAI *job) {
+    if (!started) {
+        anytimeRefine(job);
+        return mailboxPush(&replies, job);
+    }
+    if (!mailboxPush(&jobs, job))
+        return 0;
+    sem_post(&pending);
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : aiQueuePoll
+// DESCRIPTION : Retire un résultat s'il y en a un
+// ============================================================================
+AnytimeAI *aiQueuePoll(void) {
+    return mailboxPop(&replies);
+}
@@ -0,0 +1,267 @@
+// Inclusion des bibliothèques nécessaires
+#include <string.h>     // Pour memset, memcpy
+#include "anytime.h"    // Déclarations de la réflexion (prototypes)
+#include "ai.h"         // Stratégies des IA
+#include "book.h"       // Ouvertures connues de l'IA experte
+#include "chrono.h"     // Tranches de temps
+
+// ============================================================================
+// FONCTION : anytimeStart
+// DESCRIPTION : Copie l'état et remet la réflexion à zéro
+// ============================================================================
+void anytimeStart(AnytimeAI *t, AILevel level, const Player *target, const AIState *ai) {
+    t->level = level;
+    t->board = *target;
+    t->state = *ai;
+    t->key = ai->hash;
+    t->startSeed = seed;
+    t->seed = seed;
+    t->bestX = t->bestY = -1;
+    t->step = 0;
+    t->finished = 0;
+    memset(t->counts, 0, sizeof(t->counts));
+    t->samples = 0;
+    t->phase = ANYTIME_FIRST;
+    t->task = NULL;
+    t->solverNs = 0;
+    t->sampleNs = 0;
+    t->sampleWorstNs = 0;
+    atomic_store(&t->cancel, 0);
+}
+
+// ============================================================================
+// FONCTION : classicMove (interne)
+// DESCRIPTION : Niveaux facile à difficile : l'IA joue en entier sur la
+//               copie (graine comprise), le coup est la case nouvellement
+//               visée ; anytimeCommit reprend la copie telle quelle
+// ============================================================================
+static void classicMove(AnytimeAI *t) {
+    AIState before = t->state;
+    unsigned int saved = seed;
+
+    seed = t->seed;
+    if (t->level == AI_EASY) enemyEasy(&t->board, &t->state);
+    else if (t->level == AI_MEDIUM) enemyMedium(&t->board, &t->state);
+    else enemyHard(&t->board, &t->state);
+    t->seed = seed;
+    seed = saved;
+
+    for (int i = 0; i < GRID; i++)
+        for (int j = 0; j < GRID; j++)
+            if (t->state.shots[i][j] && !before.shots[i][j]) {
+                t->bestX = i;
+                t->bestY = j;
+            }
+    t->finished = 1;
+}
+
+// ============================================================================
+// FONCTION : solverStage (interne)
+// DESCRIPTION : Une tranche du solveur exact (seuil élargi), dans la limite
+//               du budget cumulé ANYTIME_SOLVER_BUDGET_US
+//               Expert : case la plus probable ; info : entropie exacte
+// PARAMÈTRES :
+//   - t       : réflexion en cours
+//   - sliceNs : durée de la tranche (0 = jusqu'au bout du budget)
+// NOTE : découpée en tranches, la préparation (liste des placements) est un
+//        pas à part : la première tranche du solveur dispose de toute sa durée
+// ============================================================================
+static void solverStage(AnytimeAI *t, uint64_t sliceNs) {
+    uint64_t budget = (uint64_t)ANYTIME_SOLVER_BUDGET_US * 1000;
+    SolverResult solved;
+    SolverStatus status;
+
+    if (!t->task) {
+        uint16_t rows[GRID], hits[GRID];
+        ShipConfig remaining;
+        aiObservationRows(&t->board, &t->state, rows, hits, &remaining);
+        t->task = solverTaskCreate(rows, hits, &remaining, ANYTIME_SOLVER_MAX_SEARCH);
+        t->solverNs = 0;
+        if (!t->task) {
+            t->finished = t->level == AI_EXPERT;  // Mémoire insuffisante
+            t->phase = ANYTIME_SAMPLE;
+            return;
+        }
+        if (sliceNs)
+            return;  // Point de reprise : la résolution commence au pas suivant
+    }
+
+    if (sliceNs == 0 || sliceNs > budget - t->solverNs)
+        sliceNs = budget - t->solverNs;
+    uint64_t start = chronoNowNs();
+    status = solverTaskStep(t->task, sliceNs, &solved);
+    t->solverNs += chronoNowNs() - start;
+    if (status == SOLVER_PENDING && t->solverNs < budget)
+        return;  // Reprise à la tranche suivante
+
+    int x, y;
+    if (status == SOLVER_DONE && t->level == AI_EXPERT) {
+        if (solved.total > 0.0 && aiSolvedShot(&t->state, &solved, &x, &y) >= 0.0) {
+            t->bestX = x;
+            t->bestY = y;
+        }
+        t->finished = 1;
+    } else if (status == SOLVER_DONE && infoSolvedCounts(&solved, t->counts)) {
+        if (infoBestCell(&t->state, t->counts, &x, &y)) {
+            t->bestX = x;
+            t->bestY = y;
+        }
+        t->finished = 1;
+    } else {
+        // Position trop grande ou budget dépassé : l'expert garde la carte de
+        // densité, l'IA « info » passe à l'échantillonnage
+        t->finished = t->level == AI_EXPERT;
+        t->phase = ANYTIME_SAMPLE;
+    }
+    solverTaskFree(t->task);
+    t->task = NULL;
+}
+
+// ============================================================================
+// FONCTION : refineStage (interne)
+// DESCRIPTION : Un pas de réflexion selon le niveau et la phase
+//   - facile à difficile : le coup complet (un seul pas)
+//   - expert : carte de densité, puis solveur exact avec un seuil élargi
+//   - info   : coup expert (densité), puis distribution exacte si possible,
+//              sinon lots de flottes tirées au hasard cumulés
+//   Chaque pas est court, sauf le solveur, borné par sliceNs
+// ============================================================================
+static void refineStage(AnytimeAI *t, uint64_t sliceNs) {
+    if (t->level <= AI_HARD) {
+        classicMove(t);
+    } else if (t->phase == ANYTIME_FIRST) {
+        int bookX, bookY;
+        int fromBook = bookLookup(t->state.hash, &bookX, &bookY) && !t->state.shots[bookX][bookY];
+        expertChooseShotEx(&t->board, &t->state, 0.0, 0, &t->bestX, &t->bestY);
+        t->phase = ANYTIME_SOLVER;
+        if (fromBook && t->level == AI_EXPERT)
+            t->finished = 1;  // Ouverture connue : rien à affiner
+    } else if (t->phase == ANYTIME_SOLVER) {
+        solverStage(t, sliceNs);
+    } else {
+        int x, y;
+        int batch = ANYTIME_INFO_BATCH;
+
+        // Lot réduit aux trois quarts de ce qui reste de la tranche d'après le
+        // lot le plus cher par flotte (le coût d'un tirage varie d'une flotte
+        // à l'autre ; le tirage i ne dépend que de i : le résultat final est
+        // le même)
+        if (sliceNs && t->samples == 0) {
+            batch = ANYTIME_INFO_PROBE;  // Premier lot : mesure du coût
+        } else if (sliceNs) {
+            uint64_t fit = sliceNs / 4 * 3 / (t->sampleWorstNs + 1);
+            if (fit < (uint64_t)batch)
+                batch = fit > 0 ? (int)fit : 1;
+        }
+        if (batch > ANYTIME_INFO_MAX_SAMPLES - t->samples)
+            batch = ANYTIME_INFO_MAX_SAMPLES - t->samples;
+
+        uint64_t start = chronoNowNs();
+        int drawn = infoSampleCounts(&t->board, &t->state, t->samples, batch, t->counts);
+        uint64_t spent = chronoNowNs() - start;
+        t->sampleNs += spent;
+        if (batch > 0 && spent / (uint64_t)batch > t->sampleWorstNs)
+            t->sampleWorstNs = spent / (uint64_t)batch;
+
+        t->samples += batch;
+        if (drawn > 0 && infoBestCell(&t->state, t->counts, &x, &y)) {
+            t->bestX = x;
+            t->bestY = y;
+        }
+        if (t->samples >= ANYTIME_INFO_MAX_SAMPLES)
+            t->finished = 1;
+    }
+
+    t->step++;
+    if (t->bestX == -1)
+        t->finished = 1;  // Toutes les cases sont visées
+}
+
+// ============================================================================
+// FONCTION : anytimeRefine / anytimeRefineFor
+// DESCRIPTION : Un pas complet, ou autant de pas que la tranche le permet
+// ============================================================================
+int anytimeRefine(AnytimeAI *t) {
+    if (!t->finished)
+        refineStage(t, 0);
+    return !t->finished;
+}
+
+int anytimeRefineFor(AnytimeAI *t, uint64_t sliceNs) {
+    uint64_t deadline = chronoNowNs() + sliceNs;
+    uint64_t last = 0;  // Durée du dernier pas (prévision du suivant)
+
+    while (!t->finished) {
+        uint64_t now = chronoNowNs();
+        if (t->step > 0 && now + last / 2 >= deadline)
+            break;  // Le pas suivant déborderait probablement de la tranche
+        refineStage(t, now < deadline ? deadline - now : 1);
+        last = chronoNowNs() - now;
+    }
+    return !t->finished;
+}
+
+// ============================================================================
+// FONCTION : anytimeBestMove
+// DESCRIPTION : Coup courant
+// ============================================================================
+int anytimeBestMove(const AnytimeAI *t, int *outX, int *outY) {
+    *outX = t->bestX;
+    *outY = t->bestY;
+    return t->bestX != -1;
+}
+
+// ============================================================================
+// FONCTION : anytimeValid
+// DESCRIPTION : Même observation et, pour les niveaux qui tirent au hasard,
+//               même graine qu'au démarrage
+// ============================================================================
+int anytimeValid(const AnytimeAI *t, const AIState *ai) {
+    return t->key == ai->hash && (t->level > AI_HARD || t->startSeed == seed);
+}
+
+// ============================================================================
+// FONCTION : anytimeCommit
+// DESCRIPTION : Joue le coup ; les niveaux facile à difficile reprennent
+//               leur copie (grille cible, état de l'IA, graine)
+// ============================================================================
+void anytimeCommit(AnytimeAI *t, Player *target, AIState *ai) {
+    int x, y;
+
+    if (t->step == 0)
+        anytimeRefine(t);
+    anytimeRelease(t);
+    if (!anytimeBestMove(t, &x, &y))
+        return;
+
+    if (t->level <= AI_HARD) {
+        memcpy(target->grid, t->board.grid, sizeof(target->grid));
+        *ai = t->state;
+        seed = t->seed;
+    } else {
+        aiResolveShot(target, ai, x, y);
+    }
+}
+
+// ============================================================================
+// FONCTION : anytimeCancel / anytimeRun
+// DESCRIPTION : Arrêt demandé par un autre fil, affinage jusqu'à l'arrêt
+// ============================================================================
+void anytimeCancel(AnytimeAI *t) {
+    atomic_store(&t->cancel, 1);
+}
+
+void anytimeRun(AnytimeAI *t) {
+    uint64_t slice = (uint64_t)ANYTIME_FRAME_BUDGET_US * 1000;
+    while (anytimeRefineFor(t, slice) && !atomic_load(&t->cancel))
+        ;
+}
+
+// ============================================================================
+// FONCTION : anytimeRelease
+// DESCRIPTION : Abandonne une résolution exacte en cours
+// ============================================================================
+void anytimeRelease(AnytimeAI *t) {
+    solverTaskFree(t->task);
+    t->task = NULL;
+}
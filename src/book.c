@@ -0,0 +1,231 @@
+// Active mmap/fstat avec -std=c11 (fonctions POSIX)
+#define _POSIX_C_SOURCE 200809L
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour fopen, fwrite, fread
+#include <stdlib.h>     // Pour qsort, malloc, free
+#include <string.h>     // Pour memcmp, memcpy
+#include <stdatomic.h>  // Compteurs partagés entre fils d'exécution
+#include "types.h"      // Définitions des types personnalisés (GRID, ShipConfig)
+#include "book.h"       // Déclarations de la bibliothèque d'ouvertures
+
+#if !defined(_WIN32)
+#include <fcntl.h>      // Pour open
+#include <sys/mman.h>   // Pour mmap, munmap
+#include <sys/stat.h>   // Pour fstat
+#include <unistd.h>     // Pour close
+#endif
+
+// Bibliothèque active (NULL = aucune)
+static const unsigned char *bookData = NULL;   // Contenu du fichier
+static size_t bookSize = 0;                    // Taille du fichier
+static const uint64_t *bookKeys = NULL;        // Clés triées
+static const uint8_t *bookMoves = NULL;        // Tirs associés
+static size_t bookCount = 0;                   // Nombre d'entrées
+
+// Compteurs de consultations
+static atomic_ullong bookProbes;
+static atomic_ullong bookHits;
+
+// ============================================================================
+// FONCTION : bookHeaderInit (interne)
+// DESCRIPTION : Prépare l'en-tête correspondant à la partie en cours
+// ============================================================================
+static void bookHeaderInit(BookHeader *h, const ShipConfig *config, size_t count, int depth) {
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, "BNBK", 4);
+    h->version = BOOK_VERSION;
+    h->count = (uint32_t)count;
+    h->grid = GRID;
+    for (int s = 0; s < SHIP_COUNT; s++)
+        h->sizes[s] = config->sizes[s];
+    h->depth = (uint32_t)depth;
+}
+
+// ============================================================================
+// FONCTION : bookMap (interne)
+// DESCRIPTION : Charge le contenu brut du fichier
+//               mmap en lecture seule sous POSIX (pages partagées entre
+//               processus, chargées à la demande), lecture complète sinon
+// RETOUR : 1 si le fichier a été chargé, 0 sinon
+// ============================================================================
+static int bookMap(const char *path) {
+#if !defined(_WIN32)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return 0;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(BookHeader)) {
+        close(fd);
+        return 0;
+    }
+
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // La projection reste valide après fermeture
+    if (p == MAP_FAILED)
+        return 0;
+
+    bookData = p;
+    bookSize = (size_t)st.st_size;
+    return 1;
+#else
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return 0;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char *buffer = size >= (long)sizeof(BookHeader) ? malloc((size_t)size) : NULL;
+    if (!buffer || fread(buffer, 1, (size_t)size, f) != (size_t)size) {
+        free(buffer);
+        fclose(f);
+        return 0;
+    }
+    fclose(f);
+
+    bookData = buffer;
+    bookSize = (size_t)size;
+    return 1;
+#endif
+}
+
+// ============================================================================
+// FONCTION : bookClose
+// DESCRIPTION : Libère la bibliothèque active
+// ============================================================================
+void bookClose(void) {
+    if (bookData) {
+#if !defined(_WIN32)
+        munmap((void *)bookData, bookSize);
+#else
+        free((void *)bookData);
+#endif
+    }
+    bookData = NULL;
+    bookSize = 0;
+    bookKeys = NULL;
+    bookMoves = NULL;
+    bookCount = 0;
+}
+
+// ============================================================================
+// FONCTION : bookOpen
+// DESCRIPTION : Projette et valide un fichier d'ouvertures (en-tête, puis
+//               chaque entrée : un fichier corrompu ne doit pas produire de
+//               tir hors grille)
+// ============================================================================
+size_t bookOpen(const char *path, const ShipConfig *config) {
+    BookHeader expected;
+    const BookHeader *h;
+
+    bookClose();
+    atomic_store(&bookProbes, 0);
+    atomic_store(&bookHits, 0);
+    if (!bookMap(path))
+        return 0;
+
+    // Vérifie l'en-tête : format, grille, bateaux et taille annoncée
+    h = (const BookHeader *)bookData;
+    bookHeaderInit(&expected, config, h->count, (int)h->depth);
+    if (memcmp(h, &expected, sizeof(expected)) != 0
+        || bookSize < sizeof(BookHeader) + (size_t)h->count * (sizeof(uint64_t) + 1)) {
+        fprintf(stderr, "Bibliothèque d'ouvertures %s ignorée (format ou configuration différents)\n", path);
+        bookClose();
+        return 0;
+    }
+
+    bookKeys = (const uint64_t *)(bookData + sizeof(BookHeader));
+    bookMoves = (const uint8_t *)(bookKeys + h->count);
+
+    // Vérifie le contenu : clés strictement croissantes (recherche
+    // dichotomique) et tirs dans la grille (utilisés tels quels comme indices)
+    for (size_t i = 0; i < h->count; i++) {
+        if (bookMoves[i] >= GRID * GRID || (i > 0 && bookKeys[i - 1] >= bookKeys[i])) {
+            fprintf(stderr, "Bibliothèque d'ouvertures %s ignorée (entrée %zu invalide)\n", path, i);
+            bookClose();
+            return 0;
+        }
+    }
+    bookCount = h->count;
+    return bookCount;
+}
+
+// ============================================================================
+// FONCTION : bookLookup
+// DESCRIPTION : Recherche dichotomique dans les clés triées
+// ============================================================================
+int bookLookup(uint64_t key, int *outX, int *outY) {
+    size_t lo = 0, hi = bookCount;
+
+    if (bookCount == 0)
+        return 0;
+    atomic_fetch_add_explicit(&bookProbes, 1, memory_order_relaxed);
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (bookKeys[mid] < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == bookCount || bookKeys[lo] != key)
+        return 0;
+
+    atomic_fetch_add_explicit(&bookHits, 1, memory_order_relaxed);
+    *outX = bookMoves[lo] / GRID;
+    *outY = bookMoves[lo] % GRID;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : bookStats
+// DESCRIPTION : Lecture des compteurs de consultations
+// ============================================================================
+void bookStats(uint64_t *probes, uint64_t *hits) {
+    if (probes)
+        *probes = atomic_load(&bookProbes);
+    if (hits)
+        *hits = atomic_load(&bookHits);
+}
+
+// Comparaison des entrées par clé (pour qsort)
+static int compareEntries(const void *a, const void *b) {
+    uint64_t ka = ((const BookEntry *)a)->key;
+    uint64_t kb = ((const BookEntry *)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+// ============================================================================
+// FONCTION : bookWrite
+// DESCRIPTION : Trie, dédoublonne et écrit les entrées au format du fichier
+// ============================================================================
+size_t bookWrite(const char *path, BookEntry *entries, size_t count,
+                 const ShipConfig *config, int depth) {
+    BookHeader header;
+    size_t unique = 0;
+    FILE *f;
+
+    // Tri puis suppression des doublons (observations atteintes par
+    // plusieurs séquences : le tir est le même, l'IA étant déterministe)
+    qsort(entries, count, sizeof(BookEntry), compareEntries);
+    for (size_t i = 0; i < count; i++)
+        if (unique == 0 || entries[i].key != entries[unique - 1].key)
+            entries[unique++] = entries[i];
+
+    f = fopen(path, "wb");
+    if (!f)
+        return 0;
+
+    bookHeaderInit(&header, config, unique, depth);
+    int ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    for (size_t i = 0; ok && i < unique; i++)
+        ok = fwrite(&entries[i].key, sizeof(uint64_t), 1, f) == 1;
+    for (size_t i = 0; ok && i < unique; i++)
+        ok = fwrite(&entries[i].move, 1, 1, f) == 1;
+
+    if (fclose(f) != 0 || !ok)
+        return 0;
+    return unique;
+}
@@ -0,0 +1,22 @@
+// Active clock_gettime avec -std=c11 (fonction POSIX)
+#define _POSIX_C_SOURCE 200809L
+
+// Inclusion des bibliothèques nécessaires
+#include <time.h>       // Pour clock_gettime / timespec_get
+#include "chrono.h"     // Déclaration de l'horloge (prototype)
+
+// ============================================================================
+// FONCTION : chronoNowNs
+// DESCRIPTION : Horloge monotone en nanosecondes
+// NOTE : Sans horloge POSIX (Windows/MinGW), repli sur timespec_get (C11),
+//        qui n'est pas garantie monotone mais suffit pour des mesures courtes
+// ============================================================================
+uint64_t chronoNowNs(void) {
+    struct timespec ts;
+#if defined(CLOCK_MONOTONIC)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+    timespec_get(&ts, TIME_UTC);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
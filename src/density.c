@@ -0,0 +1,240 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdint.h>     // Types entiers de taille fixe (uint16_t, uint64_t)
+#include "types.h"      // Définitions des types personnalisés (GRID, ShipConfig)
+#include "density.h"    // Déclarations des noyaux de densité (prototypes)
+#include "kernels.h"    // Variantes SIMD liées par le dispatch
+
+// ==================== CONSTANTES DU NOYAU VECTORISÉ ====================
+
+// Nombre de mots de 64 bits pour représenter 16 lignes (14 utiles + 2 vides)
+#define SWAR_WORDS 4
+
+// Motif 0x0001 répété dans les 4 voies de 16 bits d'un mot
+#define LANE_ONES 0x0001000100010001ULL
+
+// Noyau sélectionné à l'exécution (meilleure variante SIMD par défaut)
+static DensityKernel currentKernel = DENSITY_SIMD;
+
+// ============================================================================
+// FONCTION : densitySetKernel / densityGetKernel / densityKernelName
+// DESCRIPTION : Sélection du noyau de calcul à l'exécution
+// ============================================================================
+void densitySetKernel(DensityKernel kernel) {
+    currentKernel = kernel;
+}
+
+DensityKernel densityGetKernel(void) {
+    return currentKernel;
+}
+
+const char *densityKernelName(DensityKernel kernel) {
+    switch (kernel) {
+        case DENSITY_SCALAR: return "scalar";
+        case DENSITY_SWAR:   return "swar";
+        case DENSITY_SIMD:   return "simd";
+        default:             return "unknown";
+    }
+}
+
+// ============================================================================
+// FONCTION : densityShipShape
+// DESCRIPTION : Calcule les dimensions d'un bateau selon sa taille et son orientation
+// PARAMÈTRES :
+//   - size     : taille du bateau (> 0 normal, < 0 bateau 5x2, 0 = ignoré)
+//   - vertical : orientation (1 = vertical, 0 = horizontal)
+//   - width    : largeur en sortie (colonnes)
+//   - height   : hauteur en sortie (lignes)
+// RETOUR : 1 si le bateau doit être compté, 0 sinon
+// ============================================================================
+int densityShipShape(int size, int vertical, int *width, int *height) {
+    if (size == 0)
+        return 0;  // Bateau absent (déjà coulé par exemple)
+
+    if (size > 0) {
+        // Bateau normal : une seule ligne ou une seule colonne
+        *width  = vertical ? 1 : size;
+        *height = vertical ? size : 1;
+    } else {
+        // Bateau spécial 5x2 (mêmes dimensions que canPlaceShip5x2Manual)
+        *width  = vertical ? 2 : 5;
+        *height = vertical ? 5 : 2;
+    }
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : densityMapScalar
+// DESCRIPTION : Implémentation de référence, case par case
+// ============================================================================
+void densityMapScalar(const uint16_t rows[GRID], const ShipConfig *config,
+                      int weights[GRID * GRID]) {
+    // Remise à zéro de la carte
+    for (int k = 0; k < GRID * GRID; k++)
+        weights[k] = 0;
+
+    // Pour chaque bateau et chaque orientation
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        for (int vertical = 0; vertical <= 1; vertical++) {
+            int width, height;
+            if (!densityShipShape(config->sizes[s], vertical, &width, &height))
+                continue;
+
+            // Parcourt toutes les positions de départ dans la grille
+            for (int x = 0; x + height <= GRID; x++) {
+                for (int y = 0; y + width <= GRID; y++) {
+                    // Vérifie que toutes les cases du bateau sont libres
+                    int fits = 1;
+                    for (int i = 0; i < height && fits; i++)
+                        for (int j = 0; j < width && fits; j++)
+                            if (!((rows[x + i] >> (y + j)) & 1))
+                                fits = 0;
+
+                    if (!fits)
+                        continue;
+
+                    // Placement possible : chaque case couverte gagne 1
+                    for (int i = 0; i < height; i++)
+                        for (int j = 0; j < width; j++)
+                            weights[(x + i) * GRID + (y + j)]++;
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// FONCTIONS INTERNES DU NOYAU VECTORISÉ (SWAR : SIMD dans un registre)
+// ============================================================================
+// Les 16 lignes sont rangées 4 par mot de 64 bits : la ligne x occupe la voie
+// (x % 4) du mot (x / 4). Un décalage de colonnes est un décalage de bits dans
+// chaque voie ; un décalage de lignes est un décalage de 16 bits entre voies.
+
+// Masque des bits qui restent dans leur voie après un décalage à droite de k
+static uint64_t laneMaskRight(int k) {
+    return LANE_ONES * (uint64_t)(0xFFFFu >> k);
+}
+
+// Masque des bits qui restent dans leur voie après un décalage à gauche de k
+static uint64_t laneMaskLeft(int k) {
+    return LANE_ONES * (uint64_t)((0xFFFFu << k) & 0xFFFFu);
+}
+
+// Ramène la ligne (x + k) dans la voie de la ligne x, pour le mot i
+static uint64_t rowsDown(const uint64_t w[SWAR_WORDS], int i, int k) {
+    int q = k / 4, r = k % 4;
+    uint64_t lo = (i + q < SWAR_WORDS) ? w[i + q] : 0;
+    uint64_t hi = (i + q + 1 < SWAR_WORDS) ? w[i + q + 1] : 0;
+
+    if (r == 0)
+        return lo;
+    return (lo >> (16 * r)) | (hi << (64 - 16 * r));
+}
+
+// Ramène la ligne (x - k) dans la voie de la ligne x, pour le mot i
+static uint64_t rowsUp(const uint64_t w[SWAR_WORDS], int i, int k) {
+    int q = k / 4, r = k % 4;
+    uint64_t lo = (i - q >= 0) ? w[i - q] : 0;
+    uint64_t prev = (i - q - 1 >= 0) ? w[i - q - 1] : 0;
+
+    if (r == 0)
+        return lo;
+    return (lo << (16 * r)) | (prev >> (64 - 16 * r));
+}
+
+// ============================================================================
+// FONCTION : densityMapSwar
+// DESCRIPTION : Implémentation vectorisée par fenêtres glissantes
+// ALGORITHME :
+//   1. starts = ET des masques décalés : bit (x, y) à 1 si le bateau posé
+//      en (x, y) ne couvre que des cases libres
+//   2. pour chaque case (dx, dy) du bateau, starts décalé de (dx, dy) donne
+//      les cases couvertes ; on l'ajoute aux compteurs en tranches de bits
+//      (addition avec retenue plan par plan, 64 cases à la fois)
+// ============================================================================
+void densityMapSwar(const uint16_t rows[GRID], const ShipConfig *config,
+                    int weights[GRID * GRID]) {
+    uint64_t freeRows[SWAR_WORDS] = {0};
+    uint64_t planes[DENSITY_PLANES][SWAR_WORDS] = {{0}};
+
+    // Regroupe les lignes 4 par 4 dans des mots de 64 bits
+    for (int x = 0; x < GRID; x++)
+        freeRows[x / 4] |= (uint64_t)(rows[x] & ROW_MASK) << (16 * (x % 4));
+
+    // Pour chaque bateau et chaque orientation
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        for (int vertical = 0; vertical <= 1; vertical++) {
+            int width, height;
+            if (!densityShipShape(config->sizes[s], vertical, &width, &height))
+                continue;
+
+            // ÉTAPE 1 : positions de départ valides (fenêtre glissante)
+            uint64_t starts[SWAR_WORDS];
+            for (int i = 0; i < SWAR_WORDS; i++) {
+                uint64_t acc = ~0ULL;
+                for (int dx = 0; dx < height; dx++) {
+                    uint64_t line = rowsDown(freeRows, i, dx);
+                    for (int dy = 0; dy < width; dy++)
+                        acc &= (line >> dy) & laneMaskRight(dy);
+                }
+                starts[i] = acc;
+            }
+
+            // ÉTAPE 2 : accumulation des cases couvertes
+            for (int dx = 0; dx < height; dx++) {
+                for (int dy = 0; dy < width; dy++) {
+                    uint64_t carry[SWAR_WORDS];
+                    for (int i = 0; i < SWAR_WORDS; i++)
+                        carry[i] = (rowsUp(starts, i, dx) << dy) & laneMaskLeft(dy);
+
+                    // Additionneur à propagation de retenue sur les plans de bits
+                    for (int p = 0; p < DENSITY_PLANES; p++) {
+                        for (int i = 0; i < SWAR_WORDS; i++) {
+                            uint64_t c = planes[p][i] & carry[i];
+                            planes[p][i] ^= carry[i];
+                            carry[i] = c;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Recompose les compteurs de chaque case à partir des plans de bits
+    for (int x = 0; x < GRID; x++) {
+        for (int y = 0; y < GRID; y++) {
+            int value = 0;
+            for (int p = 0; p < DENSITY_PLANES; p++)
+                value |= (int)((planes[p][x / 4] >> (16 * (x % 4) + y)) & 1) << p;
+            weights[x * GRID + y] = value;
+        }
+    }
+}
+
+// ============================================================================
+// FONCTION : densityUnpackPlanes
+// DESCRIPTION : Recompose les compteurs des unités SIMD (un masque par ligne et par plan)
+// ============================================================================
+void densityUnpackPlanes(const uint16_t planes[DENSITY_PLANES][16],
+                         int weights[GRID * GRID]) {
+    for (int x = 0; x < GRID; x++) {
+        for (int y = 0; y < GRID; y++) {
+            int value = 0;
+            for (int p = 0; p < DENSITY_PLANES; p++)
+                value |= ((planes[p][x] >> y) & 1) << p;
+            weights[x * GRID + y] = value;
+        }
+    }
+}
+
+// ============================================================================
+// FONCTION : densityMap
+// DESCRIPTION : Calcule la carte de densité avec le noyau sélectionné
+// ============================================================================
+void densityMap(const uint16_t rows[GRID], const ShipConfig *config,
+                int weights[GRID * GRID]) {
+    switch (currentKernel) {
+        case DENSITY_SCALAR: densityMapScalar(rows, config, weights); break;
+        case DENSITY_SWAR:   densityMapSwar(rows, config, weights);   break;
+        default:             kernels.densityMap(rows, config, weights); break;
+    }
+}
@@ -0,0 +1,184 @@
+// Inclusion des bibliothèques nécessaires
+#include <stddef.h>     // Pour NULL
+#include "engine.h"     // Déclarations du moteur (prototypes)
+#include "utils.h"      // isShipSunk, markShipSunk, allDestroyed
+#include "chrono.h"     // Horloge monotone par défaut
+
+// ============================================================================
+// FONCTION : engineInit
+// DESCRIPTION : Remet la partie au premier tour du joueur 1
+// ============================================================================
+void engineInit(Engine *e, Player *p1, Player *p2, EngineSeat s1, EngineSeat s2,
+                EngineClock clock) {
+    e->players[0] = p1;
+    e->players[1] = p2;
+    e->seats[0] = s1;
+    e->seats[1] = s2;
+    e->clock = clock;
+    e->current = 0;
+    e->winner = -1;
+    e->handover = s1 == ENGINE_HUMAN && s2 == ENGINE_HUMAN;
+    e->shotDelay = e->handover ? PVP_DELAY : TURN_DELAY;
+    e->shots[0] = e->shots[1] = 0;
+    e->phaseStart = clock.now(clock.ctx);
+
+    if (e->handover) e->phase = ENGINE_HANDOVER;      // Le joueur 1 confirme d'abord
+    else if (s1 == ENGINE_AI) e->phase = ENGINE_AI_TURN;
+    else e->phase = ENGINE_AIM;
+}
+
+// ============================================================================
+// FONCTION : enterPhase (interne)
+// DESCRIPTION : Change de phase et note l'instant du changement
+// ============================================================================
+static void enterPhase(Engine *e, EnginePhase phase) {
+    e->phase = phase;
+    e->phaseStart = e->clock.now(e->clock.ctx);
+}
+
+// ============================================================================
+// FONCTION : finishShot (interne)
+// DESCRIPTION : Après un tir du joueur courant : fin de partie si la flotte
+//               adverse est détruite, sinon passage de la main (tout de suite
+//               vers un humain sans écran de changement, après le délai sinon)
+// RETOUR : ENGINE_EVENT_OVER si la partie se termine, ENGINE_EVENT_NONE sinon
+// ============================================================================
+static EngineEvent finishShot(Engine *e) {
+    Player *current = engineCurrent(e);
+    Player *opponent = engineOpponent(e);
+    int next = 1 - e->current;
+
+    e->shots[e->current]++;
+    if (allDestroyed(opponent->grid)) {
+        current->score += 100;   // Bonus de victoire
+        opponent->score -= 50;   // Pénalité de défaite
+        e->winner = e->current;
+        enterPhase(e, ENGINE_OVER);
+        return ENGINE_EVENT_OVER;
+    }
+
+    if (e->seats[next] != ENGINE_AI && !e->handover) {
+        e->current = next;
+        enterPhase(e, ENGINE_AIM);
+    } else {
+        enterPhase(e, ENGINE_SHOT_DELAY);
+    }
+    return ENGINE_EVENT_NONE;
+}
+
+// ============================================================================
+// FONCTION : resolveShot (interne)
+// DESCRIPTION : Tir humain : marque la case et compte les points
+// ============================================================================
+static EngineEvent resolveShot(Engine *e, int x, int y) {
+    if (e->phase != ENGINE_AIM || x < 0 || x >= GRID || y < 0 || y >= GRID)
+        return ENGINE_EVENT_IGNORED;
+
+    Player *current = engineCurrent(e);
+    Player *target = engineOpponent(e);
+    EngineEvent result;
+
+    if (target->grid[x][y] == 0) {
+        target->grid[x][y] = -99;   // Tir dans l'eau
+        current->score -= 1;
+        result = ENGINE_EVENT_MISS;
+    } else if (target->grid[x][y] > 0) {
+        int shipId = target->grid[x][y];
+        target->grid[x][y] = -shipId;   // Bateau touché
+        current->score += 10;
+        target->score -= 5;
+        result = ENGINE_EVENT_HIT;
+        if (isShipSunk(target->grid, shipId)) {
+            markShipSunk(target->grid, shipId);
+            current->score += 20;
+            target->score -= 10;
+            result = ENGINE_EVENT_SUNK;
+        }
+    } else {
+        return ENGINE_EVENT_IGNORED;  // Case déjà visée
+    }
+
+    return finishShot(e) == ENGINE_EVENT_OVER ? ENGINE_EVENT_OVER : result;
+}
+
+// ============================================================================
+// FONCTION : engineStep
+// DESCRIPTION : Entrée d'abord, puis fin de délai éventuelle
+// ============================================================================
+EngineEvent engineStep(Engine *e, EngineInput input) {
+    EngineEvent event = ENGINE_EVENT_NONE;
+
+    if (e->phase == ENGINE_OVER)
+        return input.type == ENGINE_INPUT_NONE ? ENGINE_EVENT_NONE : ENGINE_EVENT_IGNORED;
+
+    switch (input.type) {
+    case ENGINE_INPUT_SHOT:
+        if (e->seats[e->current] == ENGINE_AI)
+            return ENGINE_EVENT_IGNORED;
+        event = resolveShot(e, input.x, input.y);
+        break;
+    case ENGINE_INPUT_CONFIRM:
+        if (e->phase != ENGINE_HANDOVER)
+            return ENGINE_EVENT_IGNORED;
+        enterPhase(e, ENGINE_AIM);
+        event = ENGINE_EVENT_PHASE;
+        break;
+    case ENGINE_INPUT_AI_DONE:
+        if (e->phase != ENGINE_AI_TURN)
+            return ENGINE_EVENT_IGNORED;
+        event = finishShot(e) == ENGINE_EVENT_OVER ? ENGINE_EVENT_OVER : ENGINE_EVENT_PHASE;
+        break;
+    case ENGINE_INPUT_QUIT:
+        e->winner = -1;
+        enterPhase(e, ENGINE_OVER);
+        return ENGINE_EVENT_OVER;
+    case ENGINE_INPUT_NONE:
+        break;
+    }
+
+    // Fin du délai après un tir : la main passe au joueur suivant
+    if (e->phase == ENGINE_SHOT_DELAY
+        && e->clock.now(e->clock.ctx) - e->phaseStart >= e->shotDelay) {
+        e->current = 1 - e->current;
+        if (e->handover) enterPhase(e, ENGINE_HANDOVER);
+        else if (e->seats[e->current] == ENGINE_AI) enterPhase(e, ENGINE_AI_TURN);
+        else enterPhase(e, ENGINE_AIM);
+        if (event == ENGINE_EVENT_NONE)
+            event = ENGINE_EVENT_PHASE;
+    }
+    return event;
+}
+
+// ============================================================================
+// FONCTION : engineWakeTime
+// DESCRIPTION : Seul le délai après un tir se termine sans entrée
+// ============================================================================
+uint64_t engineWakeTime(const Engine *e) {
+    return e->phase == ENGINE_SHOT_DELAY ? e->phaseStart + e->shotDelay : 0;
+}
+
+// ============================================================================
+// FONCTIONS : engineCurrent / engineOpponent
+// DESCRIPTION : Joueur qui tire et joueur visé
+// ============================================================================
+Player *engineCurrent(const Engine *e) {
+    return e->players[e->current];
+}
+
+Player *engineOpponent(const Engine *e) {
+    return e->players[1 - e->current];
+}
+
+// ============================================================================
+// FONCTION : engineMonotonicClock
+// DESCRIPTION : Horloge de chrono.h ramenée en millisecondes
+// ============================================================================
+static uint64_t monotonicNow(void *ctx) {
+    (void)ctx;
+    return chronoNowNs() / 1000000;
+}
+
+EngineClock engineMonotonicClock(void) {
+    EngineClock clock = {monotonicNow, NULL};
+    return clock;
+}
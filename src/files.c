@@ -1,6 +1,6 @@
 // Inclusion des bibliothèques nécessaires
-#include <SDL3/SDL.h>   // Bibliothèque graphique SDL3 (peut-être utilisé pour l'affichage des scores)
 #include <stdio.h>      // Bibliothèque standard d'entrée/sortie (fopen, fprintf, fscanf, etc.)
+#include <string.h>     // Pour strlen, strncmp, strcpy
 #include "types.h"      // Définitions des types personnalisés (Score, ScoreMode, etc.)
 #include "files.h"      // Déclarations des fonctions de gestion de fichiers (prototypes)
 
@@ -18,6 +18,8 @@ const char *getScoreTag(ScoreMode mode) {
         case SCORE_MEDIUM: return "[MEDIUM]";  // Mode moyen contre IA
         case SCORE_HARD:   return "[HARD]";    // Mode difficile contre IA
         case SCORE_PVP:    return "[PVP]";        // Mode joueur contre joueur
+        case SCORE_EXPERT: return "[EXPERT]";     // Mode expert contre IA
+        case SCORE_INFO:   return "[INFO]";       // Mode info contre IA
         default:           return "[UNKNOWN]";    // Mode non reconnu (valeur par défaut)
     }
 }
@@ -175,13 +177,19 @@ void sortScores(Score scores[], int count) {
 //   - nh       : nombre de scores en mode difficile
 //   - pvp[]    : tableau des scores en mode PVP
 //   - np       : nombre de scores en mode PVP
+//   - expert[] : tableau des scores en mode expert
+//   - nx       : nombre de scores en mode expert
+//   - info[]   : tableau des scores en mode info
+//   - ni       : nombre de scores en mode info
 // RETOUR : aucun (void)
 // ============================================================================
 void writeAllScores(const char *filename,
                     Score easy[], int ne,
                     Score medium[], int nm,
                     Score hard[], int nh,
-                    Score pvp[], int np) {
+                    Score pvp[], int np,
+                    Score expert[], int nx,
+                    Score info[], int ni) {
 
     // Ouvre le fichier en mode "write" (écriture, écrase le contenu existant)
     FILE *f = fopen(filename, "w");
@@ -209,6 +217,16 @@ void writeAllScores(const char *filename,
     for (int i = 0; i < np; i++)
         fprintf(f, "%s %d\n", pvp[i].name, pvp[i].score);
 
+    // Ligne vide pour séparer les sections
+    fprintf(f, "\n[EXPERT]\n");
+    for (int i = 0; i < nx; i++)
+        fprintf(f, "%s %d\n", expert[i].name, expert[i].score);
+
+    // Ligne vide pour séparer les sections
+    fprintf(f, "\n[INFO]\n");
+    for (int i = 0; i < ni; i++)
+        fprintf(f, "%s %d\n", info[i].name, info[i].score);
+
     // Ferme le fichier
     fclose(f);
 }
@@ -233,12 +251,15 @@ void updateTopScoresOneFile(const char *filename,
     // +1 pour pouvoir ajouter le nouveau score avant de trier
     Score easy[MAX_SCORES + 1], medium[MAX_SCORES + 1];
     Score hard[MAX_SCORES + 1], pvp[MAX_SCORES + 1];
+    Score expert[MAX_SCORES + 1], info[MAX_SCORES + 1];
 
     // Charge les scores existants pour chaque catégorie
     int ne = loadScoresSection(filename, SCORE_EASY, easy);    // Scores facile
     int nm = loadScoresSection(filename, SCORE_MEDIUM, medium); // Scores moyen
     int nh = loadScoresSection(filename, SCORE_HARD, hard);    // Scores difficile
     int np = loadScoresSection(filename, SCORE_PVP, pvp);      // Scores PVP
+    int nx = loadScoresSection(filename, SCORE_EXPERT, expert); // Scores expert
+    int ni = loadScoresSection(filename, SCORE_INFO, info);    // Scores info
 
     // Pointeurs vers le tableau et compteur appropriés selon le mode
     Score *current;  // Pointeur vers le tableau de la bonne catégorie
@@ -250,6 +271,8 @@ void updateTopScoresOneFile(const char *filename,
         case SCORE_MEDIUM: current = medium; count = &nm; break;   // Mode moyen
         case SCORE_HARD:   current = hard;   count = &nh; break;   // Mode difficile
         case SCORE_PVP:    current = pvp;    count = &np; break;   // Mode PVP
+        case SCORE_EXPERT: current = expert; count = &nx; break;   // Mode expert
+        case SCORE_INFO:   current = info;   count = &ni; break;   // Mode info
         default: return;  // Mode non reconnu, quitte la fonction
     }
 
@@ -265,7 +288,7 @@ void updateTopScoresOneFile(const char *filename,
     if (*count > MAX_SCORES) *count = MAX_SCORES;
 
     // Réécrit tout le fichier avec les scores mis à jour
-    writeAllScores(filename, easy, ne, medium, nm, hard, nh, pvp, np);
+    writeAllScores(filename, easy, ne, medium, nm, hard, nh, pvp, np, expert, nx, info, ni);
 }
 
 // ============================================================================
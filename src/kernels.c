@@ -0,0 +1,131 @@
+// Inclusion des bibliothèques nécessaires
+#include <string.h>     // Pour strcmp
+#include "types.h"      // Définitions des types personnalisés (GRID, seed)
+#include "random.h"     // Générateur myRand (variante générique de randFill)
+#include "density.h"    // Noyau de densité générique (densityMapSwar)
+#include "kernels.h"    // Déclarations du dispatch (prototypes)
+
+// Table des noyaux : variantes génériques tant que dispatchInit n'a pas été appelé
+Kernels kernels = {
+    .gridRowMask = gridRowMaskGeneric,
+    .densityMap  = densityMapSwar,
+    .randFill    = randFillGeneric
+};
+
+// Niveau lié par le dernier appel à dispatchInit
+static CpuLevel boundLevel = CPU_GENERIC;
+
+// ============================================================================
+// FONCTION : gridRowMaskGeneric
+// DESCRIPTION : Masque des cases dont la valeur est dans [lo, hi] (code portable)
+// ============================================================================
+void gridRowMaskGeneric(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    for (int x = 0; x < GRID; x++) {
+        uint16_t mask = 0;
+        for (int y = 0; y < GRID; y++)
+            if (g[x][y] >= lo && g[x][y] <= hi)
+                mask |= (uint16_t)(1u << y);
+        rows[x] = mask;
+    }
+}
+
+// ============================================================================
+// FONCTION : randFillGeneric
+// DESCRIPTION : Remplit un tableau avec les prochaines valeurs de myRand()
+// ============================================================================
+void randFillGeneric(int *out, int count) {
+    for (int i = 0; i < count; i++)
+        out[i] = myRand();
+}
+
+// ============================================================================
+// FONCTION : cpuDetect
+// DESCRIPTION : Détecte le meilleur niveau d'extensions utilisable
+// NOTE : __builtin_cpu_supports vérifie aussi que le système sauvegarde les
+//        registres étendus (XGETBV), ce qui évite de planter sur un noyau ancien
+// ============================================================================
+CpuLevel cpuDetect(void) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+        && __builtin_cpu_supports("avx512vl"))
+        return CPU_AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return CPU_AVX2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return CPU_SSE42;
+#endif
+    return CPU_GENERIC;  // Architecture non x86 ou compilateur sans détection
+}
+
+// ============================================================================
+// FONCTION : cpuLevelName / cpuLevelFromName
+// DESCRIPTION : Conversion entre niveaux et noms lisibles
+// ============================================================================
+const char *cpuLevelName(CpuLevel level) {
+    switch (level) {
+        case CPU_GENERIC: return "generic";
+        case CPU_SSE42:   return "sse4.2";
+        case CPU_AVX2:    return "avx2";
+        case CPU_AVX512:  return "avx512";
+        default:          return "unknown";
+    }
+}
+
+int cpuLevelFromName(const char *name, CpuLevel *level) {
+    for (int l = CPU_GENERIC; l <= CPU_AVX512; l++) {
+        if (strcmp(name, cpuLevelName((CpuLevel)l)) == 0) {
+            *level = (CpuLevel)l;
+            return 1;
+        }
+    }
+    return 0;  // Nom inconnu
+}
+
+// ============================================================================
+// FONCTION : dispatchInit
+// DESCRIPTION : Lie la table des noyaux au meilleur niveau disponible
+// PARAMÈTRES :
+//   - maxLevel : plafond demandé (permet de forcer une variante plus ancienne)
+// RETOUR : niveau effectivement retenu
+// ============================================================================
+CpuLevel dispatchInit(CpuLevel maxLevel) {
+    CpuLevel level = cpuDetect();
+    if (level > maxLevel)
+        level = maxLevel;
+
+    switch (level) {
+        case CPU_AVX512:
+            kernels.gridRowMask = gridRowMaskAvx512;
+            kernels.densityMap  = densityMapAvx512;
+            kernels.randFill    = randFillAvx512;
+            break;
+        case CPU_AVX2:
+            kernels.gridRowMask = gridRowMaskAvx2;
+            kernels.densityMap  = densityMapAvx2;
+            kernels.randFill    = randFillAvx2;
+            break;
+        case CPU_SSE42:
+            kernels.gridRowMask = gridRowMaskSse42;
+            kernels.densityMap  = densityMapSse42;
+            kernels.randFill    = randFillSse42;
+            break;
+        default:
+            kernels.gridRowMask = gridRowMaskGeneric;
+            kernels.densityMap  = densityMapSwar;
+            kernels.randFill    = randFillGeneric;
+            break;
+    }
+
+    boundLevel = level;
+    return level;
+}
+
+// ============================================================================
+// FONCTION : dispatchLevel
+// DESCRIPTION : Retourne le niveau actuellement lié
+// ============================================================================
+CpuLevel dispatchLevel(void) {
+    return boundLevel;
+}
@@ -0,0 +1,140 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdint.h>     // Types entiers de taille fixe
+#include "types.h"      // Définitions des types personnalisés (GRID, seed)
+#include "density.h"    // Contrat des noyaux de densité
+#include "kernels.h"    // Déclarations des variantes (prototypes)
+
+// ============================================================================
+// UNITÉ AVX2 : compilée avec -mavx2 (voir Makefile)
+// Sur une architecture sans AVX2, les fonctions redirigent vers le code
+// générique ; le dispatch ne les choisit de toute façon pas.
+// ============================================================================
+#if defined(__AVX2__)
+
+#include <immintrin.h>  // Intrinsèques AVX2
+
+// ============================================================================
+// FONCTION : gridRowMaskAvx2
+// DESCRIPTION : Compare 8 cases à la fois ; une ligne de 14 cases est lue en
+//               deux blocs qui se chevauchent (0-7 et 6-13)
+// ============================================================================
+void gridRowMaskAvx2(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    const __m256i vlo = _mm256_set1_epi32(lo);
+    const __m256i vhi = _mm256_set1_epi32(hi);
+
+    for (int x = 0; x < GRID; x++) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)&g[x][0]);
+        __m256i b = _mm256_loadu_si256((const __m256i *)&g[x][GRID - 8]);
+        // Hors intervalle si v < lo ou v > hi
+        __m256i outA = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, a), _mm256_cmpgt_epi32(a, vhi));
+        __m256i outB = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, b), _mm256_cmpgt_epi32(b, vhi));
+        unsigned bitsA = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(outA)) & 0xFFu;
+        unsigned bitsB = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(outB)) & 0xFFu;
+        rows[x] = (uint16_t)((bitsA | (bitsB << (GRID - 8))) & ROW_MASK);
+    }
+}
+
+// ============================================================================
+// FONCTION : densityMapAvx2
+// DESCRIPTION : Fenêtres glissantes sur les 16 lignes d'un seul registre
+//               Les décalages de lignes sont des lectures non alignées dans
+//               des tampons bordés de zéros
+// ============================================================================
+void densityMapAvx2(const uint16_t rows[GRID], const ShipConfig *config,
+                    int weights[GRID * GRID]) {
+    uint16_t freeBuf[48] = {0};    // Lignes libres aux indices 16 à 31
+    uint16_t startBuf[48] = {0};   // Positions de départ aux indices 16 à 31
+    uint16_t planeBuf[DENSITY_PLANES][16];
+    __m256i planes[DENSITY_PLANES];
+
+    for (int x = 0; x < GRID; x++)
+        freeBuf[16 + x] = rows[x] & ROW_MASK;
+    for (int p = 0; p < DENSITY_PLANES; p++)
+        planes[p] = _mm256_setzero_si256();
+
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        for (int vertical = 0; vertical <= 1; vertical++) {
+            int width, height;
+            if (!densityShipShape(config->sizes[s], vertical, &width, &height))
+                continue;
+
+            // ÉTAPE 1 : positions de départ valides
+            __m256i acc = _mm256_set1_epi32(-1);
+            for (int dx = 0; dx < height; dx++) {
+                __m256i line = _mm256_loadu_si256((const __m256i *)&freeBuf[16 + dx]);
+                for (int dy = 0; dy < width; dy++)
+                    acc = _mm256_and_si256(acc, _mm256_srl_epi16(line, _mm_cvtsi32_si128(dy)));
+            }
+            _mm256_storeu_si256((__m256i *)&startBuf[16], acc);
+
+            // ÉTAPE 2 : accumulation des cases couvertes
+            for (int dx = 0; dx < height; dx++) {
+                __m256i shifted = _mm256_loadu_si256((const __m256i *)&startBuf[16 - dx]);
+                for (int dy = 0; dy < width; dy++) {
+                    __m256i carry = _mm256_sll_epi16(shifted, _mm_cvtsi32_si128(dy));
+                    for (int p = 0; p < DENSITY_PLANES && !_mm256_testz_si256(carry, carry); p++) {
+                        __m256i c = _mm256_and_si256(planes[p], carry);
+                        planes[p] = _mm256_xor_si256(planes[p], carry);
+                        carry = c;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int p = 0; p < DENSITY_PLANES; p++)
+        _mm256_storeu_si256((__m256i *)planeBuf[p], planes[p]);
+    densityUnpackPlanes((const uint16_t (*)[16])planeBuf, weights);
+}
+
+// ============================================================================
+// FONCTION : randFillAvx2
+// DESCRIPTION : LCG sur 8 voies : chaque voie avance de 8 pas à la fois
+//               (graine <- A8 * graine + C8), ce qui reproduit la suite de myRand()
+// ============================================================================
+void randFillAvx2(int *out, int count) {
+    uint32_t lanes[8], a8 = 1, c8 = 0, s = seed;
+    int i = 0;
+
+    // Constantes de saut de 8 pas et états initiaux des voies
+    for (int l = 0; l < 8; l++) {
+        s = s * 1103515245u + 12345u;
+        lanes[l] = s;
+        c8 = c8 * 1103515245u + 12345u;
+        a8 *= 1103515245u;
+    }
+
+    __m256i state = _mm256_loadu_si256((const __m256i *)lanes);
+    const __m256i va = _mm256_set1_epi32((int)a8);
+    const __m256i vc = _mm256_set1_epi32((int)c8);
+    const __m256i low15 = _mm256_set1_epi32(0x7FFF);
+    __m256i last = state;
+
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i *)&out[i], _mm256_and_si256(_mm256_srli_epi32(state, 16), low15));
+        last = state;
+        state = _mm256_add_epi32(_mm256_mullo_epi32(state, va), vc);
+    }
+
+    // La graine globale reprend à la dernière valeur produite
+    if (i > 0)
+        seed = (uint32_t)_mm256_extract_epi32(last, 7);
+    randFillGeneric(out + i, count - i);
+}
+
+#else  // Pas d'AVX2 : redirection vers le code générique
+
+void gridRowMaskAvx2(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    gridRowMaskGeneric(g, lo, hi, rows);
+}
+
+void densityMapAvx2(const uint16_t rows[GRID], const ShipConfig *config,
+                    int weights[GRID * GRID]) {
+    densityMapSwar(rows, config, weights);
+}
+
+void randFillAvx2(int *out, int count) {
+    randFillGeneric(out, count);
+}
+
+#endif
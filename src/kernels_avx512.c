@@ -0,0 +1,138 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdint.h>     // Types entiers de taille fixe
+#include "types.h"      // Définitions des types personnalisés (GRID, seed)
+#include "density.h"    // Contrat des noyaux de densité
+#include "kernels.h"    // Déclarations des variantes (prototypes)
+
+// ============================================================================
+// UNITÉ AVX-512 : compilée avec -mavx512f -mavx512bw -mavx512vl (voir Makefile)
+// Sur une architecture sans AVX-512, les fonctions redirigent vers le code
+// générique ; le dispatch ne les choisit de toute façon pas.
+// ============================================================================
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+
+#include <immintrin.h>  // Intrinsèques AVX-512
+
+// ============================================================================
+// FONCTION : gridRowMaskAvx512
+// DESCRIPTION : Une ligne entière (14 cases) tient dans un registre de 512 bits ;
+//               la lecture masquée ignore les 2 voies en trop et les comparaisons
+//               produisent directement le masque de 16 bits
+// ============================================================================
+void gridRowMaskAvx512(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    const __m512i vlo = _mm512_set1_epi32(lo);
+    const __m512i vhi = _mm512_set1_epi32(hi);
+
+    for (int x = 0; x < GRID; x++) {
+        __m512i v = _mm512_maskz_loadu_epi32((__mmask16)ROW_MASK, &g[x][0]);
+        __mmask16 ge = _mm512_mask_cmpge_epi32_mask((__mmask16)ROW_MASK, v, vlo);
+        rows[x] = (uint16_t)_mm512_mask_cmple_epi32_mask(ge, v, vhi);
+    }
+}
+
+// ============================================================================
+// FONCTION : densityMapAvx512
+// DESCRIPTION : Même algorithme que densityMapAvx2 (16 lignes de 16 bits = 256
+//               bits) ; les encodages EVEX permettent au compilateur de fusionner
+//               les ET/OU-exclusifs de l'additionneur (vpternlog)
+// ============================================================================
+void densityMapAvx512(const uint16_t rows[GRID], const ShipConfig *config,
+                      int weights[GRID * GRID]) {
+    uint16_t freeBuf[48] = {0};    // Lignes libres aux indices 16 à 31
+    uint16_t startBuf[48] = {0};   // Positions de départ aux indices 16 à 31
+    uint16_t planeBuf[DENSITY_PLANES][16];
+    __m256i planes[DENSITY_PLANES];
+
+    for (int x = 0; x < GRID; x++)
+        freeBuf[16 + x] = rows[x] & ROW_MASK;
+    for (int p = 0; p < DENSITY_PLANES; p++)
+        planes[p] = _mm256_setzero_si256();
+
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        for (int vertical = 0; vertical <= 1; vertical++) {
+            int width, height;
+            if (!densityShipShape(config->sizes[s], vertical, &width, &height))
+                continue;
+
+            // ÉTAPE 1 : positions de départ valides
+            __m256i acc = _mm256_set1_epi32(-1);
+            for (int dx = 0; dx < height; dx++) {
+                __m256i line = _mm256_loadu_si256((const __m256i *)&freeBuf[16 + dx]);
+                for (int dy = 0; dy < width; dy++)
+                    acc = _mm256_and_si256(acc, _mm256_srl_epi16(line, _mm_cvtsi32_si128(dy)));
+            }
+            _mm256_storeu_si256((__m256i *)&startBuf[16], acc);
+
+            // ÉTAPE 2 : accumulation des cases couvertes
+            for (int dx = 0; dx < height; dx++) {
+                __m256i shifted = _mm256_loadu_si256((const __m256i *)&startBuf[16 - dx]);
+                for (int dy = 0; dy < width; dy++) {
+                    __m256i carry = _mm256_sll_epi16(shifted, _mm_cvtsi32_si128(dy));
+                    for (int p = 0; p < DENSITY_PLANES && !_mm256_testz_si256(carry, carry); p++) {
+                        __m256i c = _mm256_and_si256(planes[p], carry);
+                        planes[p] = _mm256_xor_si256(planes[p], carry);
+                        carry = c;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int p = 0; p < DENSITY_PLANES; p++)
+        _mm256_storeu_si256((__m256i *)planeBuf[p], planes[p]);
+    densityUnpackPlanes((const uint16_t (*)[16])planeBuf, weights);
+}
+
+// ============================================================================
+// FONCTION : randFillAvx512
+// DESCRIPTION : LCG sur 16 voies : chaque voie avance de 16 pas à la fois
+//               (graine <- A16 * graine + C16), ce qui reproduit la suite de myRand()
+// ============================================================================
+void randFillAvx512(int *out, int count) {
+    uint32_t lanes[16], a16 = 1, c16 = 0, s = seed;
+    int i = 0;
+
+    // Constantes de saut de 16 pas et états initiaux des voies
+    for (int l = 0; l < 16; l++) {
+        s = s * 1103515245u + 12345u;
+        lanes[l] = s;
+        c16 = c16 * 1103515245u + 12345u;
+        a16 *= 1103515245u;
+    }
+
+    __m512i state = _mm512_loadu_si512(lanes);
+    const __m512i va = _mm512_set1_epi32((int)a16);
+    const __m512i vc = _mm512_set1_epi32((int)c16);
+    const __m512i low15 = _mm512_set1_epi32(0x7FFF);
+    __m512i last = state;
+
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_si512(&out[i], _mm512_and_si512(_mm512_srli_epi32(state, 16), low15));
+        last = state;
+        state = _mm512_add_epi32(_mm512_mullo_epi32(state, va), vc);
+    }
+
+    // La graine globale reprend à la dernière valeur produite
+    if (i > 0) {
+        _mm512_storeu_si512(lanes, last);
+        seed = lanes[15];
+    }
+    randFillGeneric(out + i, count - i);
+}
+
+#else  // Pas d'AVX-512 : redirection vers le code générique
+
+void gridRowMaskAvx512(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    gridRowMaskGeneric(g, lo, hi, rows);
+}
+
+void densityMapAvx512(const uint16_t rows[GRID], const ShipConfig *config,
+                      int weights[GRID * GRID]) {
+    densityMapSwar(rows, config, weights);
+}
+
+void randFillAvx512(int *out, int count) {
+    randFillGeneric(out, count);
+}
+
+#endif
@@ -0,0 +1,149 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdint.h>     // Types entiers de taille fixe
+#include "types.h"      // Définitions des types personnalisés (GRID, seed)
+#include "density.h"    // Contrat des noyaux de densité
+#include "kernels.h"    // Déclarations des variantes (prototypes)
+
+// ============================================================================
+// UNITÉ SSE4.2 : compilée avec -msse4.2 (voir Makefile)
+// Sur une architecture sans SSE4.2, les fonctions redirigent vers le code
+// générique ; le dispatch ne les choisit de toute façon pas.
+// ============================================================================
+#if defined(__SSE4_2__)
+
+#include <nmmintrin.h>  // Intrinsèques SSE4.2
+
+// ============================================================================
+// FONCTION : gridRowMaskSse42
+// DESCRIPTION : Compare 4 cases à la fois ; une ligne de 14 cases est lue en
+//               quatre blocs (0-3, 4-7, 8-11 et 10-13, qui se chevauchent)
+// ============================================================================
+void gridRowMaskSse42(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    const __m128i vlo = _mm_set1_epi32(lo);
+    const __m128i vhi = _mm_set1_epi32(hi);
+    static const int offsets[4] = {0, 4, 8, GRID - 4};
+
+    for (int x = 0; x < GRID; x++) {
+        unsigned mask = 0;
+        for (int k = 0; k < 4; k++) {
+            __m128i v = _mm_loadu_si128((const __m128i *)&g[x][offsets[k]]);
+            // Hors intervalle si v < lo ou v > hi
+            __m128i out = _mm_or_si128(_mm_cmpgt_epi32(vlo, v), _mm_cmpgt_epi32(v, vhi));
+            unsigned bits = ~(unsigned)_mm_movemask_ps(_mm_castsi128_ps(out)) & 0xFu;
+            mask |= bits << offsets[k];
+        }
+        rows[x] = (uint16_t)(mask & ROW_MASK);
+    }
+}
+
+// ============================================================================
+// FONCTION : densityMapSse42
+// DESCRIPTION : Fenêtres glissantes sur 8 lignes par registre (2 registres)
+//               Les décalages de lignes sont des lectures non alignées dans
+//               des tampons bordés de zéros
+// ============================================================================
+void densityMapSse42(const uint16_t rows[GRID], const ShipConfig *config,
+                     int weights[GRID * GRID]) {
+    uint16_t freeBuf[48] = {0};    // Lignes libres aux indices 16 à 31
+    uint16_t startBuf[48] = {0};   // Positions de départ aux indices 16 à 31
+    uint16_t planeBuf[DENSITY_PLANES][16];
+    __m128i planes[DENSITY_PLANES][2];
+
+    for (int x = 0; x < GRID; x++)
+        freeBuf[16 + x] = rows[x] & ROW_MASK;
+    for (int p = 0; p < DENSITY_PLANES; p++)
+        planes[p][0] = planes[p][1] = _mm_setzero_si128();
+
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        for (int vertical = 0; vertical <= 1; vertical++) {
+            int width, height;
+            if (!densityShipShape(config->sizes[s], vertical, &width, &height))
+                continue;
+
+            // ÉTAPE 1 : positions de départ valides
+            for (int h = 0; h < 2; h++) {
+                __m128i acc = _mm_set1_epi32(-1);
+                for (int dx = 0; dx < height; dx++) {
+                    __m128i line = _mm_loadu_si128((const __m128i *)&freeBuf[16 + 8 * h + dx]);
+                    for (int dy = 0; dy < width; dy++)
+                        acc = _mm_and_si128(acc, _mm_srl_epi16(line, _mm_cvtsi32_si128(dy)));
+                }
+                _mm_storeu_si128((__m128i *)&startBuf[16 + 8 * h], acc);
+            }
+
+            // ÉTAPE 2 : accumulation des cases couvertes
+            for (int dx = 0; dx < height; dx++) {
+                for (int dy = 0; dy < width; dy++) {
+                    for (int h = 0; h < 2; h++) {
+                        __m128i carry = _mm_sll_epi16(
+                            _mm_loadu_si128((const __m128i *)&startBuf[16 + 8 * h - dx]),
+                            _mm_cvtsi32_si128(dy));
+                        for (int p = 0; p < DENSITY_PLANES && !_mm_testz_si128(carry, carry); p++) {
+                            __m128i c = _mm_and_si128(planes[p][h], carry);
+                            planes[p][h] = _mm_xor_si128(planes[p][h], carry);
+                            carry = c;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (int p = 0; p < DENSITY_PLANES; p++) {
+        _mm_storeu_si128((__m128i *)&planeBuf[p][0], planes[p][0]);
+        _mm_storeu_si128((__m128i *)&planeBuf[p][8], planes[p][1]);
+    }
+    densityUnpackPlanes((const uint16_t (*)[16])planeBuf, weights);
+}
+
+// ============================================================================
+// FONCTION : randFillSse42
+// DESCRIPTION : LCG sur 4 voies : chaque voie avance de 4 pas à la fois
+//               (graine <- A4 * graine + C4), ce qui reproduit la suite de myRand()
+// ============================================================================
+void randFillSse42(int *out, int count) {
+    uint32_t lanes[4], a4 = 1, c4 = 0, s = seed;
+    int i = 0;
+
+    // Constantes de saut de 4 pas et états initiaux des voies
+    for (int l = 0; l < 4; l++) {
+        s = s * 1103515245u + 12345u;
+        lanes[l] = s;
+        c4 = c4 * 1103515245u + 12345u;
+        a4 *= 1103515245u;
+    }
+
+    __m128i state = _mm_loadu_si128((const __m128i *)lanes);
+    const __m128i va = _mm_set1_epi32((int)a4);
+    const __m128i vc = _mm_set1_epi32((int)c4);
+    const __m128i low15 = _mm_set1_epi32(0x7FFF);
+    __m128i last = state;
+
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i *)&out[i], _mm_and_si128(_mm_srli_epi32(state, 16), low15));
+        last = state;
+        state = _mm_add_epi32(_mm_mullo_epi32(state, va), vc);
+    }
+
+    // La graine globale reprend à la dernière valeur produite
+    if (i > 0)
+        seed = (uint32_t)_mm_extract_epi32(last, 3);
+    randFillGeneric(out + i, count - i);
+}
+
+#else  // Pas de SSE4.2 : redirection vers le code générique
+
+void gridRowMaskSse42(int g[GRID][GRID], int lo, int hi, uint16_t rows[GRID]) {
+    gridRowMaskGeneric(g, lo, hi, rows);
+}
+
+void densityMapSse42(const uint16_t rows[GRID], const ShipConfig *config,
+                     int weights[GRID * GRID]) {
+    densityMapSwar(rows, config, weights);
+}
+
+void randFillSse42(int *out, int count) {
+    randFillGeneric(out, count);
+}
+
+#endif
@@ -0,0 +1,429 @@
+// Inclusion des bibliothèques nécessaires
+#include <string.h>     // Pour memcpy, memcmp, memset
+#include "lockstep.h"   // Déclarations du mode lockstep (prototypes)
+#include "engine.h"     // Moteur, pour rejouer la partie
+#include "utils.h"      // isShipSunk, markShipSunk, allDestroyed
+#include "zobrist.h"    // Clés de Zobrist (états OBS_*)
+
+// Taille des charges par type (octet de type non compris)
+static const uint16_t payloadSize[LS_TYPES] = {
+    [LS_COMMIT] = 1 + 2 * SHA256_SIZE,
+    [LS_MOVE] = 3,
+    [LS_REVEAL] = LOCKSTEP_SALT + 3 * SHIP_COUNT + 8,
+    [LS_COIN] = LOCKSTEP_NONCE,
+};
+
+// ============================================================================
+// FONCTION : lockstepSize
+// DESCRIPTION : Taille totale d'un message selon son type
+// ============================================================================
+size_t lockstepSize(int type) {
+    if (type < LS_COMMIT || type >= LS_TYPES)
+        return 0;
+    return 1 + (size_t)payloadSize[type];
+}
+
+// ============================================================================
+// FONCTION : lockstepEncode
+// DESCRIPTION : Type puis charge ; le hachage de REVEAL est petit-boutiste
+// ============================================================================
+size_t lockstepEncode(const LockstepMsg *msg, uint8_t *buf, size_t cap) {
+    size_t size = lockstepSize(msg->type);
+
+    if (size == 0 || size > cap)
+        return 0;
+
+    buf[0] = (uint8_t)msg->type;
+    switch (msg->type) {
+    case LS_COMMIT:
+        buf[1] = msg->u.commit.version;
+        memcpy(buf + 2, msg->u.commit.digest, SHA256_SIZE);
+        memcpy(buf + 2 + SHA256_SIZE, msg->u.commit.coin, SHA256_SIZE);
+        break;
+    case LS_COIN:
+        memcpy(buf + 1, msg->u.coin.nonce, LOCKSTEP_NONCE);
+        break;
+    case LS_MOVE:
+        buf[1] = msg->u.move.shot;
+        buf[2] = msg->u.move.answer;
+        buf[3] = msg->u.move.check;
+        break;
+    case LS_REVEAL: {
+        uint8_t *p = buf + 1 + LOCKSTEP_SALT;
+        memcpy(buf + 1, msg->u.reveal.salt, LOCKSTEP_SALT);
+        for (int s = 0; s < SHIP_COUNT; s++, p += 3) {
+            p[0] = msg->u.reveal.fleet[s].x;
+            p[1] = msg->u.reveal.fleet[s].y;
+            p[2] = msg->u.reveal.fleet[s].vertical;
+        }
+        for (int i = 0; i < 8; i++)
+            p[i] = (uint8_t)(msg->u.reveal.hash >> (8 * i));
+        break;
+    }
+    default: break;
+    }
+    return size;
+}
+
+// ============================================================================
+// FONCTION : lockstepDecode
+// DESCRIPTION : Attend que le message soit complet avant de le lire
+// ============================================================================
+int lockstepDecode(const uint8_t *buf, size_t len, LockstepMsg *msg) {
+    if (len == 0)
+        return 0;
+    size_t size = lockstepSize(buf[0]);
+    if (size == 0)
+        return -1;
+    if (len < size)
+        return 0;
+
+    msg->type = (LockstepType)buf[0];
+    switch (msg->type) {
+    case LS_COMMIT:
+        msg->u.commit.version = buf[1];
+        memcpy(msg->u.commit.digest, buf + 2, SHA256_SIZE);
+        memcpy(msg->u.commit.coin, buf + 2 + SHA256_SIZE, SHA256_SIZE);
+        break;
+    case LS_COIN:
+        memcpy(msg->u.coin.nonce, buf + 1, LOCKSTEP_NONCE);
+        break;
+    case LS_MOVE:
+        msg->u.move.shot = buf[1];
+        msg->u.move.answer = buf[2];
+        msg->u.move.check = buf[3];
+        break;
+    case LS_REVEAL: {
+        const uint8_t *p = buf + 1 + LOCKSTEP_SALT;
+        memcpy(msg->u.reveal.salt, buf + 1, LOCKSTEP_SALT);
+        for (int s = 0; s < SHIP_COUNT; s++, p += 3) {
+            msg->u.reveal.fleet[s].x = p[0];
+            msg->u.reveal.fleet[s].y = p[1];
+            msg->u.reveal.fleet[s].vertical = p[2];
+        }
+        msg->u.reveal.hash = 0;
+        for (int i = 0; i < 8; i++)
+            msg->u.reveal.hash |= (uint64_t)p[i] << (8 * i);
+        break;
+    }
+    default: break;
+    }
+    return (int)size;
+}
+
+// ============================================================================
+// FONCTION : commitDigest (interne)
+// DESCRIPTION : SHA-256 du sel suivi de la flotte (x, y, sens par bateau)
+// ============================================================================
+static void commitDigest(const uint8_t salt[LOCKSTEP_SALT], const ProtoShip fleet[SHIP_COUNT],
+                         uint8_t out[SHA256_SIZE]) {
+    Sha256 ctx;
+    uint8_t bytes[3 * SHIP_COUNT];
+
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        bytes[3 * s] = fleet[s].x;
+        bytes[3 * s + 1] = fleet[s].y;
+        bytes[3 * s + 2] = fleet[s].vertical;
+    }
+    sha256Init(&ctx);
+    sha256Update(&ctx, salt, LOCKSTEP_SALT);
+    sha256Update(&ctx, bytes, sizeof(bytes));
+    sha256Final(&ctx, out);
+}
+
+// ============================================================================
+// FONCTION : coinDigest (interne)
+// DESCRIPTION : SHA-256 du jeton du tirage au sort
+// ============================================================================
+static void coinDigest(const uint8_t nonce[LOCKSTEP_NONCE], uint8_t out[SHA256_SIZE]) {
+    Sha256 ctx;
+
+    sha256Init(&ctx);
+    sha256Update(&ctx, nonce, LOCKSTEP_NONCE);
+    sha256Final(&ctx, out);
+}
+
+// ============================================================================
+// FONCTION : lockstepInit
+// DESCRIPTION : Flotte relevée sur la grille, engagements calculés
+// ============================================================================
+void lockstepInit(Lockstep *ls, int seat, int grid[GRID][GRID],
+                  const uint8_t salt[LOCKSTEP_SALT], const uint8_t nonce[LOCKSTEP_NONCE],
+                  LockstepMsg *commit) {
+    memset(ls, 0, sizeof(*ls));
+    ls->seat = seat;
+    ls->first = -1;
+    ls->turn = -1;
+    ls->winner = -1;
+    ls->pending = -1;
+    ls->answer = LOCKSTEP_NONE;
+    memcpy(ls->grid, grid, sizeof(ls->grid));
+    memcpy(ls->salt, salt, LOCKSTEP_SALT);
+    protoFleetFromGrid(ls->grid, ls->fleet);
+    commitDigest(ls->salt, ls->fleet, ls->commits[seat]);
+    memcpy(ls->nonce, nonce, LOCKSTEP_NONCE);
+    coinDigest(ls->nonce, ls->coins[seat]);
+
+    commit->type = LS_COMMIT;
+    commit->u.commit.version = LOCKSTEP_VERSION;
+    memcpy(commit->u.commit.digest, ls->commits[seat], SHA256_SIZE);
+    memcpy(commit->u.commit.coin, ls->coins[seat], SHA256_SIZE);
+}
+
+// ============================================================================
+// FONCTION : lockstepStart
+// DESCRIPTION : Engagements adverses enregistrés, jeton local prêt à dévoiler
+// ============================================================================
+LockstepStatus lockstepStart(Lockstep *ls, const LockstepMsg *peer, LockstepMsg *coin) {
+    if (peer->type != LS_COMMIT || peer->u.commit.version != LOCKSTEP_VERSION || ls->started)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    memcpy(ls->commits[1 - ls->seat], peer->u.commit.digest, SHA256_SIZE);
+    memcpy(ls->coins[1 - ls->seat], peer->u.commit.coin, SHA256_SIZE);
+    ls->started = 1;
+
+    coin->type = LS_COIN;
+    memcpy(coin->u.coin.nonce, ls->nonce, LOCKSTEP_NONCE);
+    return LOCKSTEP_OK;
+}
+
+// ============================================================================
+// FONCTION : lockstepFlip
+// DESCRIPTION : Premier tireur : bit de poids faible du OU exclusif des deux
+//               jetons. Chaque jeton est engagé avant que l'autre soit connu :
+//               aucun pair ne choisit seul le résultat
+// ============================================================================
+LockstepStatus lockstepFlip(Lockstep *ls, const LockstepMsg *peer) {
+    uint8_t digest[SHA256_SIZE];
+
+    if (peer->type != LS_COIN || !ls->started || ls->first >= 0)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    coinDigest(peer->u.coin.nonce, digest);
+    if (memcmp(digest, ls->coins[1 - ls->seat], SHA256_SIZE) != 0)
+        return LOCKSTEP_BAD_COIN;
+
+    ls->first = (ls->nonce[0] ^ peer->u.coin.nonce[0]) & 1;
+    ls->turn = ls->first;
+    return LOCKSTEP_OK;
+}
+
+// ============================================================================
+// FONCTION : lockstepMyTurn
+// DESCRIPTION : Au pair local d'envoyer MOVE
+// ============================================================================
+int lockstepMyTurn(const Lockstep *ls) {
+    return ls->turn == ls->seat;
+}
+
+// ============================================================================
+// FONCTION : lockstepHash
+// DESCRIPTION : Clés de Zobrist des cases visées des deux grilles (la seconde
+//               tournée de 32 bits), plus le nombre de tirs
+// ============================================================================
+uint64_t lockstepHash(const Lockstep *ls) {
+    uint64_t hash[2] = {0, 0};
+
+    for (int b = 0; b < 2; b++)
+        for (int x = 0; x < GRID; x++)
+            for (int y = 0; y < GRID; y++) {
+                int v = ls->boards[b][x][y];
+                if (v == 0)
+                    continue;
+                hash[b] ^= zobristKey(x, y, v == -99 ? OBS_MISS : v <= -200 ? OBS_SUNK : OBS_HIT);
+            }
+    return hash[0] ^ (hash[1] << 32 | hash[1] >> 32) ^ 0x9E3779B97F4A7C15ULL * (uint64_t)ls->shots;
+}
+
+// ============================================================================
+// FONCTION : lockstepMove
+// DESCRIPTION : Le contrôle porte sur l'état après la réponse, avant le tir
+// ============================================================================
+LockstepStatus lockstepMove(Lockstep *ls, int x, int y, LockstepMsg *out) {
+    int peer = 1 - ls->seat;
+
+    if (ls->turn != ls->seat)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    out->type = LS_MOVE;
+    out->u.move.answer = (uint8_t)ls->answer;
+    out->u.move.check = (uint8_t)lockstepHash(ls);
+
+    // Flotte locale détruite : dernière réponse, sans tir
+    if (ls->over) {
+        out->u.move.shot = LOCKSTEP_NONE;
+        ls->turn = -1;
+        return LOCKSTEP_OK;
+    }
+
+    if (x < 0 || x >= GRID || y < 0 || y >= GRID || ls->boards[peer][x][y] != 0)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    out->u.move.shot = (uint8_t)(x * GRID + y);
+    ls->pending = x * GRID + y;
+    ls->log[ls->shots++] = (LockstepShot){(uint8_t)ls->seat, (uint8_t)ls->pending, LOCKSTEP_NONE};
+    ls->answer = LOCKSTEP_NONE;
+    ls->turn = peer;
+    return LOCKSTEP_OK;
+}
+
+// ============================================================================
+// FONCTION : validAnswer (interne)
+// DESCRIPTION : Code d'une case visée : manqué, ou touché / coulé d'un bateau
+//               existant
+// ============================================================================
+static int validAnswer(int code) {
+    int id = code & 0x0F;
+
+    if (code == 0x20)
+        return 1;
+    return (code & ~0x3F) == 0 && (code & 0x30) != 0 && (code & 0x30) != 0x20
+        && id >= 1 && id <= SHIP_COUNT;
+}
+
+// ============================================================================
+// FONCTION : resolveLocal (interne)
+// DESCRIPTION : Tir adverse sur la grille locale, mêmes règles que le moteur
+// RETOUR : nouvelle valeur de la case
+// ============================================================================
+static int resolveLocal(int g[GRID][GRID], int x, int y) {
+    int id = g[x][y];
+
+    if (id == 0)
+        return g[x][y] = -99;
+    g[x][y] = -id;
+    if (isShipSunk(g, id)) {
+        markShipSunk(g, id);
+        return -200 - id;
+    }
+    return -id;
+}
+
+// ============================================================================
+// FONCTION : lockstepReceive
+// DESCRIPTION : Réponse au tir local, contrôle, puis tir adverse
+// ============================================================================
+LockstepStatus lockstepReceive(Lockstep *ls, const LockstepMsg *msg) {
+    int peer = 1 - ls->seat;
+    const int shot = msg->u.move.shot, answer = msg->u.move.answer;
+
+    if (msg->type != LS_MOVE || ls->turn != peer)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    // Réponse au dernier tir local (aucune au tout premier coup)
+    if (ls->pending >= 0) {
+        if (!validAnswer(answer))
+            return LOCKSTEP_BAD_MESSAGE;
+        int value = protoCellValue((uint8_t)answer);
+        protoApplyCell(ls->boards[peer], ls->pending / GRID, ls->pending % GRID, value);
+        if (value <= -200)
+            ls->sunk[peer]++;
+        ls->log[ls->shots - 1].code = (uint8_t)answer;
+        ls->pending = -1;
+    } else if (answer != LOCKSTEP_NONE) {
+        return LOCKSTEP_BAD_MESSAGE;
+    }
+
+    if (msg->u.move.check != (uint8_t)lockstepHash(ls))
+        return LOCKSTEP_DESYNC;
+
+    // Pas de tir : l'adversaire annonce sa flotte détruite
+    if (shot == LOCKSTEP_NONE) {
+        if (ls->sunk[peer] != SHIP_COUNT)
+            return LOCKSTEP_BAD_MESSAGE;
+        ls->over = 1;
+        ls->winner = ls->seat;
+        ls->turn = -1;
+        return LOCKSTEP_OK;
+    }
+
+    int x = shot / GRID, y = shot % GRID;
+    if (shot >= GRID * GRID || ls->boards[ls->seat][x][y] != 0)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    int value = resolveLocal(ls->grid, x, y);
+    protoApplyCell(ls->boards[ls->seat], x, y, value);
+    if (value <= -200)
+        ls->sunk[ls->seat]++;
+    ls->answer = protoCellCode(value);
+    ls->log[ls->shots++] = (LockstepShot){(uint8_t)peer, (uint8_t)shot, (uint8_t)ls->answer};
+    ls->turn = ls->seat;
+
+    if (allDestroyed(ls->grid)) {
+        ls->over = 1;
+        ls->winner = peer;
+    }
+    return LOCKSTEP_OK;
+}
+
+// ============================================================================
+// FONCTION : lockstepReveal
+// DESCRIPTION : Sel et flotte engagés, hachage de l'état final
+// ============================================================================
+void lockstepReveal(const Lockstep *ls, LockstepMsg *out) {
+    out->type = LS_REVEAL;
+    memcpy(out->u.reveal.salt, ls->salt, LOCKSTEP_SALT);
+    memcpy(out->u.reveal.fleet, ls->fleet, sizeof(ls->fleet));
+    out->u.reveal.hash = lockstepHash(ls);
+}
+
+// ============================================================================
+// FONCTION : lockstepVerify
+// DESCRIPTION : Les deux flottes vraies sont reconstruites et la partie est
+//               rejouée tir par tir : chaque case résolue par le moteur doit
+//               valoir la réponse donnée pendant la partie
+// ============================================================================
+LockstepStatus lockstepVerify(const Lockstep *ls, const LockstepMsg *peer) {
+    int peerSeat = 1 - ls->seat;
+    uint8_t digest[SHA256_SIZE];
+    Player players[2];
+    Engine e;
+
+    if (peer->type != LS_REVEAL || !ls->over)
+        return LOCKSTEP_BAD_MESSAGE;
+
+    commitDigest(peer->u.reveal.salt, peer->u.reveal.fleet, digest);
+    if (memcmp(digest, ls->commits[peerSeat], SHA256_SIZE) != 0)
+        return LOCKSTEP_BAD_COMMIT;
+    if (!protoPlaceFleet(peer->u.reveal.fleet, &shipConfig, players[peerSeat].grid))
+        return LOCKSTEP_BAD_FLEET;
+    if (!protoPlaceFleet(ls->fleet, &shipConfig, players[ls->seat].grid))
+        return LOCKSTEP_BAD_FLEET;
+    players[0].score = players[1].score = 0;
+
+    // Le moteur numérote les places dans l'ordre de jeu
+    engineInit(&e, &players[ls->first], &players[1 - ls->first],
+               ENGINE_REMOTE, ENGINE_REMOTE, engineMonotonicClock());
+    for (int i = 0; i < ls->shots; i++) {
+        const LockstepShot *s = &ls->log[i];
+        int x = s->index / GRID, y = s->index % GRID;
+        EngineInput input = {ENGINE_INPUT_SHOT, x, y};
+
+        if (engineStep(&e, input) == ENGINE_EVENT_IGNORED
+            || protoCellCode(players[1 - s->seat].grid[x][y]) != s->code)
+            return LOCKSTEP_LIE;
+    }
+    if (e.phase != ENGINE_OVER || (e.winner == 0 ? ls->first : 1 - ls->first) != ls->winner)
+        return LOCKSTEP_LIE;
+
+    if (peer->u.reveal.hash != lockstepHash(ls))
+        return LOCKSTEP_DESYNC;
+    return LOCKSTEP_OK;
+}
+
+// ============================================================================
+// FONCTION : lockstepStatusName
+// DESCRIPTION : Noms des résultats (messages des outils)
+// ============================================================================
+const char *lockstepStatusName(LockstepStatus status) {
+    switch (status) {
+    case LOCKSTEP_OK:          return "ok";
+    case LOCKSTEP_BAD_MESSAGE: return "message invalide";
+    case LOCKSTEP_DESYNC:      return "états divergents";
+    case LOCKSTEP_BAD_COMMIT:  return "flotte différente de l'engagement";
+    case LOCKSTEP_BAD_FLEET:   return "flotte invalide";
+    case LOCKSTEP_LIE:         return "réponse fausse";
+    case LOCKSTEP_BAD_COIN:    return "jeton différent de l'engagement";
+    }
+    return "?";
+}
@@ -12,6 +12,249 @@
 #include "ai.h"         // Fonctions d'intelligence artificielle
 #include "files.h"      // Fonctions de gestion des fichiers de scores
 #include "utils.h"      // Fonctions utilitaires diverses
+#include "kernels.h"    // Dispatch des noyaux selon le processeur
+#include "book.h"       // Bibliothèque d'ouvertures de l'IA experte
+#include "anytime.h"    // Réflexion de l'IA pendant le tour du joueur
+#include "aiqueue.h"    // File de travaux du fil de l'IA
+#include "chrono.h"     // Mesure de la latence de l'IA
+#include "engine.h"     // Déroulement de la partie (machine à états)
+#include "vclock.h"     // Horloge virtuelle (vitesse du mode observation)
+#include "spectate.h"   // Parties simulées du tableau de bord
+#include "stats.h"      // Distribution du temps de rendu des images
+
+// Réflexion de l'IA sur son prochain coup (mode solo)
+static AnytimeAI thinker;
+
+// ============================================================================
+// FONCTION : sdlNow (interne)
+// DESCRIPTION : Horloge de la partie : temps SDL en millisecondes
+// ============================================================================
+static uint64_t sdlNow(void *ctx) {
+    (void)ctx;
+    return SDL_GetTicks();
+}
+
+// Mode observation (IA contre IA) : vitesses des touches 1, 2 et 3
+static const unsigned watchRates[3] = {1, 10, 100};
+#define WATCH_THINK_US 8000      // Réflexion des IA par image
+#define WATCH_END_PAUSE 2000     // Temps virtuel (ms) entre deux parties
+
+// Réflexions des deux IA du mode observation
+static AnytimeAI watchThinkers[2];
+
+// ============================================================================
+// FONCTION : watchAdvance (interne)
+// DESCRIPTION : Fait avancer une partie IA contre IA pendant au plus
+//               budgetNs de réflexion : l'IA qui va jouer réfléchit pendant
+//               le délai qui précède son tour et joue dès que son tour est
+//               venu (sur l'horloge virtuelle) et sa réflexion terminée ;
+//               plusieurs coups peuvent se suivre dans la même image en
+//               vitesse rapide. Tout se passe sur le fil principal.
+// PARAMÈTRES :
+//   - e        : partie en cours
+//   - states   : états des deux IA
+//   - levels   : niveaux des deux IA
+//   - budgetNs : réflexion permise pour cette image
+// ============================================================================
+static void watchAdvance(Engine *e, AIState states[2], const AILevel levels[2], uint64_t budgetNs) {
+    uint64_t deadline = chronoNowNs() + budgetNs;
+
+    for (;;) {
+        engineStep(e, (EngineInput){ENGINE_INPUT_NONE, 0, 0});  // Fin du délai
+        if (e->phase == ENGINE_OVER)
+            return;
+
+        // Pendant le délai, c'est l'IA suivante qui réfléchit
+        int seat = (e->phase == ENGINE_SHOT_DELAY) ? 1 - e->current : e->current;
+        AnytimeAI *t = &watchThinkers[seat];
+        if (!t->finished) {
+            uint64_t now = chronoNowNs();
+            if (now >= deadline)
+                return;
+            anytimeRefineFor(t, deadline - now);
+            continue;
+        }
+        if (e->phase != ENGINE_AI_TURN)
+            return;  // Coup prêt, délai pas encore écoulé
+
+        // Sécurité : une IA ne peut pas tirer plus de GRID * GRID fois
+        if (e->shots[seat] >= GRID * GRID) {
+            engineStep(e, (EngineInput){ENGINE_INPUT_QUIT, 0, 0});
+            return;
+        }
+        anytimeCommit(t, engineOpponent(e), &states[seat]);
+        engineStep(e, (EngineInput){ENGINE_INPUT_AI_DONE, 0, 0});
+        if (e->phase == ENGINE_SHOT_DELAY)
+            anytimeStart(&watchThinkers[1 - seat], levels[1 - seat], e->players[seat], &states[1 - seat]);
+    }
+}
+
+// ============================================================================
+// FONCTION : watchGames (interne)
+// DESCRIPTION : Mode observation : enchaîne des parties IA contre IA dans la
+//               fenêtre, flottes révélées. Touches 1, 2, 3 : vitesse x1, x10,
+//               x100 (délais entre les tours et animations) ; espace : pause
+// PARAMÈTRES :
+//   - levels : niveaux des deux IA (la première commence)
+// ============================================================================
+static void watchGames(const AILevel levels[2]) {
+    static const char *levelNames[] = {"facile", "moyen", "difficile", "expert", "info"};
+    EngineClock sdlClock = {sdlNow, NULL};
+    VirtualClock vclock;
+    int rateIndex = 0, paused = 0, quit = 0;
+    int games = 0, wins[2] = {0, 0};
+    char title[128] = "";
+
+    vclockInit(&vclock, sdlClock, watchRates[rateIndex]);
+    renderSetClock(vclockEngineClock(&vclock));
+
+    while (!quit) {
+        Player players[2];
+        AIState states[2];
+        Engine engine;
+        uint64_t overAt = 0;  // Fin de la partie (temps virtuel, 0 = en cours)
+
+        for (int p = 0; p < 2; p++) {
+            initPlayer(&players[p]);
+            initAIState(&states[p]);
+            placeShips(players[p].grid, &shipConfig);
+        }
+        engineInit(&engine, &players[0], &players[1], ENGINE_AI, ENGINE_AI, vclockEngineClock(&vclock));
+        anytimeStart(&watchThinkers[0], levels[0], &players[1], &states[0]);
+
+        while (!quit && (overAt == 0 || vclockNow(&vclock) - overAt < WATCH_END_PAUSE)) {
+            SDL_Event e;
+            while (SDL_PollEvent(&e)) {
+                if (e.type == SDL_EVENT_QUIT) {
+                    quit = 1;
+                } else if (e.type == SDL_EVENT_KEY_DOWN) {
+                    if (e.key.scancode == SDL_SCANCODE_1) rateIndex = 0;
+                    else if (e.key.scancode == SDL_SCANCODE_2) rateIndex = 1;
+                    else if (e.key.scancode == SDL_SCANCODE_3) rateIndex = 2;
+                    else if (e.key.scancode == SDL_SCANCODE_SPACE) paused = !paused;
+                    else if (e.key.scancode == SDL_SCANCODE_ESCAPE) quit = 1;
+                    vclockSetRate(&vclock, paused ? 0 : watchRates[rateIndex]);
+                }
+            }
+
+            // En pause, le temps virtuel et les IA sont arrêtés
+            if (!paused && engine.phase != ENGINE_OVER)
+                watchAdvance(&engine, states, levels, (uint64_t)WATCH_THINK_US * 1000);
+
+            if (engine.phase == ENGINE_OVER && overAt == 0) {
+                overAt = vclockNow(&vclock) + 1;
+                anytimeRelease(&watchThinkers[0]);
+                anytimeRelease(&watchThinkers[1]);
+                if (engine.winner >= 0) {
+                    games++;
+                    wins[engine.winner]++;
+                    printf("Partie %d : IA %d (%s) gagne en %d tirs\n", games, engine.winner + 1,
+                           levelNames[levels[engine.winner]], engine.shots[engine.winner]);
+                }
+            }
+
+            // Titre : IA en présence, vitesse et score
+            char wanted[128];
+            snprintf(wanted, sizeof(wanted), "Bataille Navale - IA %s contre IA %s - x%u%s - %d-%d",
+                     levelNames[levels[0]], levelNames[levels[1]], watchRates[rateIndex],
+                     paused ? " (pause)" : "", wins[0], wins[1]);
+            if (strcmp(wanted, title) != 0) {
+                strcpy(title, wanted);
+                SDL_SetWindowTitle(graphics.window, title);
+            }
+
+            // Les deux flottes sont révélées
+            SDL_SetRenderDrawColor(graphics.renderer, 0, 0, 0, 255);
+            SDL_RenderClear(graphics.renderer);
+            drawGrid(&graphics, players[0].grid, 0, 1);
+            drawGrid(&graphics, players[1].grid, GRID * CELL, 1);
+            SDL_SetRenderDrawColor(graphics.renderer, 200, 200, 200, 255);
+            SDL_RenderLine(graphics.renderer, GRID * CELL - 1, 0, GRID * CELL - 1, HEIGHT);
+            SDL_RenderLine(graphics.renderer, GRID * CELL, 0, GRID * CELL, HEIGHT);
+            SDL_RenderPresent(graphics.renderer);
+            SDL_Delay(16);
+        }
+    }
+
+    anytimeRelease(&watchThinkers[0]);
+    anytimeRelease(&watchThinkers[1]);
+    if (games > 0)
+        printf("%d parties : IA 1 (%s) %d victoires, IA 2 (%s) %d victoires\n", games,
+               levelNames[levels[0]], wins[0], levelNames[levels[1]], wins[1]);
+}
+
+// ============================================================================
+// FONCTION : dashboardGames (interne)
+// DESCRIPTION : Tableau de bord : SPECTATE_BOARDS parties IA contre IA jouées
+//               à pleine vitesse sur le fil de simulation, affichées en
+//               mosaïque à ~60 images par seconde ; le titre de la fenêtre
+//               donne le débit de la simulation et celui de l'affichage, la
+//               distribution du temps de rendu est affichée en sortie
+// PARAMÈTRES :
+//   - levels : niveaux des deux IA (la première commence)
+// ============================================================================
+static void dashboardGames(const AILevel levels[2]) {
+    const uint64_t frameNs = 1000000000ull / 60;
+    SpectateStats st, last = {0, 0, {0, 0}};
+    uint64_t windowStart = chronoNowNs(), nextFrame = windowStart;
+    int frames = 0, quit = 0;
+    static Histogram renderNs;  // Temps de rendu de chaque image
+    histInit(&renderNs);
+
+    if (!dashboardInit(&graphics) || !spectateStart(levels, seed)) {
+        printf("Tableau de bord indisponible.\n");
+        dashboardFree();
+        return;
+    }
+
+    while (!quit) {
+        SDL_Event e;
+        while (SDL_PollEvent(&e))
+            if (e.type == SDL_EVENT_QUIT
+                || (e.type == SDL_EVENT_KEY_DOWN && e.key.scancode == SDL_SCANCODE_ESCAPE))
+                quit = 1;
+
+        uint64_t drawStart = chronoNowNs();
+        SDL_SetRenderDrawColor(graphics.renderer, 0, 0, 0, 255);
+        SDL_RenderClear(graphics.renderer);
+        dashboardDraw(&graphics);
+        SDL_RenderPresent(graphics.renderer);
+        histRecord(&renderNs, chronoNowNs() - drawStart);
+        frames++;
+
+        // Titre mis à jour chaque seconde : débits de simulation et d'affichage
+        uint64_t now = chronoNowNs();
+        if (now - windowStart >= 1000000000ull) {
+            char title[160];
+            double secs = (double)(now - windowStart) / 1e9;
+            spectateStats(&st);
+            snprintf(title, sizeof(title),
+                     "Bataille Navale - %d parties - %llu finies (%llu-%llu) - %.0f coups/s - %.0f ips",
+                     SPECTATE_BOARDS, (unsigned long long)st.games, (unsigned long long)st.wins[0],
+                     (unsigned long long)st.wins[1], (double)(st.shots - last.shots) / secs, frames / secs);
+            SDL_SetWindowTitle(graphics.window, title);
+            last = st;
+            frames = 0;
+            windowStart = now;
+        }
+
+        // Cadence de 60 images par seconde (sans dérive)
+        nextFrame += frameNs;
+        now = chronoNowNs();
+        if (nextFrame > now)
+            SDL_DelayNS(nextFrame - now);
+        else
+            nextFrame = now;  // Image en retard : on repart de maintenant
+    }
+
+    spectateStop();
+    dashboardFree();
+    spectateStats(&st);
+    printf("%llu parties terminées : IA 1 %llu victoires, IA 2 %llu victoires, %llu coups\n",
+           (unsigned long long)st.games, (unsigned long long)st.wins[0],
+           (unsigned long long)st.wins[1], (unsigned long long)st.shots);
+    histPrint(&renderNs, stdout, "Rendu des images", "ms", 1e6);
+}
 
 // ============================================================================
 // FONCTION PRINCIPALE : main
@@ -19,22 +262,68 @@
 // RETOUR : Code de sortie (0 = succès, 1 = erreur)
 // ============================================================================
 int main() {
-    int mode;  // Variable pour stocker le mode de jeu choisi (1-4)
+    int mode;  // Variable pour stocker le mode de jeu choisi (1-8)
 
     // ===== AFFICHAGE DU MENU PRINCIPAL =====
     printf("1 : Joueur vs Joueur\n");
     printf("2 : Joueur vs IA (Facile)\n");
     printf("3 : Joueur vs IA (Moyen)\n");
     printf("4 : Joueur vs IA (Difficile)\n");
+    printf("5 : Joueur vs IA (Expert)\n");
+    printf("6 : Joueur vs IA (Info)\n");
+    printf("7 : IA vs IA (observation)\n");
+    printf("8 : IA vs IA (tableau de bord, %d parties)\n", SPECTATE_BOARDS);
     printf("Choix : ");
     scanf("%d", &mode);  // Lecture du choix utilisateur
 
     // Vérification de la validité du mode choisi
-    if (mode < 1 || mode > 4) {
+    if (mode < 1 || mode > 8) {
         printf("Mode invalide. Fin du programme.\n");
         return 1;  // Retourne 1 pour indiquer une erreur
     }
 
+    // ===== MODES OBSERVATION ET TABLEAU DE BORD (IA CONTRE IA) =====
+    if (mode >= 7) {
+        AILevel levels[2];
+        for (int p = 0; p < 2; p++) {
+            int choice;
+            printf("Niveau de l'IA %d (1 facile, 2 moyen, 3 difficile, 4 expert, 5 info) : ", p + 1);
+            if (scanf("%d", &choice) != 1 || choice < 1 || choice > 5) {
+                printf("Niveau invalide. Fin du programme.\n");
+                return 1;
+            }
+            levels[p] = (AILevel)(choice - 1);
+        }
+        if (mode == 7)
+            printf("Touches 1, 2, 3 : vitesse x1, x10, x100 ; espace : pause ; Échap : quitter\n");
+
+        SDL_Init(SDL_INIT_VIDEO);
+        seed = SDL_GetTicks();
+        dispatchInit(CPU_AVX512);
+        bookOpen(BOOK_DEFAULT_PATH, &shipConfig);
+#ifdef AI_COOPERATIVE
+        aiSetThreads(1);  // Pas de groupe de fils
+#endif
+        graphics.window = SDL_CreateWindow("Bataille Navale", WIDTH, HEIGHT, 0);
+        graphics.renderer = SDL_CreateRenderer(graphics.window, NULL);
+        SDL_SetWindowPosition(graphics.window, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED);
+
+        if (mode == 7)
+            watchGames(levels);
+        else
+            dashboardGames(levels);
+
+        SDL_DestroyRenderer(graphics.renderer);
+        SDL_DestroyWindow(graphics.window);
+        SDL_Quit();
+        bookClose();
+        return 0;
+    }
+
+    // Niveau de l'IA en mode solo (modes 2 à 6 : facile à info, dans l'ordre
+    // de AILevel ; experte et info réfléchissent pendant le tour du joueur)
+    AILevel aiLevel = (AILevel)(mode - 2);
+
     // ===== SAISIE DES NOMS DES JOUEURS =====
     char player1Name[50];  // Buffer pour le nom du joueur 1 (49 caractères max + \0)
     char player2Name[50];  // Buffer pour le nom du joueur 2 ou IA
@@ -72,6 +361,8 @@ int main() {
     // ===== INITIALISATION DE SDL (SYSTÈME GRAPHIQUE) =====
     SDL_Init(SDL_INIT_VIDEO);  // Initialise SDL avec le sous-système vidéo
     seed = SDL_GetTicks();     // Initialise la graine aléatoire avec le temps actuel (seed doit être globale)
+    dispatchInit(CPU_AVX512);  // Lie les noyaux à la meilleure variante du processeur
+    bookOpen(BOOK_DEFAULT_PATH, &shipConfig);  // Ouvertures précalculées (si le fichier existe)
 
     // Création de la fenêtre graphique
     graphics.window = SDL_CreateWindow("Bataille Navale", WIDTH, HEIGHT, 0);  // WIDTH et HEIGHT doivent être définis
@@ -82,7 +373,6 @@ int main() {
     initPlayer(&player1);     // Initialise le joueur 1 (structures globales)
     initPlayer(&player2);     // Initialise le joueur 2/IA
     initAIState(&aiState);    // Initialise l'état de l'IA
-    initGameState(&gameState); // Initialise l'état du jeu
 
     // ===== PHASE DE PLACEMENT DES BATEAUX =====
     if (placementMode == 1) {
@@ -140,166 +430,151 @@ int main() {
     }
 
     // ===== BOUCLE PRINCIPALE DU JEU =====
-    int running = 1;  // Flag pour contrôler la boucle de jeu
     SDL_Event e;      // Structure pour stocker les événements SDL
 
-    while (running) {
+    // Déroulement de la partie : le moteur tient les tours et les délais,
+    // la boucle ne fait que lui transmettre les clics et le coup de l'IA
+    // Les délais et les animations lisent la même horloge virtuelle (vitesse x1)
+    Engine engine;
+    EngineClock sdlClock = {sdlNow, NULL};
+    VirtualClock vclock;
+    vclockInit(&vclock, sdlClock, 1);
+    renderSetClock(vclockEngineClock(&vclock));
+    engineInit(&engine, &player1, &player2, ENGINE_HUMAN, mode == 1 ? ENGINE_HUMAN : ENGINE_AI,
+               vclockEngineClock(&vclock));
+
+    // Latence de l'IA : temps entre la fin du délai et le coup joué
+    uint64_t aiDueNs = 0;        // Fin du délai du tour en cours (0 = pas encore atteinte)
+    uint64_t aiLatencySum = 0;   // Somme des latences (ns)
+    uint64_t aiLatencyMax = 0;   // Latence maximale (ns)
+    int aiTurns = 0;             // Tours joués par l'IA
+    int aiReady = 0;             // Tours où le coup était prêt à la fin du délai
+    int aiReplied = 0;           // Réflexion en cours terminée (rendue par le fil)
+    uint64_t aiSliceMax = 0;     // Tranche de réflexion la plus longue (mode coopératif)
+
+    // Mode coopératif : sans fil d'exécution, l'IA réfléchit par tranches de
+    // ANYTIME_FRAME_BUDGET_US à chaque image de la boucle de jeu
+#ifdef AI_COOPERATIVE
+    int cooperative = 1;
+    aiSetThreads(1);  // Pas de groupe de fils non plus
+#else
+    int cooperative = mode != 1 && !aiQueueStart();
+#endif
+
+    // Mode solo : l'IA réfléchit à son premier coup pendant celui du joueur
+    if (mode != 1) {
+        anytimeStart(&thinker, aiLevel, &player1, &aiState);
+        if (!cooperative)
+            aiQueueSubmit(&thinker);
+    }
+
+    while (engine.phase != ENGINE_OVER) {
         // Traitement des événements SDL (clics souris, fermeture fenêtre, etc.)
         while (SDL_PollEvent(&e)) {
-            if (e.type == SDL_EVENT_QUIT) {
-                running = 0;  // L'utilisateur a demandé à quitter
-                break;
-            }
-        
-            // Gestion des clics de souris (tirs)
-            if (e.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
-                // Vérifie si on est en attente d'un délai
-                if ((gameState.waitingPvPDelay) && mode == 1)
-                    break;  // En attente en mode PVP, ignore le clic
-
-                if (gameState.waitingDelay && mode != 1)
-                    break;  // En attente en mode IA, ignore le clic
-
-                // En mode PVP, attend que le joueur confirme le changement de tour
-                if (mode == 1 && gameState.waitingNextPlayer) {
-                    gameState.waitingNextPlayer = 0;  // Commence le tour
-                    break;
-                }
+            EngineInput input = {ENGINE_INPUT_NONE, 0, 0};
 
-                // Récupère les coordonnées du clic
+            if (e.type == SDL_EVENT_QUIT) {
+                input.type = ENGINE_INPUT_QUIT;  // L'utilisateur a demandé à quitter
+            } else if (e.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
                 int mx = e.button.x;  // Coordonnée X de la souris
                 int my = e.button.y;  // Coordonnée Y de la souris
 
-                // Vérifie que le clic est dans la grille de droite (grille adverse)
-                if (mx < GRID * CELL)
-                    break;  // Clic dans la grille de gauche (sa propre grille)
-
-                // Convertit les coordonnées écran en coordonnées grille
-                int x = my / CELL;                    // Ligne dans la grille
-                int y = (mx - GRID * CELL) / CELL;    // Colonne dans la grille de droite
-
-                // Détermine le joueur cible et le joueur actuel
-                Player *target = getOpponent(mode, &gameState);   // Joueur à attaquer
-                Player *current = getCurrentPlayer(mode, &gameState); // Joueur qui tire
-
-                // Traitement du tir
-                if (target->grid[x][y] == 0) {
-                    // Tir dans l'eau
-                    target->grid[x][y] = -99;  // Marque comme manqué
-                    current->score -= 1;       // Pénalité pour tir manqué
-                }
-                else if (target->grid[x][y] > 0) {
-                    // Touché un bateau
-                    int shipId = target->grid[x][y];  // ID du bateau touché
-                    target->grid[x][y] = -shipId;     // Marque comme touché
-                    current->score += 10;             // Bonus pour toucher
-                    target->score -= 5;               // Pénalité pour l'adversaire
-
-                    // Vérifie si le bateau est coulé
-                    if (isShipSunk(target->grid, shipId)) {
-                        markShipSunk(target->grid, shipId);  // Marque comme coulé
-                        current->score += 20;  // Bonus supplémentaire pour couler
-                        target->score -= 10;   // Pénalité supplémentaire
-                    }
-                }
-                else {
-                    // Case déjà visée (touchée ou manquée)
-                    break;  // Ignore ce clic
-                }
-
-                // VÉRIFICATION DE LA VICTOIRE IMMÉDIATE
-                if (mode == 1) {
-                    // Mode PVP : vérifie si l'adversaire n'a plus de bateaux
-                    if (allDestroyed(target->grid)) {
-                        current->score += 100;  // Bonus de victoire
-                        target->score -= 50;    // Pénalité de défaite
-                        
-                        char msg[256];
-                        const char *winnerName = (gameState.currentPlayer == 0) ? player1Name : player2Name;
-                        
-                        snprintf(msg, sizeof(msg), "🏆 VICTOIRE DE %s ! 🏆", winnerName);
-                        printf("Victoire de %s\n", winnerName);
-                        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Fin de partie", msg, graphics.window);
-                        
-                        running = 0;  // Termine le jeu
-                        break;
-                    }
-                    
-                    // Pas de victoire, active le délai et prépare le changement de joueur
-                    gameState.lastPlayerActionTime = SDL_GetTicks();
-                    gameState.waitingPvPDelay = 1;
-                } else {
-                    // Mode IA : active le délai pour le tour de l'IA
-                    gameState.lastActionTime = SDL_GetTicks();
-                    gameState.waitingDelay = 1;
+                if (engine.phase == ENGINE_HANDOVER) {
+                    // Mode PVP : le clic confirme le changement de tour
+                    input.type = ENGINE_INPUT_CONFIRM;
+                } else if (mx >= GRID * CELL) {
+                    // Clic dans la grille de droite (grille adverse) : convertit
+                    // les coordonnées écran en coordonnées grille (ignoré par le
+                    // moteur pendant un délai ou sur une case déjà visée)
+                    input.type = ENGINE_INPUT_SHOT;
+                    input.x = my / CELL;                    // Ligne dans la grille
+                    input.y = (mx - GRID * CELL) / CELL;    // Colonne dans la grille de droite
                 }
             }
-        }
 
-        // Gestion du délai entre tours en mode PVP
-        if (gameState.waitingPvPDelay && mode == 1) {
-            if (SDL_GetTicks() - gameState.lastPlayerActionTime >= PVP_DELAY) {
-                // Délai écoulé, change de joueur
-                gameState.currentPlayer = 1 - gameState.currentPlayer;  // Alterne 0↔1
-                gameState.waitingNextPlayer = 1;   // Affiche l'écran de changement
-                gameState.waitingPvPDelay = 0;     // Désactive le délai
+            if (input.type != ENGINE_INPUT_NONE && engineStep(&engine, input) == ENGINE_EVENT_OVER)
+                break;
+        }
+        if (engine.phase != ENGINE_OVER)
+            engineStep(&engine, (EngineInput){ENGINE_INPUT_NONE, 0, 0});  // Fin des délais
+
+        // Relève (sans attendre) le coup calculé par le fil de l'IA, ou avance
+        // la réflexion d'une tranche en mode coopératif
+        if (mode != 1 && !aiReplied) {
+            if (cooperative) {
+                uint64_t sliceStart = chronoNowNs();
+                aiReplied = !anytimeRefineFor(&thinker, (uint64_t)ANYTIME_FRAME_BUDGET_US * 1000);
+                if (chronoNowNs() - sliceStart > aiSliceMax)
+                    aiSliceMax = chronoNowNs() - sliceStart;
+            } else if (aiQueuePoll() != NULL) {
+                aiReplied = 1;
             }
         }
 
-        // Gestion du délai pour le tour de l'IA
-        if (gameState.waitingDelay && mode != 1) {
-            if (SDL_GetTicks() - gameState.lastActionTime >= TURN_DELAY) {
-                // Délai écoulé, l'IA joue selon le niveau de difficulté
-                if (mode == 2) enemyEasy(&player1, &aiState);
-                else if (mode == 3) enemyMedium(&player1, &aiState);
-                else enemyHard(&player1, &aiState);
-
-                gameState.waitingDelay = 0;  // Désactive le délai
+        // Tour de l'IA (délai écoulé) : arrête la réflexion et joue le
+        // meilleur coup dès que le fil l'a rendu (sans bloquer l'affichage)
+        if (engine.phase == ENGINE_AI_TURN) {
+            if (aiDueNs == 0) {
+                aiDueNs = chronoNowNs();
+                aiReady += aiReplied;  // Réflexion déjà terminée
+            }
+            anytimeCancel(&thinker);
+            if (aiReplied || cooperative) {
+                // Coup spéculé sur un état périmé : coup de premier niveau
+                if (!anytimeValid(&thinker, &aiState)) {
+                    anytimeRelease(&thinker);
+                    anytimeStart(&thinker, aiLevel, &player1, &aiState);
+                }
+                anytimeCommit(&thinker, &player1, &aiState);
+
+                uint64_t latency = chronoNowNs() - aiDueNs;
+                aiLatencySum += latency;
+                if (latency > aiLatencyMax) aiLatencyMax = latency;
+                aiTurns++;
+                aiDueNs = 0;
+
+                // Spéculation : réflexion immédiate sur le coup suivant
+                anytimeStart(&thinker, aiLevel, &player1, &aiState);
+                aiReplied = !cooperative && !aiQueueSubmit(&thinker);  // File pleine : rien en cours
+                engineStep(&engine, (EngineInput){ENGINE_INPUT_AI_DONE, 0, 0});
             }
         }
 
-        // VÉRIFICATION DE LA VICTOIRE APRÈS LE TOUR DE L'IA
-        if (mode != 1) {
-            // Vérifie si le joueur a gagné (a détruit tous les bateaux de l'IA)
-            if (allDestroyed(player2.grid)) {
-                player1.score += 100;  // Bonus de victoire
-                char msg[256];
+        // ===== FIN DE PARTIE =====
+        if (engine.phase == ENGINE_OVER) {
+            char msg[256];
+            if (engine.winner == -1) {
+                break;  // Fenêtre fermée : pas de vainqueur
+            } else if (mode == 1) {
+                const char *winnerName = (engine.winner == 0) ? player1Name : player2Name;
+                snprintf(msg, sizeof(msg), "🏆 VICTOIRE DE %s ! 🏆", winnerName);
+                printf("Victoire de %s\n", winnerName);
+            } else if (engine.winner == 0) {
                 snprintf(msg, sizeof(msg), "🏆 VICTOIRE DE %s ! 🏆\n\nVous avez vaincu l'IA !", player1Name);
                 printf("Victoire de %s\n", player1Name);
-                SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Fin de partie", msg, graphics.window);
-                break;  // Quitte la boucle de jeu
-            }
-            // Vérifie si l'IA a gagné
-            if (allDestroyed(player1.grid)) {
-                player1.score -= 50;  // Pénalité de défaite
-                char msg[256];
+            } else {
                 snprintf(msg, sizeof(msg), "💀 DÉFAITE DE %s 💀\n\nL'IA a gagné !", player1Name);
                 printf("Défaite de %s\n", player1Name);
-                SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Fin de partie", msg, graphics.window);
-                break;  // Quitte la boucle de jeu
             }
+            SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Fin de partie", msg, graphics.window);
+            break;  // Quitte la boucle de jeu
         }
 
         // ===== DESSIN DE L'INTERFACE GRAPHIQUE =====
         SDL_SetRenderDrawColor(graphics.renderer, 0, 0, 0, 255);  // Couleur noir pour effacer
         SDL_RenderClear(graphics.renderer);  // Efface l'écran
 
-        if (mode == 1 && gameState.waitingNextPlayer) {
+        if (engine.phase == ENGINE_HANDOVER) {
             // Mode PVP : affiche l'écran de changement de tour
-            drawTurnScreen(&graphics, gameState.currentPlayer);
+            drawTurnScreen(&graphics, engine.current);
+        } else if (mode == 1) {
+            // Mode PVP : grilles du joueur qui tire
+            drawGrid(&graphics, engineCurrent(&engine)->grid, 0, 1);             // Grille gauche (ses propres bateaux)
+            drawGrid(&graphics, engineOpponent(&engine)->grid, GRID * CELL, 0);  // Grille droite (bateaux adverses cachés)
         } else {
-            // Affiche les deux grilles de jeu
-            if (mode == 1) {
-                // Mode PVP
-                Player *current = getCurrentPlayer(mode, &gameState);
-                Player *opponent = getOpponent(mode, &gameState);
-                drawGrid(&graphics, current->grid, 0, 1);          // Grille gauche (ses propres bateaux)
-                drawGrid(&graphics, opponent->grid, GRID * CELL, 0); // Grille droite (bateaux adverses cachés)
-            } else {
-                // Mode IA
-                drawGrid(&graphics, player1.grid, 0, 1);          // Grille gauche (joueur)
-                drawGrid(&graphics, player2.grid, GRID * CELL, 0); // Grille droite (IA, cachée)
-            }
+            // Mode IA
+            drawGrid(&graphics, player1.grid, 0, 1);          // Grille gauche (joueur)
+            drawGrid(&graphics, player2.grid, GRID * CELL, 0); // Grille droite (IA, cachée)
         }
 
         // Dessine la ligne de séparation entre les deux grilles
@@ -378,9 +653,20 @@ int main() {
     }
 
     // ===== NETTOYAGE ET FERMETURE =====
+    anytimeCancel(&thinker);                 // Abrège une réflexion en cours
+    aiQueueStop();                           // Arrête le fil de l'IA
+    anytimeRelease(&thinker);                // Libère une résolution inachevée
+    if (aiTurns > 0)
+        printf("Latence de l'IA : %.0f µs en moyenne, %.0f µs au plus "
+               "(%d coups sur %d prêts à la fin du délai)\n",
+               (double)aiLatencySum / aiTurns / 1e3, (double)aiLatencyMax / 1e3, aiReady, aiTurns);
+    if (aiTurns > 0 && cooperative)
+        printf("Mode coopératif : tranche de réflexion la plus longue %.0f µs\n",
+               (double)aiSliceMax / 1e3);
     SDL_DestroyRenderer(graphics.renderer);  // Libère le renderer
     SDL_DestroyWindow(graphics.window);      // Ferme la fenêtre
     SDL_Quit();                              // Quitte SDL
+    bookClose();                             // Libère la bibliothèque d'ouvertures
     
     return 0;  // Retourne 0 pour indiquer une exécution réussie
 }
\ No newline at end of file
@@ -0,0 +1,182 @@
+// Active syscall avec -std=c11 (fonction GNU)
+#define _GNU_SOURCE
+
+// Inclusion des bibliothèques nécessaires
+#include <string.h>     // Pour memset
+#include "perfcount.h"  // Déclarations des compteurs matériels (prototypes)
+
+#if defined(__linux__)
+#include <unistd.h>     // Pour syscall, read, close
+#include <sys/ioctl.h>  // Pour ioctl
+#include <sys/syscall.h>  // Pour SYS_perf_event_open
+#include <linux/perf_event.h>  // Pour perf_event_attr
+#endif
+
+// Noms des compteurs (affichage)
+static const char *perfNames[PERF_EVENT_COUNT] = {
+    "cycles", "instructions", "défauts de cache", "mauvaises prédictions"
+};
+
+#if defined(__linux__)
+// Événements matériels génériques du noyau, dans l'ordre de PerfEvent
+static const uint64_t perfConfigs[PERF_EVENT_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+// ============================================================================
+// FONCTION : perfOpenEvent (interne)
+// DESCRIPTION : Ouvre un compteur du fil appelant, en mode utilisateur
+//               seulement (autorisé avec perf_event_paranoid <= 2) ; le
+//               premier ouvert devient le groupe, les suivants s'y joignent
+// ============================================================================
+static int perfOpenEvent(uint64_t config, int group) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group < 0;         // Le groupe démarre une fois complet
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                     | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+#endif
+
+// ============================================================================
+// FONCTION : perfOpen
+// DESCRIPTION : Un compteur refusé (absent du processeur ou de la machine
+//               virtuelle) est simplement omis ; le groupe est lancé une fois
+//               tous les membres ouverts
+// ============================================================================
+int perfOpen(PerfCounters *pc) {
+    memset(pc, 0, sizeof(*pc));
+    pc->leader = -1;
+    for (int e = 0; e < PERF_EVENT_COUNT; e++)
+        pc->fd[e] = -1;
+
+#if defined(__linux__)
+    for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+        int fd = perfOpenEvent(perfConfigs[e], pc->leader);
+        if (fd < 0)
+            continue;
+        if (pc->leader < 0)
+            pc->leader = fd;
+        pc->fd[e] = fd;
+        pc->slot[e] = pc->members++;
+        pc->available |= 1u << e;
+    }
+    if (pc->leader >= 0) {
+        ioctl(pc->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(pc->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+    return pc->members;
+}
+
+// ============================================================================
+// FONCTION : perfClose
+// DESCRIPTION : Membres d'abord, groupe en dernier
+// ============================================================================
+void perfClose(PerfCounters *pc) {
+#if defined(__linux__)
+    for (int e = 0; e < PERF_EVENT_COUNT; e++)
+        if (pc->fd[e] >= 0 && pc->fd[e] != pc->leader)
+            close(pc->fd[e]);
+    if (pc->leader >= 0)
+        close(pc->leader);
+#endif
+    memset(pc, 0, sizeof(*pc));
+    pc->leader = -1;
+    for (int e = 0; e < PERF_EVENT_COUNT; e++)
+        pc->fd[e] = -1;
+}
+
+// ============================================================================
+// FONCTION : perfBegin
+// DESCRIPTION : Une lecture du groupe : nombre de membres, temps d'activation
+//               et de comptage, puis une valeur par membre dans l'ordre
+//               d'ouverture
+// ============================================================================
+void perfBegin(const PerfCounters *pc, PerfReading *start) {
+    memset(start, 0, sizeof(*start));
+#if defined(__linux__)
+    uint64_t buf[3 + PERF_EVENT_COUNT];
+
+    if (pc->leader < 0)
+        return;
+    if (read(pc->leader, buf, sizeof(buf)) < (ssize_t)((3 + pc->members) * sizeof(uint64_t)))
+        return;
+    start->enabled = buf[1];
+    start->running = buf[2];
+    for (int e = 0; e < PERF_EVENT_COUNT; e++)
+        if (pc->fd[e] >= 0)
+            start->value[e] = buf[3 + pc->slot[e]];
+#else
+    (void)pc;
+#endif
+}
+
+// ============================================================================
+// FONCTION : perfEnd
+// DESCRIPTION : Écart avec la lecture d'entrée ; si le groupe n'a compté
+//               qu'une partie du temps (compteurs partagés), l'écart est
+//               extrapolé au temps d'activation
+// ============================================================================
+void perfEnd(const PerfCounters *pc, const PerfReading *start, PerfTotals *totals) {
+    PerfReading end;
+
+    if (pc->leader < 0)
+        return;
+    perfBegin(pc, &end);
+    uint64_t enabled = end.enabled - start->enabled;
+    uint64_t running = end.running - start->running;
+    double scale = running > 0 && enabled > running ? (double)enabled / (double)running : 1.0;
+
+    for (int e = 0; e < PERF_EVENT_COUNT; e++)
+        if (pc->fd[e] >= 0)
+            totals->value[e] += (double)(end.value[e] - start->value[e]) * scale;
+    totals->regions++;
+}
+
+// ============================================================================
+// FONCTION : perfTotalsInit
+// DESCRIPTION : Totaux à zéro
+// ============================================================================
+void perfTotalsInit(PerfTotals *totals) {
+    memset(totals, 0, sizeof(*totals));
+}
+
+// ============================================================================
+// FONCTION : perfPrint
+// DESCRIPTION : Ligne de résumé lisible
+// ============================================================================
+void perfPrint(const PerfCounters *pc, const PerfTotals *totals, FILE *out, const char *label,
+               double units, const char *unit) {
+    unsigned both = (1u << PERF_CYCLES) | (1u << PERF_INSTRUCTIONS);
+
+    if (pc->members == 0) {
+        fprintf(out, "%s : compteurs matériels indisponibles\n", label);
+        return;
+    }
+    if (units <= 0.0)
+        units = 1.0;
+
+    fprintf(out, "%s : IPC ", label);
+    if ((pc->available & both) == both && totals->value[PERF_CYCLES] > 0.0)
+        fprintf(out, "%.2f", totals->value[PERF_INSTRUCTIONS] / totals->value[PERF_CYCLES]);
+    else
+        fprintf(out, "n/d");
+    for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+        if (pc->available & (1u << e))
+            fprintf(out, ", %.1f %s", totals->value[e] / units, perfNames[e]);
+        else
+            fprintf(out, ", n/d %s", perfNames[e]);
+    }
+    fprintf(out, " par %s\n", unit);
+}
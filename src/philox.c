@@ -0,0 +1,102 @@
+// Inclusion des bibliothèques nécessaires
+#include "philox.h"     // Déclarations du générateur (prototypes)
+
+// Multiplicateurs des tours et incréments de la clé (valeurs de référence)
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+// ============================================================================
+// FONCTION : philoxBlock
+// DESCRIPTION : Chaque tour multiplie deux mots (produits 64 bits), croise
+//               parties hautes et basses avec la clé, puis fait tourner la clé
+// ============================================================================
+void philoxBlock(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]) {
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for (int round = 0; round < 10; round++) {
+        uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        c0 = n0;
+        c2 = n2;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+// ============================================================================
+// FONCTION : philoxInit
+// DESCRIPTION : Bloc 0 du flux ; les deux mots hauts du compteur sont fixes
+//               pour la partie et le flux
+// ============================================================================
+void philoxInit(Philox *p, uint64_t runSeed, uint32_t game, uint32_t stream) {
+    p->key[0] = (uint32_t)runSeed;
+    p->key[1] = (uint32_t)(runSeed >> 32);
+    p->counter[0] = 0;
+    p->counter[1] = 0;
+    p->counter[2] = game;
+    p->counter[3] = stream;
+    p->used = 4;
+}
+
+// ============================================================================
+// FONCTION : philoxNext
+// DESCRIPTION : Calcule le bloc courant au besoin, puis passe au suivant
+//               une fois ses quatre mots rendus
+// ============================================================================
+uint32_t philoxNext(Philox *p) {
+    if (p->used == 4) {
+        philoxBlock(p->counter, p->key, p->block);
+        p->used = 0;
+        if (++p->counter[0] == 0)
+            p->counter[1]++;
+    }
+    return p->block[p->used++];
+}
+
+// ============================================================================
+// FONCTION : philoxPosition
+// DESCRIPTION : Blocs entamés * 4, moins les mots pas encore rendus
+// ============================================================================
+uint64_t philoxPosition(const Philox *p) {
+    uint64_t blocks = (uint64_t)p->counter[1] << 32 | p->counter[0];
+    return blocks * 4 - (uint64_t)(4 - p->used);
+}
+
+// ============================================================================
+// FONCTION : philoxSkip
+// DESCRIPTION : Nouvelle position convertie en (bloc, mot) : seul le bloc
+//               d'arrivée est calculé
+// ============================================================================
+void philoxSkip(Philox *p, uint64_t n) {
+    uint64_t target = philoxPosition(p) + n;
+    uint64_t block = target / 4;
+
+    p->counter[0] = (uint32_t)block;
+    p->counter[1] = (uint32_t)(block >> 32);
+    p->used = 4;
+    if (target % 4 != 0) {
+        philoxNext(p);
+        p->used = (int)(target % 4);
+    }
+}
+
+// ============================================================================
+// FONCTION : philoxSeed
+// DESCRIPTION : Premier mot du flux (un seul bloc calculé)
+// ============================================================================
+unsigned int philoxSeed(uint64_t runSeed, uint32_t game, uint32_t stream) {
+    Philox p;
+    philoxInit(&p, runSeed, game, stream);
+    return philoxNext(&p);
+}
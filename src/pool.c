@@ -0,0 +1,423 @@
+// Active sysconf avec -std=c11 (fonction POSIX)
+#define _POSIX_C_SOURCE 200809L
+
+// Inclusion des bibliothèques nécessaires
+#include <pthread.h>    // Fils d'exécution POSIX
+#include <sched.h>      // Pour sched_yield
+#include <stdatomic.h>  // Files de tranches sans verrou
+#include <stdlib.h>     // Pour malloc, free
+#include <unistd.h>     // Pour sysconf
+#include "pool.h"       // Déclarations du groupe (prototypes)
+#include "chrono.h"     // Horloge monotone (activité des fils)
+
+// Taille de la file d'un fil (puissance de 2) ; file pleine : plus de découpage
+#define DEQUE_SIZE 256
+
+// Recherches de vol infructueuses avant qu'un fil auxiliaire s'endorme
+#define IDLE_SPINS 64
+
+// Files : fils du groupe puis fils extérieurs
+#define POOL_SLOTS (POOL_MAX_THREADS + POOL_MAX_CALLERS)
+
+// Boucle en cours (sur la pile de l'appelant de poolParallelFor)
+typedef struct {
+    PoolTask task;
+    void *ctx;
+    int grain;
+    atomic_int remaining;        // Indices pas encore traités
+} PoolJob;
+
+// Tranche en attente dans une file
+typedef struct {
+    PoolJob *job;
+    int begin, end;
+} PoolRange;
+
+// File d'un fil : le propriétaire empile et dépile en bas, les voleurs
+// prennent en haut (Chase et Lev, ordre mémoire de Lê et al., 2013)
+typedef struct {
+    _Alignas(64) atomic_llong top;
+    _Alignas(64) atomic_llong bottom;
+    _Atomic(PoolRange *) ring[DEQUE_SIZE];
+    // Activité, écrite par le propriétaire seul
+    _Alignas(64) atomic_ullong tasks;
+    atomic_ullong steals;
+    atomic_ullong idleNs;
+    atomic_ullong idleSince;     // Début de l'inactivité en cours (0 = actif)
+} Deque;
+
+static Deque deques[POOL_SLOTS];
+
+// Groupe de fils (un seul par processus)
+static pthread_t workers[POOL_MAX_THREADS];
+static atomic_int workerCount;           // Fils auxiliaires (sans l'appelant)
+static int started = 0;                  // Groupe démarré
+static atomic_int callerCount;           // Files attribuées aux fils extérieurs
+static uint64_t statsStart;              // Début de la mesure d'activité
+
+// Sommeil des fils auxiliaires sans travail
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static unsigned long wakeups = 0;        // Réveils (protégé par lock)
+static atomic_int sleepers;              // Fils endormis ou sur le point de l'être
+static atomic_int stopping;              // Demande d'arrêt
+
+// File du fil courant (-1 = pas encore attribuée)
+static _Thread_local int self = -1;
+
+// ============================================================================
+// FONCTIONS : dequePush / dequePop / dequeSteal (internes)
+// DESCRIPTION : Opérations de la file de Chase-Lev à taille fixe
+// RETOUR : dequePush 1 si la tranche est déposée (0 si la file est pleine),
+//          dequePop / dequeSteal la tranche prise ou NULL
+// ============================================================================
+static int dequePush(Deque *d, PoolRange *r) {
+    long long b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+    long long t = atomic_load_explicit(&d->top, memory_order_acquire);
+
+    if (b - t >= DEQUE_SIZE)
+        return 0;
+    atomic_store_explicit(&d->ring[b & (DEQUE_SIZE - 1)], r, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+    return 1;
+}
+
+static PoolRange *dequePop(Deque *d) {
+    long long b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+    PoolRange *r = NULL;
+
+    atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long t = atomic_load_explicit(&d->top, memory_order_relaxed);
+    if (t <= b) {
+        r = atomic_load_explicit(&d->ring[b & (DEQUE_SIZE - 1)], memory_order_relaxed);
+        if (t == b) {
+            // Dernière tranche : course avec les voleurs
+            if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+                                                         memory_order_seq_cst, memory_order_relaxed))
+                r = NULL;
+            atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+    }
+    return r;
+}
+
+static PoolRange *dequeSteal(Deque *d) {
+    long long t = atomic_load_explicit(&d->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+
+    if (t >= b)
+        return NULL;
+    PoolRange *r = atomic_load_explicit(&d->ring[t & (DEQUE_SIZE - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return NULL;  // Un autre fil l'a prise
+    return r;
+}
+
+// ============================================================================
+// FONCTIONS : idleBegin / idleEnd (internes)
+// DESCRIPTION : Comptage du temps sans travail du fil courant
+// ============================================================================
+static void idleBegin(Deque *d) {
+    if (atomic_load_explicit(&d->idleSince, memory_order_relaxed) == 0)
+        atomic_store_explicit(&d->idleSince, chronoNowNs(), memory_order_relaxed);
+}
+
+static void idleEnd(Deque *d) {
+    uint64_t since = atomic_exchange_explicit(&d->idleSince, 0, memory_order_relaxed);
+    if (since != 0)
+        atomic_fetch_add_explicit(&d->idleNs, chronoNowNs() - since, memory_order_relaxed);
+}
+
+// ============================================================================
+// FONCTION : activeSlot (interne)
+// DESCRIPTION : File en service : fil du groupe ou fil extérieur connu
+// ============================================================================
+static int activeSlot(int s) {
+    return s < workerCount || (s >= POOL_MAX_THREADS
+                               && s < POOL_MAX_THREADS + atomic_load(&callerCount));
+}
+
+// ============================================================================
+// FONCTION : stealAny (interne)
+// DESCRIPTION : Tente un vol dans chaque autre file, à partir d'une victime
+//               tirée au hasard (xorshift propre au fil)
+// ============================================================================
+static PoolRange *stealAny(void) {
+    static _Thread_local uint32_t state = 0;
+    int count = workerCount;
+    int victims = count + atomic_load(&callerCount);
+
+    if (victims < 2)
+        return NULL;  // Aucun autre fil
+    if (state == 0)
+        state = 2654435761u * (uint32_t)(self + 1);
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    for (int k = 0, start = (int)(state % (uint32_t)victims); k < victims; k++) {
+        int v = (start + k) % victims;
+        int s = v < count ? v : POOL_MAX_THREADS + (v - count);
+        if (s == self)
+            continue;
+        PoolRange *r = dequeSteal(&deques[s]);
+        if (r) {
+            atomic_fetch_add_explicit(&deques[self].steals, 1, memory_order_relaxed);
+            return r;
+        }
+    }
+    return NULL;
+}
+
+// ============================================================================
+// FONCTION : wakeIdle (interne)
+// DESCRIPTION : Réveille les fils endormis après le dépôt d'une tranche
+//               (la barrière répond à celle de workerSleep : l'un des deux
+//               voit toujours l'écriture de l'autre)
+// ============================================================================
+static void wakeIdle(void) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load(&sleepers) > 0) {
+        pthread_mutex_lock(&lock);
+        wakeups++;
+        pthread_cond_broadcast(&wake);
+        pthread_mutex_unlock(&lock);
+    }
+}
+
+// ============================================================================
+// FONCTION : runRange (interne)
+// DESCRIPTION : Découpe paresseusement une tranche (la moitié haute, alignée
+//               sur grain, part dans la file du fil), exécute la partie basse
+//               puis décompte les indices traités
+// ============================================================================
+static void runRange(PoolRange *r) {
+    PoolJob *job = r->job;
+    int begin = r->begin, end = r->end;
+    Deque *d = &deques[self];
+
+    free(r);
+    while (end - begin > job->grain) {
+        int slices = (end - begin + job->grain - 1) / job->grain;
+        int mid = begin + slices / 2 * job->grain;
+        PoolRange *half = malloc(sizeof(PoolRange));
+        if (!half)
+            break;
+        *half = (PoolRange){job, mid, end};
+        if (!dequePush(d, half)) {
+            free(half);
+            break;
+        }
+        wakeIdle();
+        end = mid;
+    }
+
+    for (int b = begin; b < end; b += job->grain)
+        job->task(job->ctx, b, b + job->grain < end ? b + job->grain : end);
+    atomic_fetch_add_explicit(&d->tasks, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&job->remaining, end - begin, memory_order_release);
+}
+
+// ============================================================================
+// FONCTION : workerSleep (interne)
+// DESCRIPTION : Endort un fil auxiliaire tant qu'aucune file n'a de tranche
+// ============================================================================
+static void workerSleep(void) {
+    pthread_mutex_lock(&lock);
+    atomic_fetch_add(&sleepers, 1);
+    int empty = 1;
+    for (int s = 0; s < POOL_SLOTS && empty; s++)
+        if (activeSlot(s) && atomic_load(&deques[s].top) < atomic_load(&deques[s].bottom))
+            empty = 0;
+    if (empty) {
+        unsigned long seen = wakeups;
+        while (seen == wakeups && !atomic_load(&stopping))
+            pthread_cond_wait(&wake, &lock);
+    }
+    atomic_fetch_sub(&sleepers, 1);
+    pthread_mutex_unlock(&lock);
+}
+
+// ============================================================================
+// FONCTION : workerMain (interne)
+// DESCRIPTION : Boucle d'un fil auxiliaire : sa file d'abord, puis vol,
+//               puis sommeil après IDLE_SPINS recherches infructueuses
+// ============================================================================
+static void *workerMain(void *arg) {
+    int spins = 0;
+
+    self = (int)(intptr_t)arg;
+    idleBegin(&deques[self]);
+    while (!atomic_load(&stopping)) {
+        PoolRange *r = dequePop(&deques[self]);
+        if (!r)
+            r = stealAny();
+        if (r) {
+            idleEnd(&deques[self]);
+            runRange(r);
+            idleBegin(&deques[self]);
+            spins = 0;
+        } else if (++spins < IDLE_SPINS) {
+            sched_yield();
+        } else {
+            workerSleep();
+            spins = 0;
+        }
+    }
+    idleEnd(&deques[self]);
+    return NULL;
+}
+
+// ============================================================================
+// FONCTION : poolShutdown
+// DESCRIPTION : Arrête les fils auxiliaires
+// ============================================================================
+void poolShutdown(void) {
+    if (!started)
+        return;
+
+    pthread_mutex_lock(&lock);
+    atomic_store(&stopping, 1);
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&lock);
+
+    for (int i = 0; i < workerCount; i++)
+        pthread_join(workers[i], NULL);
+
+    workerCount = 0;
+    atomic_store(&stopping, 0);
+    started = 0;
+}
+
+// ============================================================================
+// FONCTION : poolInit
+// DESCRIPTION : Démarre threads - 1 fils auxiliaires
+// ============================================================================
+int poolInit(int threads) {
+    poolShutdown();
+
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (int)cpus : 1;
+    }
+    if (threads > POOL_MAX_THREADS)
+        threads = POOL_MAX_THREADS;
+
+    poolResetStats();
+    for (int i = 0; i < threads - 1; i++) {
+        if (pthread_create(&workers[workerCount], NULL, workerMain, (void *)(intptr_t)i) != 0)
+            break;  // Moins de fils que demandé : le groupe reste utilisable
+        workerCount++;
+    }
+
+    started = 1;
+    return workerCount + 1;
+}
+
+// ============================================================================
+// FONCTION : poolThreads
+// DESCRIPTION : Nombre de fils, appelant compris
+// ============================================================================
+int poolThreads(void) {
+    if (!started)
+        poolInit(0);
+    return workerCount + 1;
+}
+
+// ============================================================================
+// FONCTION : poolParallelFor
+// DESCRIPTION : Dépose la boucle entière comme une tranche, l'exécute (en la
+//               découpant) puis aide jusqu'à ce que les tranches volées soient
+//               terminées : sa propre file d'abord, puis vol
+// ============================================================================
+void poolParallelFor(int count, int grain, PoolTask task, void *ctx) {
+    if (count <= 0)
+        return;
+    if (grain < 1)
+        grain = 1;
+
+    // Fil extérieur : attribution d'une file au premier appel
+    if (self < 0 && poolThreads() > 1) {
+        int caller = atomic_fetch_add(&callerCount, 1);
+        if (caller < POOL_MAX_CALLERS)
+            self = POOL_MAX_THREADS + caller;
+        else
+            atomic_fetch_sub(&callerCount, 1);
+    }
+
+    // Petit travail, groupe réduit à l'appelant ou plus de file : en séquence
+    PoolRange *r = NULL;
+    if (self < 0 || poolThreads() == 1 || count <= grain || !(r = malloc(sizeof(PoolRange)))) {
+        task(ctx, 0, count);
+        return;
+    }
+
+    PoolJob job = {task, ctx, grain, count};
+    *r = (PoolRange){&job, 0, count};
+    runRange(r);
+
+    Deque *d = &deques[self];
+    while (atomic_load_explicit(&job.remaining, memory_order_acquire) > 0) {
+        PoolRange *next = dequePop(d);
+        if (!next)
+            next = stealAny();
+        if (next) {
+            idleEnd(d);
+            runRange(next);
+        } else {
+            idleBegin(d);
+            sched_yield();
+        }
+    }
+    idleEnd(d);
+}
+
+// ============================================================================
+// FONCTION : poolResetStats
+// DESCRIPTION : Compteurs à zéro ; une inactivité en cours repart de maintenant
+// ============================================================================
+void poolResetStats(void) {
+    uint64_t now = chronoNowNs();
+
+    statsStart = now;
+    for (int s = 0; s < POOL_SLOTS; s++) {
+        Deque *d = &deques[s];
+        uint64_t since = atomic_load(&d->idleSince);
+        atomic_store(&d->tasks, 0);
+        atomic_store(&d->steals, 0);
+        atomic_store(&d->idleNs, 0);
+        if (since != 0)
+            atomic_compare_exchange_strong(&d->idleSince, &since, now);
+    }
+}
+
+// ============================================================================
+// FONCTION : poolStats
+// DESCRIPTION : Inactivité en cours comptée jusqu'à maintenant
+// ============================================================================
+int poolStats(PoolWorkerStats *out, int max) {
+    uint64_t now = chronoNowNs();
+    int n = 0;
+
+    for (int s = 0; s < POOL_SLOTS && n < max; s++) {
+        if (!activeSlot(s))
+            continue;
+        Deque *d = &deques[s];
+        uint64_t since = atomic_load(&d->idleSince);
+        out[n].caller = s >= POOL_MAX_THREADS;
+        out[n].tasks = atomic_load(&d->tasks);
+        out[n].steals = atomic_load(&d->steals);
+        out[n].idleNs = atomic_load(&d->idleNs) + (since != 0 && since < now ? now - since : 0);
+        out[n].wallNs = now - statsStart;
+        if (out[n].idleNs > out[n].wallNs)
+            out[n].idleNs = out[n].wallNs;
+        n++;
+    }
+    return n;
+}
@@ -0,0 +1,255 @@
+// Inclusion des bibliothèques nécessaires
+#include <string.h>     // Pour memcpy
+#include "proto.h"      // Déclarations du protocole (prototypes)
+#include "utils.h"      // clearGrid, canPlaceShip, canPlaceShip5x2Manual, markShipSunk
+
+// Taille des charges par type (octet de type non compris)
+static const uint16_t payloadSize[MSG_TYPES] = {
+    [MSG_HELLO] = 1,
+    [MSG_MATCHED] = 1,
+    [MSG_PLACE] = 3 * SHIP_COUNT,
+    [MSG_START] = 4,
+    [MSG_FIRE] = 2,
+    [MSG_RESULT] = 5,
+    [MSG_OVER] = 2,
+    [MSG_ERROR] = 1,
+    [MSG_WATCH] = 5,
+    [MSG_KEYFRAME] = 1 + 2 * GRID * GRID,
+    [MSG_DELTA] = 2,
+};
+
+// ============================================================================
+// FONCTIONS : putU32 / getU32 (internes)
+// DESCRIPTION : Entiers sur quatre octets, petit-boutistes
+// ============================================================================
+static void putU32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t getU32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// ============================================================================
+// FONCTION : protoSize
+// DESCRIPTION : Taille totale d'un message selon son type
+// ============================================================================
+size_t protoSize(int type) {
+    if (type < MSG_HELLO || type >= MSG_TYPES)
+        return 0;
+    return 1 + (size_t)payloadSize[type];
+}
+
+// ============================================================================
+// FONCTION : protoEncode
+// DESCRIPTION : Type puis charge ; les entiers sur deux octets sont petit-boutistes
+// ============================================================================
+size_t protoEncode(const ProtoMsg *msg, uint8_t *buf, size_t cap) {
+    size_t size = protoSize(msg->type);
+
+    if (size == 0 || size > cap)
+        return 0;
+
+    buf[0] = (uint8_t)msg->type;
+    switch (msg->type) {
+    case MSG_HELLO:   buf[1] = msg->u.version; break;
+    case MSG_MATCHED: buf[1] = msg->u.seat; break;
+    case MSG_PLACE:
+        for (int s = 0; s < SHIP_COUNT; s++) {
+            buf[1 + 3 * s] = msg->u.fleet[s].x;
+            buf[2 + 3 * s] = msg->u.fleet[s].y;
+            buf[3 + 3 * s] = msg->u.fleet[s].vertical;
+        }
+        break;
+    case MSG_FIRE:
+        buf[1] = msg->u.fire.x;
+        buf[2] = msg->u.fire.y;
+        break;
+    case MSG_RESULT:
+        buf[1] = msg->u.result.seat;
+        buf[2] = msg->u.result.x;
+        buf[3] = msg->u.result.y;
+        buf[4] = (uint8_t)((uint16_t)msg->u.result.cell & 0xFF);
+        buf[5] = (uint8_t)((uint16_t)msg->u.result.cell >> 8);
+        break;
+    case MSG_OVER:
+        buf[1] = msg->u.over.winner;
+        buf[2] = msg->u.over.reason;
+        break;
+    case MSG_ERROR:   buf[1] = msg->u.error; break;
+    case MSG_START:   putU32(buf + 1, msg->u.match); break;
+    case MSG_WATCH:
+        buf[1] = msg->u.watch.version;
+        putU32(buf + 2, msg->u.watch.match);
+        break;
+    case MSG_KEYFRAME:
+        buf[1] = msg->u.keyframe.current;
+        memcpy(buf + 2, msg->u.keyframe.cells, sizeof(msg->u.keyframe.cells));
+        break;
+    case MSG_DELTA: {
+        // Grille sur 1 bit, case sur 8 bits, code sur 6 bits
+        unsigned packed = (unsigned)msg->u.delta.board << 15 | (unsigned)msg->u.delta.index << 6
+                        | (msg->u.delta.code & 0x3F);
+        buf[1] = (uint8_t)packed;
+        buf[2] = (uint8_t)(packed >> 8);
+        break;
+    }
+    default: break;
+    }
+    return size;
+}
+
+// ============================================================================
+// FONCTION : protoDecode
+// DESCRIPTION : Attend que le message soit complet avant de le lire
+// ============================================================================
+int protoDecode(const uint8_t *buf, size_t len, ProtoMsg *msg) {
+    if (len == 0)
+        return 0;
+    size_t size = protoSize(buf[0]);
+    if (size == 0)
+        return -1;
+    if (len < size)
+        return 0;
+
+    msg->type = (MsgType)buf[0];
+    switch (msg->type) {
+    case MSG_HELLO:   msg->u.version = buf[1]; break;
+    case MSG_MATCHED: msg->u.seat = buf[1]; break;
+    case MSG_PLACE:
+        for (int s = 0; s < SHIP_COUNT; s++) {
+            msg->u.fleet[s].x = buf[1 + 3 * s];
+            msg->u.fleet[s].y = buf[2 + 3 * s];
+            msg->u.fleet[s].vertical = buf[3 + 3 * s];
+        }
+        break;
+    case MSG_FIRE:
+        msg->u.fire.x = buf[1];
+        msg->u.fire.y = buf[2];
+        break;
+    case MSG_RESULT:
+        msg->u.result.seat = buf[1];
+        msg->u.result.x = buf[2];
+        msg->u.result.y = buf[3];
+        msg->u.result.cell = (int16_t)(uint16_t)(buf[4] | (buf[5] << 8));
+        break;
+    case MSG_OVER:
+        msg->u.over.winner = buf[1];
+        msg->u.over.reason = buf[2];
+        break;
+    case MSG_ERROR:   msg->u.error = buf[1]; break;
+    case MSG_START:   msg->u.match = getU32(buf + 1); break;
+    case MSG_WATCH:
+        msg->u.watch.version = buf[1];
+        msg->u.watch.match = getU32(buf + 2);
+        break;
+    case MSG_KEYFRAME:
+        msg->u.keyframe.current = buf[1];
+        memcpy(msg->u.keyframe.cells, buf + 2, sizeof(msg->u.keyframe.cells));
+        break;
+    case MSG_DELTA: {
+        unsigned packed = (unsigned)buf[1] | (unsigned)buf[2] << 8;
+        msg->u.delta.board = (uint8_t)(packed >> 15);
+        msg->u.delta.index = (uint8_t)(packed >> 6);
+        msg->u.delta.code = (uint8_t)(packed & 0x3F);
+        break;
+    }
+    default: break;
+    }
+    return (int)size;
+}
+
+// ============================================================================
+// FONCTIONS : protoCellCode / protoCellValue
+// DESCRIPTION : Les quatre états d'une case (intact, touché, manqué, coulé)
+//               dans les deux bits de poids fort, l'id du bateau dessous
+// ============================================================================
+uint8_t protoCellCode(int v) {
+    if (v >= 0) return (uint8_t)v;                   // Eau (0) ou bateau intact
+    if (v == -99) return 0x20;                       // Manqué
+    if (v <= -200) return (uint8_t)(0x30 | (-200 - v));  // Coulé
+    return (uint8_t)(0x10 | -v);                     // Touché
+}
+
+int protoCellValue(uint8_t code) {
+    int id = code & 0x0F;
+
+    switch (code & 0x30) {
+    case 0x10: return -id;
+    case 0x20: return -99;
+    case 0x30: return -200 - id;
+    default:   return id;
+    }
+}
+
+// ============================================================================
+// FONCTION : protoApplyCell
+// DESCRIPTION : Même effet qu'un tir résolu sur la vraie grille (markShipSunk)
+// ============================================================================
+void protoApplyCell(int g[GRID][GRID], int x, int y, int cell) {
+    g[x][y] = cell;
+    if (cell <= -200)
+        markShipSunk(g, -200 - cell);
+}
+
+// ============================================================================
+// FONCTION : protoPlaceFleet
+// DESCRIPTION : Place les bateaux un à un avec les vérifications du placement
+//               manuel ; la grille est vidée si un bateau est refusé
+// ============================================================================
+int protoPlaceFleet(const ProtoShip fleet[SHIP_COUNT], const ShipConfig *config, int g[GRID][GRID]) {
+    clearGrid(g);
+
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        int x = fleet[s].x, y = fleet[s].y, vertical = fleet[s].vertical != 0;
+        int size = config->sizes[s];
+        int width, height;
+
+        if (fleet[s].vertical > 1 || x >= GRID || y >= GRID)
+            break;
+        if (size > 0) {
+            if (!canPlaceShip(g, x, y, size, vertical))
+                break;
+            width = vertical ? 1 : size;
+            height = vertical ? size : 1;
+        } else {
+            if (!canPlaceShip5x2Manual(g, x, y, vertical))
+                break;
+            width = vertical ? 2 : 5;
+            height = vertical ? 5 : 2;
+        }
+        for (int i = 0; i < height; i++)
+            for (int j = 0; j < width; j++)
+                g[x + i][y + j] = s + 1;
+
+        if (s == SHIP_COUNT - 1)
+            return 1;
+    }
+    clearGrid(g);
+    return 0;
+}
+
+// ============================================================================
+// FONCTION : protoFleetFromGrid
+// DESCRIPTION : Coin supérieur gauche et sens de chaque bateau (vertical si
+//               le bateau est plus haut que large)
+// ============================================================================
+void protoFleetFromGrid(int g[GRID][GRID], ProtoShip fleet[SHIP_COUNT]) {
+    for (int s = 0; s < SHIP_COUNT; s++) {
+        int top = GRID, left = GRID, bottom = -1, right = -1;
+        for (int i = 0; i < GRID; i++)
+            for (int j = 0; j < GRID; j++)
+                if (g[i][j] == s + 1) {
+                    if (i < top) top = i;
+                    if (i > bottom) bottom = i;
+                    if (j < left) left = j;
+                    if (j > right) right = j;
+                }
+        fleet[s].x = (uint8_t)top;
+        fleet[s].y = (uint8_t)left;
+        fleet[s].vertical = (bottom - top) > (right - left);
+    }
+}
@@ -1,8 +1,6 @@
-// Inclusion de la bibliothèque SDL3 pour les fonctions de temps éventuellement utilisées ailleurs
-#include <SDL3/SDL.h>
-
 // Inclusion du fichier d'en-tête contenant les définitions de types personnalisés
 // Ce fichier contient probablement la déclaration de la variable 'seed' utilisée ci-dessous
+#include <stdint.h>     // Pour uint32_t
 #include "types.h"
 
 // Inclusion du fichier d'en-tête correspondant à ce fichier source
@@ -27,7 +25,10 @@ int myRand() {
     // seed doit être une variable globale de type unsigned int (32 bits)
     // Opération : seed = (seed * 1103515245) + 12345
     // Note : Le modulo 2³² est implicite via le dépassement d'entier non signé 32 bits
-    seed = seed * 1103515245 + 12345;
+    // Calcul explicite sur 32 bits : la suite est la même quelle que soit la
+    // largeur de unsigned int : une partie en réseau rejouée avec les mêmes
+    // graines donne les mêmes flottes et les mêmes tirs sur toutes les machines
+    seed = (uint32_t)((uint32_t)seed * 1103515245u + 12345u);
     
     // Étape 2 : Extraction des bits 16 à 30 (15 bits) pour obtenir un nombre entre 0 et 32767
     // (seed >> 16) : décale la graine de 16 bits vers la droite (supprime les 16 bits de poids faible)
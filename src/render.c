@@ -1,9 +1,29 @@
 // Inclusion des bibliothèques nécessaires
 #include <SDL3/SDL.h>   // Bibliothèque graphique SDL3
+#include <stdio.h>      // Pour snprintf (showInfoBox)
+#include <string.h>     // Pour memset (tableau de bord)
 #include "types.h"      // Définitions des types personnalisés (GraphicsContext, Player, etc.)
 #include "utils.h"      // Fonctions utilitaires (canPlaceShip, canPlaceShip5x2Manual, etc.)
 #include "render.h"     // Déclarations des fonctions de rendu (prototypes)
 
+// Contexte graphique SDL (fenêtre et renderer)
+// Stocke les pointeurs vers la fenêtre SDL et le renderer pour le dessin
+GraphicsContext graphics;
+
+// Horloge des animations (now à NULL = temps SDL)
+static EngineClock animationClock = {NULL, NULL};
+
+// ============================================================================
+// FONCTION : renderSetClock
+// DESCRIPTION : Remplace l'horloge des animations
+// PARAMÈTRES :
+//   - clock : horloge en millisecondes
+// RETOUR : aucun (void)
+// ============================================================================
+void renderSetClock(EngineClock clock) {
+    animationClock = clock;
+}
+
 // ============================================================================
 // FONCTION : drawGradientRect
 // DESCRIPTION : Dessine un rectangle avec dégradé de couleur linéaire vertical
@@ -702,8 +722,9 @@ void drawMissedShot(GraphicsContext *gfx, int x, int y, int size, Uint32 time) {
 // RETOUR : aucun (void)
 // ============================================================================
 void drawGrid(GraphicsContext *gfx, int g[GRID][GRID], int offsetX, int reveal) {
-    // Récupère le temps actuel pour les animations
-    Uint32 currentTime = SDL_GetTicks();
+    // Récupère le temps actuel pour les animations (horloge virtuelle si choisie)
+    Uint32 currentTime = animationClock.now ? (Uint32)animationClock.now(animationClock.ctx)
+                                            : (Uint32)SDL_GetTicks();
     
     // Parcourt toutes les cellules de la grille
     for (int i = 0; i < GRID; i++) {
@@ -1090,4 +1111,170 @@ void placeShipsSDL(GraphicsContext *gfx, Player *p, ShipConfig *config, int play
             }
         }
     }
+}
+
+// ============================================================================
+// FONCTION : showInfoBox
+// DESCRIPTION : Affiche une boîte de dialogue d'information SDL
+// PARAMÈTRES :
+//   - window : fenêtre SDL parente
+//   - format : format du message (comme printf)
+//   - a, b   : valeurs à formater
+// RETOUR : aucun (void)
+// ============================================================================
+void showInfoBox(SDL_Window *window, const char *format, int a, int b) {
+    char buf[256];  // Buffer pour le message formaté
+    snprintf(buf, sizeof(buf), format, a, b);  // Formate le message
+    SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Info", buf, window);
+}
+
+// ============================================================================
+// TABLEAU DE BORD DES SPECTATEURS
+// ============================================================================
+
+// Couleurs des sprites par état de case (SpectateCell)
+static const Uint8 dashColors[SPECTATE_KINDS][3] = {
+    {20, 60, 110},    // Eau
+    {120, 130, 140},  // Bateau intact
+    {170, 200, 230},  // Tir dans l'eau
+    {240, 140, 30},   // Touché
+    {140, 20, 20},    // Coulé
+};
+
+#define DASH_MAX_QUADS (SPECTATE_BOARDS * 2 * GRID * GRID)
+
+static SDL_Texture *dashAtlas = NULL;    // Planche de sprites (un par état)
+static SDL_Texture *dashCanvas = NULL;   // Toile : cases déjà dessinées
+static uint8_t dashShown[SPECTATE_BOARDS][2][GRID][GRID];  // États sur la toile
+static uint32_t dashVersion[SPECTATE_BOARDS];               // Versions sur la toile
+static int dashWinner[SPECTATE_BOARDS];                     // Vainqueurs affichés
+static SDL_Vertex dashVertices[DASH_MAX_QUADS * 4];
+static int dashIndices[DASH_MAX_QUADS * 6];
+
+// ============================================================================
+// FONCTION : dashboardInit
+// DESCRIPTION : Dessine la planche de sprites et efface la toile
+// PARAMÈTRES :
+//   - gfx : contexte graphique
+// RETOUR : 1 si les textures sont prêtes, 0 sinon
+// ============================================================================
+int dashboardInit(GraphicsContext *gfx) {
+    dashAtlas = SDL_CreateTexture(gfx->renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                  SPECTATE_KINDS * DASH_CELL, DASH_CELL);
+    dashCanvas = SDL_CreateTexture(gfx->renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                   WIDTH, HEIGHT);
+    if (!dashAtlas || !dashCanvas) {
+        dashboardFree();
+        return 0;
+    }
+    SDL_SetTextureScaleMode(dashAtlas, SDL_SCALEMODE_NEAREST);  // Sprites au pixel près
+
+    // Un sprite par état : case pleine, bord droit et bas sombres (grille)
+    SDL_SetRenderTarget(gfx->renderer, dashAtlas);
+    SDL_SetRenderDrawColor(gfx->renderer, 5, 10, 20, 255);
+    SDL_RenderClear(gfx->renderer);
+    for (int k = 0; k < SPECTATE_KINDS; k++) {
+        SDL_FRect r = {(float)(k * DASH_CELL), 0, DASH_CELL - 1, DASH_CELL - 1};
+        SDL_SetRenderDrawColor(gfx->renderer, dashColors[k][0], dashColors[k][1], dashColors[k][2], 255);
+        SDL_RenderFillRect(gfx->renderer, &r);
+    }
+
+    SDL_SetRenderTarget(gfx->renderer, dashCanvas);
+    SDL_SetRenderDrawColor(gfx->renderer, 0, 0, 0, 255);
+    SDL_RenderClear(gfx->renderer);
+    SDL_SetRenderTarget(gfx->renderer, NULL);
+
+    // Rien n'est encore sur la toile : la première image dessine tout
+    memset(dashShown, 0xFF, sizeof(dashShown));
+    memset(dashVersion, 0, sizeof(dashVersion));
+    for (int b = 0; b < SPECTATE_BOARDS; b++)
+        dashWinner[b] = -1;
+
+    // Les indices des quads ne changent jamais
+    for (int q = 0; q < DASH_MAX_QUADS; q++) {
+        int *idx = &dashIndices[q * 6];
+        idx[0] = q * 4;     idx[1] = q * 4 + 1; idx[2] = q * 4 + 2;
+        idx[3] = q * 4 + 2; idx[4] = q * 4 + 3; idx[5] = q * 4;
+    }
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : dashQuad (interne)
+// DESCRIPTION : Ajoute au lot le sprite d'un état à une position de la toile
+// ============================================================================
+static void dashQuad(int q, float x, float y, int kind) {
+    SDL_Vertex *v = &dashVertices[q * 4];
+    float u0 = (float)kind / SPECTATE_KINDS;
+    float u1 = (float)(kind + 1) / SPECTATE_KINDS;
+    SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    v[0] = (SDL_Vertex){{x, y}, white, {u0, 0.0f}};
+    v[1] = (SDL_Vertex){{x + DASH_CELL, y}, white, {u1, 0.0f}};
+    v[2] = (SDL_Vertex){{x + DASH_CELL, y + DASH_CELL}, white, {u1, 1.0f}};
+    v[3] = (SDL_Vertex){{x, y + DASH_CELL}, white, {u0, 1.0f}};
+}
+
+// ============================================================================
+// FONCTION : dashboardDraw
+// DESCRIPTION : Met à jour la toile avec les cases changées et l'affiche
+// PARAMÈTRES :
+//   - gfx : contexte graphique
+// RETOUR : nombre de cases redessinées
+// ============================================================================
+int dashboardDraw(GraphicsContext *gfx) {
+    static BoardSnapshot snap;
+    int quads = 0;
+
+    for (int b = 0; b < SPECTATE_BOARDS; b++) {
+        if (spectateVersion(b) == dashVersion[b] || !spectateRead(b, &snap))
+            continue;  // Plateau inchangé depuis la dernière image
+        dashVersion[b] = snap.version;
+        dashWinner[b] = snap.winner;
+
+        float ox = (float)((b % DASH_COLS) * 2 * GRID * DASH_CELL);
+        float oy = (float)((b / DASH_COLS) * GRID * DASH_CELL);
+        for (int p = 0; p < 2; p++)
+            for (int i = 0; i < GRID; i++)
+                for (int j = 0; j < GRID; j++) {
+                    if (snap.cells[p][i][j] == dashShown[b][p][i][j])
+                        continue;
+                    dashShown[b][p][i][j] = snap.cells[p][i][j];
+                    dashQuad(quads++, ox + (p * GRID + j) * DASH_CELL, oy + i * DASH_CELL,
+                             snap.cells[p][i][j]);
+                }
+    }
+
+    // Un seul lot pour toutes les cases changées, dessiné sur la toile
+    if (quads > 0) {
+        SDL_SetRenderTarget(gfx->renderer, dashCanvas);
+        SDL_RenderGeometry(gfx->renderer, dashAtlas, dashVertices, quads * 4, dashIndices, quads * 6);
+        SDL_SetRenderTarget(gfx->renderer, NULL);
+    }
+    SDL_RenderTexture(gfx->renderer, dashCanvas, NULL, NULL);
+
+    // Cadres : séparation des plateaux, grille gagnante en or
+    for (int b = 0; b < SPECTATE_BOARDS; b++) {
+        float ox = (float)((b % DASH_COLS) * 2 * GRID * DASH_CELL);
+        float oy = (float)((b / DASH_COLS) * GRID * DASH_CELL);
+        SDL_FRect frame = {ox, oy, 2 * GRID * DASH_CELL, GRID * DASH_CELL};
+        SDL_SetRenderDrawColor(gfx->renderer, 60, 60, 60, 255);
+        SDL_RenderRect(gfx->renderer, &frame);
+        if (dashWinner[b] >= 0) {
+            SDL_FRect win = {ox + dashWinner[b] * GRID * DASH_CELL, oy, GRID * DASH_CELL, GRID * DASH_CELL};
+            SDL_SetRenderDrawColor(gfx->renderer, 255, 210, 0, 255);
+            SDL_RenderRect(gfx->renderer, &win);
+        }
+    }
+    return quads;
+}
+
+// ============================================================================
+// FONCTION : dashboardFree
+// DESCRIPTION : Libère la planche de sprites et la toile
+// ============================================================================
+void dashboardFree(void) {
+    if (dashAtlas) SDL_DestroyTexture(dashAtlas);
+    if (dashCanvas) SDL_DestroyTexture(dashCanvas);
+    dashAtlas = dashCanvas = NULL;
 }
\ No newline at end of file
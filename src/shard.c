@@ -0,0 +1,468 @@
+// Active fork, mmap et sched_setaffinity avec -std=c11 (fonctions POSIX et GNU)
+#define _GNU_SOURCE
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour fflush, fopen, rename
+#include <string.h>     // Pour memset, memcmp, strncpy
+#include "shard.h"      // Déclarations de la simulation répartie (prototypes)
+
+#if !defined(_WIN32)
+#include <time.h>       // Pour nanosleep
+#include <unistd.h>     // Pour fork, _exit
+#include <sys/mman.h>   // Pour mmap, munmap
+#include <sys/wait.h>   // Pour waitpid
+#include <signal.h>     // Pour kill
+#if defined(__linux__)
+#include <sched.h>      // Pour sched_getaffinity, sched_setaffinity
+#endif
+#endif
+
+// ============================================================================
+// FONCTION : shardCreate
+// DESCRIPTION : Zone anonyme partagée, héritée par les fils au fork ; les
+//               emplacements sont à zéro (aucune partie jouée)
+// ============================================================================
+ShardRun *shardCreate(int shards, int first, int games) {
+#if !defined(_WIN32)
+    if (shards < 1 || shards > SHARD_MAX || games < 0)
+        return NULL;
+
+    void *p = mmap(NULL, sizeof(ShardRun), PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+        return NULL;
+
+    ShardRun *run = p;
+    run->shards = shards;
+    run->first = first;
+    run->games = games;
+    for (int s = 0; s < shards; s++) {
+        ShardSlot *slot = &run->slots[s];
+        slot->first = first + (int)((long long)games * s / shards);
+        slot->end = first + (int)((long long)games * (s + 1) / shards);
+        atomic_store(&slot->copies[0].next, slot->first);
+        atomic_store(&slot->copies[1].next, slot->first);
+        slot->state = SHARD_IDLE;
+    }
+    return run;
+#else
+    (void)shards;
+    (void)first;
+    (void)games;
+    return NULL;
+#endif
+}
+
+// ============================================================================
+// FONCTION : shardFree
+// DESCRIPTION : Libère la zone partagée
+// ============================================================================
+void shardFree(ShardRun *run) {
+#if !defined(_WIN32)
+    if (run)
+        munmap(run, sizeof(ShardRun));
+#else
+    (void)run;
+#endif
+}
+
+#if defined(__linux__)
+// ============================================================================
+// FONCTION : shardPin (interne)
+// DESCRIPTION : Épingle le processus courant sur la part n°index (sur count)
+//               des processeurs autorisés ; plus de fragments que de
+//               processeurs : un processeur chacun, à tour de rôle
+// RETOUR : nombre de processeurs de la part (0 si l'épinglage a échoué)
+// ============================================================================
+static int shardPin(const cpu_set_t *allowed, int index, int count) {
+    int cpus[CPU_SETSIZE];
+    int n = 0;
+    for (int c = 0; c < CPU_SETSIZE; c++)
+        if (CPU_ISSET(c, allowed))
+            cpus[n++] = c;
+    if (n == 0)
+        return 0;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    int from = (int)((long long)n * index / count);
+    int to = (int)((long long)n * (index + 1) / count);
+    if (to <= from)
+        to = from + 1;
+    for (int c = from; c < to; c++)
+        CPU_SET(cpus[c % n], &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        return 0;
+    return to - from;
+}
+#endif
+
+// ============================================================================
+// FONCTION : shardLaunch
+// DESCRIPTION : Un fork par fragment ; le fils s'épingle, joue sa plage et se
+//               termine par _exit (sans repasser par le code de l'appelant)
+// ============================================================================
+int shardLaunch(ShardRun *run, ShardMain fn, void *ctx) {
+#if !defined(_WIN32)
+    int launched = 0;
+#if defined(__linux__)
+    cpu_set_t allowed;
+    int pinning = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+#endif
+
+    fflush(NULL);  // Sinon le fils réécrirait les tampons de l'appelant
+    for (int s = 0; s < run->shards; s++) {
+        ShardSlot *slot = &run->slots[s];
+        pid_t pid = fork();
+
+        if (pid == 0) {
+            slot->cpus = 0;
+#if defined(__linux__)
+            if (pinning)
+                slot->cpus = shardPin(&allowed, s, run->shards);
+#endif
+            int code = fn(slot, ctx);
+            fflush(NULL);
+            _exit(code);
+        }
+        if (pid < 0) {
+            slot->state = SHARD_FAILED;
+            continue;
+        }
+        slot->pid = (int)pid;
+        slot->state = SHARD_RUNNING;
+        launched++;
+    }
+    return launched;
+#else
+    (void)run;
+    (void)fn;
+    (void)ctx;
+    return 0;
+#endif
+}
+
+// ============================================================================
+// FONCTION : shardStop
+// DESCRIPTION : SIGTERM à chaque fragment en cours
+// ============================================================================
+void shardStop(ShardRun *run) {
+#if !defined(_WIN32)
+    for (int s = 0; s < run->shards; s++)
+        if (run->slots[s].state == SHARD_RUNNING)
+            kill((pid_t)run->slots[s].pid, SIGTERM);
+#else
+    (void)run;
+#endif
+}
+
+// ============================================================================
+// FONCTION : shardWait
+// DESCRIPTION : Sonde les fils sans bloquer toutes les 10 ms jusqu'au délai
+//               ou à la première fin ; un fils qui sort avant la fin de sa
+//               plage ou sur un signal est marqué en échec
+// ============================================================================
+int shardWait(ShardRun *run, int timeoutMs) {
+#if !defined(_WIN32)
+    struct timespec step = {0, 10 * 1000000L};
+    int waited = 0;
+
+    for (;;) {
+        int running = 0, reaped = 0;
+        for (int s = 0; s < run->shards; s++) {
+            ShardSlot *slot = &run->slots[s];
+            if (slot->state != SHARD_RUNNING)
+                continue;
+
+            int status;
+            if (waitpid((pid_t)slot->pid, &status, WNOHANG) != (pid_t)slot->pid) {
+                running++;
+                continue;
+            }
+            reaped++;
+            slot->signaled = WIFSIGNALED(status);
+            slot->status = slot->signaled ? WTERMSIG(status) : WEXITSTATUS(status);
+
+            ShardTotals totals;
+            int next = shardSnapshot(slot, &totals);
+            slot->state = !slot->signaled && slot->status == 0 && next >= slot->end
+                        ? SHARD_DONE : SHARD_FAILED;
+        }
+        if (running == 0 || reaped > 0 || waited >= timeoutMs)
+            return running;
+        nanosleep(&step, NULL);
+        waited += 10;
+    }
+#else
+    (void)run;
+    (void)timeoutMs;
+    return 0;
+#endif
+}
+
+// ============================================================================
+// FONCTION : shardBegin
+// DESCRIPTION : Recopie la copie publiée dans l'autre, seul le fragment
+//               écrivant ses compteurs (chargements et écritures relâchés)
+// ============================================================================
+void shardBegin(ShardSlot *slot) {
+    unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    const ShardCounters *from = &slot->copies[seq & 1];
+    ShardCounters *to = &slot->copies[(seq & 1) ^ 1];
+
+    // La copie réécrite a pu être publiée avant la dernière bascule : ces
+    // écritures ne doivent pas être vues avant la bascule (relecture)
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&to->next, atomic_load_explicit(&from->next, memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_store_explicit(&to->games, atomic_load_explicit(&from->games, memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_store_explicit(&to->wins, atomic_load_explicit(&from->wins, memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_store_explicit(&to->losses, atomic_load_explicit(&from->losses, memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_store_explicit(&to->shots, atomic_load_explicit(&from->shots, memory_order_relaxed),
+                          memory_order_relaxed);
+    for (int i = 0; i < SHARD_HIST_SIZE; i++)
+        atomic_store_explicit(&to->hist[i],
+                              atomic_load_explicit(&from->hist[i], memory_order_relaxed),
+                              memory_order_relaxed);
+}
+
+// ============================================================================
+// FONCTION : shardRecord
+// DESCRIPTION : Ajoute une partie à la copie non publiée
+// ============================================================================
+void shardRecord(ShardSlot *slot, int shots, int won) {
+    unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    ShardCounters *to = &slot->copies[(seq & 1) ^ 1];
+
+    if (shots < 0)
+        shots = 0;
+    if (shots >= SHARD_HIST_SIZE)
+        shots = SHARD_HIST_SIZE - 1;
+    atomic_fetch_add_explicit(&to->games, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(won ? &to->wins : &to->losses, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&to->shots, (unsigned long long)shots, memory_order_relaxed);
+    atomic_fetch_add_explicit(&to->hist[shots], 1, memory_order_relaxed);
+}
+
+// ============================================================================
+// FONCTION : shardEnd
+// DESCRIPTION : Publication par incrément de seq (libération : le
+//               coordinateur qui lit la nouvelle version voit la copie)
+// ============================================================================
+void shardEnd(ShardSlot *slot, int next) {
+    unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    atomic_store_explicit(&slot->copies[(seq & 1) ^ 1].next, next, memory_order_relaxed);
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_release);
+}
+
+// ============================================================================
+// FONCTION : shardSnapshot
+// DESCRIPTION : Lecture de la copie publiée, validée si seq n'a pas changé
+//               entre-temps (le fragment aurait pu commencer à la réécrire)
+// ============================================================================
+int shardSnapshot(const ShardSlot *slot, ShardTotals *out) {
+    for (;;) {
+        unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        const ShardCounters *c = &slot->copies[seq & 1];
+
+        int next = atomic_load_explicit(&c->next, memory_order_relaxed);
+        out->games = atomic_load_explicit(&c->games, memory_order_relaxed);
+        out->wins = atomic_load_explicit(&c->wins, memory_order_relaxed);
+        out->losses = atomic_load_explicit(&c->losses, memory_order_relaxed);
+        out->shots = atomic_load_explicit(&c->shots, memory_order_relaxed);
+        for (int i = 0; i < SHARD_HIST_SIZE; i++)
+            out->hist[i] = atomic_load_explicit(&c->hist[i], memory_order_relaxed);
+
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) == seq)
+            return next;
+    }
+}
+
+// ============================================================================
+// FONCTION : shardMerge
+// DESCRIPTION : Somme des copies publiées de tous les fragments
+// ============================================================================
+void shardMerge(const ShardRun *run, ShardTotals *out) {
+    memset(out, 0, sizeof(*out));
+    for (int s = 0; s < run->shards; s++) {
+        ShardTotals t;
+        shardSnapshot(&run->slots[s], &t);
+        out->games += t.games;
+        out->wins += t.wins;
+        out->losses += t.losses;
+        out->shots += t.shots;
+        for (int i = 0; i < SHARD_HIST_SIZE; i++)
+            out->hist[i] += t.hist[i];
+    }
+}
+
+// ============================================================================
+// FONCTION : shardCheckpointEmpty (interne)
+// DESCRIPTION : Point de reprise sans série pour une exécution
+// ============================================================================
+static void shardCheckpointEmpty(ShardCheckpoint *ck, uint64_t runSeed, int first, int games,
+                                 int shards) {
+    ck->runSeed = runSeed;
+    ck->first = first;
+    ck->games = games;
+    ck->shards = shards;
+    ck->sections = 0;
+}
+
+// ============================================================================
+// FONCTION : shardHeaderInit (interne)
+// DESCRIPTION : En-tête correspondant à un point de reprise
+// ============================================================================
+static void shardHeaderInit(ShardFileHeader *h, const ShardCheckpoint *ck, int sections) {
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, "BNCK", 4);
+    h->version = SHARD_CHECKPOINT_VERSION;
+    h->grid = GRID;
+    h->shards = ck->shards;
+    h->first = ck->first;
+    h->games = ck->games;
+    h->runSeed = ck->runSeed;
+    h->sections = (uint32_t)sections;
+}
+
+// ============================================================================
+// FONCTION : shardCheckpointLoad
+// DESCRIPTION : Lit l'en-tête, le compare à celui de l'exécution demandée
+//               puis lit les séries ; à la moindre erreur, point vide
+// ============================================================================
+int shardCheckpointLoad(ShardCheckpoint *ck, const char *path, uint64_t runSeed, int first,
+                        int games, int shards) {
+    ShardFileHeader h, expected;
+    FILE *f = fopen(path, "rb");
+
+    shardCheckpointEmpty(ck, runSeed, first, games, shards);
+    if (!f)
+        return 0;
+
+    int ok = fread(&h, sizeof(h), 1, f) == 1 && h.sections <= SHARD_MAX_SECTIONS;
+    if (ok) {
+        shardHeaderInit(&expected, ck, (int)h.sections);
+        ok = memcmp(&h, &expected, sizeof(h)) == 0;
+    }
+    for (int i = 0; ok && i < (int)h.sections; i++) {
+        ShardSection *sec = &ck->section[i];
+        ok = fread(sec->name, sizeof(sec->name), 1, f) == 1
+          && fread(&sec->seconds, sizeof(sec->seconds), 1, f) == 1;
+        sec->name[SHARD_NAME_SIZE - 1] = '\0';
+        for (int s = 0; ok && s < shards; s++) {
+            int32_t next;
+            uint32_t reserved;
+            ok = fread(&next, sizeof(next), 1, f) == 1
+              && fread(&reserved, sizeof(reserved), 1, f) == 1
+              && fread(&sec->totals[s], sizeof(ShardTotals), 1, f) == 1;
+            sec->next[s] = next;
+        }
+    }
+    fclose(f);
+
+    if (!ok) {
+        shardCheckpointEmpty(ck, runSeed, first, games, shards);
+        return -1;
+    }
+    ck->sections = (int)h.sections;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : shardCheckpointSave
+// DESCRIPTION : Écrit path.tmp, le vide jusqu'au disque (fsync) puis le
+//               renomme en path : rename remplace le fichier d'un coup
+// ============================================================================
+int shardCheckpointSave(const ShardCheckpoint *ck, const char *path) {
+    char tmp[1024];
+    ShardFileHeader h;
+
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp))
+        return 0;
+    FILE *f = fopen(tmp, "wb");
+    if (!f)
+        return 0;
+
+    shardHeaderInit(&h, ck, ck->sections);
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1;
+    for (int i = 0; ok && i < ck->sections; i++) {
+        const ShardSection *sec = &ck->section[i];
+        ok = fwrite(sec->name, sizeof(sec->name), 1, f) == 1
+          && fwrite(&sec->seconds, sizeof(sec->seconds), 1, f) == 1;
+        for (int s = 0; ok && s < ck->shards; s++) {
+            int32_t next = sec->next[s];
+            uint32_t reserved = 0;
+            ok = fwrite(&next, sizeof(next), 1, f) == 1
+              && fwrite(&reserved, sizeof(reserved), 1, f) == 1
+              && fwrite(&sec->totals[s], sizeof(ShardTotals), 1, f) == 1;
+        }
+    }
+    ok = fflush(f) == 0 && ok;
+#if !defined(_WIN32)
+    ok = ok && fsync(fileno(f)) == 0;
+#endif
+    ok = fclose(f) == 0 && ok;
+
+#if defined(_WIN32)
+    if (ok)
+        remove(path);  // rename ne remplace pas un fichier existant sous Windows
+#endif
+    if (!ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        return 0;
+    }
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : shardCheckpointSection
+// DESCRIPTION : Recherche par nom, sinon nouvelle série sans partie jouée
+// ============================================================================
+ShardSection *shardCheckpointSection(ShardCheckpoint *ck, const char *name) {
+    for (int i = 0; i < ck->sections; i++)
+        if (strncmp(ck->section[i].name, name, SHARD_NAME_SIZE - 1) == 0)
+            return &ck->section[i];
+    if (ck->sections == SHARD_MAX_SECTIONS)
+        return NULL;
+
+    ShardSection *sec = &ck->section[ck->sections++];
+    memset(sec, 0, sizeof(*sec));
+    strncpy(sec->name, name, SHARD_NAME_SIZE - 1);
+    for (int s = 0; s < ck->shards; s++)
+        sec->next[s] = ck->first + (int)((long long)ck->games * s / ck->shards);
+    return sec;
+}
+
+// ============================================================================
+// FONCTION : shardCapture
+// DESCRIPTION : Instantané de chaque fragment (copies publiées)
+// ============================================================================
+void shardCapture(const ShardRun *run, ShardSection *sec) {
+    for (int s = 0; s < run->shards; s++)
+        sec->next[s] = shardSnapshot(&run->slots[s], &sec->totals[s]);
+}
+
+// ============================================================================
+// FONCTION : shardRestore
+// DESCRIPTION : Écrit la série dans la copie publiée de chaque fragment
+//               (aucun processus ne lit encore la zone)
+// ============================================================================
+void shardRestore(ShardRun *run, const ShardSection *sec) {
+    for (int s = 0; s < run->shards; s++) {
+        ShardSlot *slot = &run->slots[s];
+        ShardCounters *c = &slot->copies[atomic_load(&slot->seq) & 1];
+        const ShardTotals *t = &sec->totals[s];
+
+        atomic_store(&c->next, sec->next[s]);
+        atomic_store(&c->games, t->games);
+        atomic_store(&c->wins, t->wins);
+        atomic_store(&c->losses, t->losses);
+        atomic_store(&c->shots, t->shots);
+        for (int i = 0; i < SHARD_HIST_SIZE; i++)
+            atomic_store(&c->hist[i], t->hist[i]);
+    }
+}
@@ -0,0 +1,75 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdlib.h>     // Pour aligned_alloc, calloc, free
+#include <string.h>     // Pour memset
+#include "slab.h"       // Déclarations de la table (prototypes)
+
+// ============================================================================
+// FONCTION : slabInit
+// DESCRIPTION : Bloc aligné sur 64 octets, remis à zéro (un emplacement
+//               jamais alloué peut être lu sans danger, par exemple par un
+//               parcours de toute la table) ; tous les emplacements sont
+//               chaînés dans l'ordre, pour que les premiers alloués soient
+//               contigus
+// ============================================================================
+int slabInit(Slab *s, size_t itemSize, int capacity) {
+    memset(s, 0, sizeof(*s));
+    if (capacity <= 0)
+        return 0;
+
+    s->stride = (itemSize + 63) & ~(size_t)63;
+    s->items = aligned_alloc(64, s->stride * (size_t)capacity);
+    s->next = malloc(sizeof(int) * (size_t)capacity);
+    s->gens = calloc((size_t)capacity, sizeof(uint32_t));
+    if (!s->items || !s->next || !s->gens) {
+        slabFree(s);
+        return 0;
+    }
+
+    memset(s->items, 0, s->stride * (size_t)capacity);
+    for (int i = 0; i < capacity; i++)
+        s->next[i] = i + 1 < capacity ? i + 1 : -1;
+    s->capacity = capacity;
+    s->freeHead = 0;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : slabFree
+// DESCRIPTION : Libère les trois tableaux de la table
+// ============================================================================
+void slabFree(Slab *s) {
+    free(s->items);
+    free(s->next);
+    free(s->gens);
+    memset(s, 0, sizeof(*s));
+    s->freeHead = -1;
+}
+
+// ============================================================================
+// FONCTION : slabAlloc
+// DESCRIPTION : Retire la tête de la liste des emplacements libres
+// ============================================================================
+int slabAlloc(Slab *s) {
+    int index = s->freeHead;
+
+    if (index < 0)
+        return -1;
+    s->freeHead = s->next[index];
+    s->next[index] = -1;
+    s->used++;
+    memset(slabGet(s, index), 0, s->stride);
+    return index;
+}
+
+// ============================================================================
+// FONCTION : slabRelease
+// DESCRIPTION : Change la génération (les références à l'ancien objet sont
+//               périmées) et remet l'emplacement en tête de liste : il sera
+//               réutilisé en premier, encore chaud dans le cache
+// ============================================================================
+void slabRelease(Slab *s, int index) {
+    s->gens[index]++;
+    s->next[index] = s->freeHead;
+    s->freeHead = index;
+    s->used--;
+}
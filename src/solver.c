@@ -0,0 +1,687 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdlib.h>     // Pour malloc, calloc, free
+#include <string.h>     // Pour memset
+#include "types.h"      // Définitions des types personnalisés (GRID, ShipConfig)
+#include "density.h"    // Dimensions des bateaux (densityShipShape)
+#include "chrono.h"     // Horloge monotone (budget de temps)
+#include "solver.h"     // Déclarations du solveur (prototypes)
+
+// Ensemble de cases de la grille : bit (x * GRID + y), 196 bits sur 4 mots
+#define CELL_WORDS 4
+typedef struct {
+    uint64_t w[CELL_WORDS];
+} CellSet;
+
+// Placement possible d'un bateau : cases occupées et zone interdite aux
+// autres bateaux (cases occupées et leurs 8 voisines)
+typedef struct {
+    CellSet cells;
+    CellSet halo;
+} Placement;
+
+// Nœud mémorisé : bateaux déjà posés (profondeur) et cases interdites
+// Deux suites de placements menant aux mêmes cases interdites ont les mêmes
+// complétions : c'est le sous-problème partagé
+typedef struct {
+    CellSet key;        // Cases interdites aux bateaux suivants
+    int depth;          // Nombre de bateaux posés (-1 = emplacement vide)
+    double back;        // Complétions depuis ce nœud
+    double fwd;         // Chemins depuis la racine jusqu'à ce nœud
+} MemoNode;
+
+// État d'une résolution
+typedef struct {
+    int shipCount;                          // Bateaux restant à poser
+    Placement *cands[SHIP_COUNT];           // Placements possibles par niveau
+    double *candWeight[SHIP_COUNT];         // Flottes utilisant chaque placement
+    int candCount[SHIP_COUNT];
+    CellSet reach[SHIP_COUNT + 1];          // Cases atteignables par les niveaux suivants
+    int cellsLeft[SHIP_COUNT + 1];          // Cases occupées par les niveaux suivants
+    CellSet hits;                           // Cases touchées à couvrir
+    MemoNode *memo;                         // Table de mémoïsation (adressage ouvert)
+    size_t memoCap;
+    size_t memoUsed;
+    uint64_t deadline;                      // Échéance de la tranche (0 = aucune)
+    uint64_t expansions;                    // Nœuds développés
+    int paused;                             // Échéance atteinte : reprise possible
+    int failed;                             // Borne de nœuds ou mémoire dépassée
+} Solver;
+
+// ============================================================================
+// OPÉRATIONS SUR LES ENSEMBLES DE CASES
+// ============================================================================
+// Ajoute à un ensemble les cases d'une ligne (masque de 14 bits)
+static void cellSetAddRow(CellSet *s, int x, uint16_t mask) {
+    int k = x * GRID;
+    s->w[k >> 6] |= (uint64_t)mask << (k & 63);
+    if ((k & 63) + GRID > 64)
+        s->w[(k >> 6) + 1] |= (uint64_t)mask >> (64 - (k & 63));
+}
+
+static int cellSetIntersects(const CellSet *a, const CellSet *b) {
+    return ((a->w[0] & b->w[0]) | (a->w[1] & b->w[1])
+            | (a->w[2] & b->w[2]) | (a->w[3] & b->w[3])) != 0;
+}
+
+static int cellSetIsEmpty(const CellSet *s) {
+    return (s->w[0] | s->w[1] | s->w[2] | s->w[3]) == 0;
+}
+
+static int cellSetEqual(const CellSet *a, const CellSet *b) {
+    return ((a->w[0] ^ b->w[0]) | (a->w[1] ^ b->w[1])
+            | (a->w[2] ^ b->w[2]) | (a->w[3] ^ b->w[3])) == 0;
+}
+
+// Première case de l'ensemble (-1 s'il est vide)
+static int cellSetFirst(const CellSet *s) {
+    for (int i = 0; i < CELL_WORDS; i++) {
+        if (!s->w[i])
+            continue;
+        int b = 0;
+        while (!((s->w[i] >> b) & 1))
+            b++;
+        return i * 64 + b;
+    }
+    return -1;
+}
+
+static int cellSetCount(const CellSet *s) {
+    int count = 0;
+    for (int i = 0; i < CELL_WORDS; i++)
+        for (uint64_t v = s->w[i]; v; v &= v - 1)
+            count++;
+    return count;
+}
+
+// Cases touchées pas encore couvertes par les bateaux posés
+// (la zone interdite contient les cases des bateaux posés)
+static CellSet uncoveredHitsOf(const CellSet *hits, const CellSet *forbidden) {
+    CellSet r;
+    for (int i = 0; i < CELL_WORDS; i++)
+        r.w[i] = hits->w[i] & ~forbidden->w[i];
+    return r;
+}
+
+static CellSet uncoveredHits(const Solver *s, const CellSet *forbidden) {
+    return uncoveredHitsOf(&s->hits, forbidden);
+}
+
+// ============================================================================
+// TABLE DE MÉMOÏSATION
+// ============================================================================
+static size_t memoHash(int depth, const CellSet *key) {
+    uint64_t h = (uint64_t)depth * 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < CELL_WORDS; i++) {
+        h ^= key->w[i];
+        h = (h ^ (h >> 31)) * 0xBF58476D1CE4E5B9ULL;
+    }
+    return (size_t)(h ^ (h >> 29));
+}
+
+// Recherche d'un nœud (NULL si absent)
+static MemoNode *memoFind(Solver *s, int depth, const CellSet *key) {
+    size_t i = memoHash(depth, key) & (s->memoCap - 1);
+    while (s->memo[i].depth != -1) {
+        if (s->memo[i].depth == depth && cellSetEqual(&s->memo[i].key, key))
+            return &s->memo[i];
+        i = (i + 1) & (s->memoCap - 1);
+    }
+    return NULL;
+}
+
+// Place un nœud dans une table qui a de la place (sans vérifier les doublons)
+static void memoPlace(MemoNode *table, size_t cap, const MemoNode *node) {
+    size_t i = memoHash(node->depth, &node->key) & (cap - 1);
+    while (table[i].depth != -1)
+        i = (i + 1) & (cap - 1);
+    table[i] = *node;
+}
+
+// Ajoute un nœud (la table double quand elle est à moitié pleine)
+// Retour : 0 si la borne SOLVER_MAX_NODES est atteinte ou la mémoire manque
+static int memoInsert(Solver *s, int depth, const CellSet *key, double back) {
+    if (s->memoUsed >= SOLVER_MAX_NODES)
+        return 0;
+
+    if (2 * (s->memoUsed + 1) > s->memoCap) {
+        size_t cap = s->memoCap * 2;
+        MemoNode *table = malloc(sizeof(MemoNode) * cap);
+        if (!table)
+            return 0;
+        for (size_t i = 0; i < cap; i++)
+            table[i].depth = -1;
+        for (size_t i = 0; i < s->memoCap; i++)
+            if (s->memo[i].depth != -1)
+                memoPlace(table, cap, &s->memo[i]);
+        free(s->memo);
+        s->memo = table;
+        s->memoCap = cap;
+    }
+
+    MemoNode node = {*key, depth, back, 0.0};
+    memoPlace(s->memo, s->memoCap, &node);
+    s->memoUsed++;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : placementFits (interne)
+// DESCRIPTION : Vérifie qu'un placement est compatible avec les observations :
+//               toutes ses cases sont libres et aucune case touchée ne le
+//               borde sans en faire partie (elle appartiendrait alors à un
+//               autre bateau qui le toucherait)
+// PARAMÈTRES :
+//   - span : cases d'une ligne du bateau, déjà décalées en colonne
+//   - edge : même ligne étendue d'une case à gauche et à droite
+// ============================================================================
+static int placementFits(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                         int x, int height, uint16_t span, uint16_t edge) {
+    for (int i = 0; i < height; i++)
+        if ((freeRows[x + i] & span) != span || (hitRows[x + i] & edge & ~span))
+            return 0;
+    if (x > 0 && (hitRows[x - 1] & edge))
+        return 0;
+    if (x + height < GRID && (hitRows[x + height] & edge))
+        return 0;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : buildPlacements (interne)
+// DESCRIPTION : Compte (list == NULL) ou liste les placements d'un bateau
+//               compatibles avec les observations (voir placementFits)
+// RETOUR : nombre de placements
+// ============================================================================
+static int buildPlacements(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                           int size, Placement *list) {
+    int count = 0;
+
+    for (int vertical = 0; vertical <= 1; vertical++) {
+        int width, height;
+        if (!densityShipShape(size, vertical, &width, &height))
+            continue;
+
+        for (int y = 0; y + width <= GRID; y++) {
+            uint16_t span = (uint16_t)(((1u << width) - 1) << y);
+            uint16_t edge = (uint16_t)((span | (span << 1) | (span >> 1)) & ROW_MASK);
+
+            for (int x = 0; x + height <= GRID; x++) {
+                if (!placementFits(freeRows, hitRows, x, height, span, edge))
+                    continue;
+
+                if (list) {
+                    Placement *p = &list[count];
+                    memset(p, 0, sizeof(*p));
+                    for (int i = x - 1; i <= x + height; i++) {
+                        if (i < 0 || i >= GRID)
+                            continue;
+                        cellSetAddRow(&p->halo, i, edge);
+                        if (i >= x && i < x + height)
+                            cellSetAddRow(&p->cells, i, span);
+                    }
+                }
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+// ============================================================================
+// FONCTION : countBack (interne)
+// DESCRIPTION : Nombre de façons de poser les bateaux depth..n-1 sans toucher
+//               la zone interdite, en couvrant toutes les cases touchées
+// PROPAGATION : une case touchée hors de portée des bateaux restants, ou plus
+//               de cases touchées que de cases de bateaux, coupe la branche
+// REPRISE : interrompu à l'échéance, seuls les sous-problèmes complets sont
+//           mémorisés ; le parcours suivant depuis la racine les retrouve et
+//           reprend là où il s'était arrêté
+// ============================================================================
+static double countBack(Solver *s, int depth, const CellSet *forbidden) {
+    CellSet open = uncoveredHits(s, forbidden);
+
+    if (s->paused || s->failed)
+        return 0.0;
+    if (depth == s->shipCount)
+        return cellSetIsEmpty(&open) ? 1.0 : 0.0;
+
+    // Propagation des contraintes de couverture
+    for (int i = 0; i < CELL_WORDS; i++)
+        if (open.w[i] & ~s->reach[depth].w[i])
+            return 0.0;
+    if (cellSetCount(&open) > s->cellsLeft[depth])
+        return 0.0;
+
+    // Sous-problème déjà résolu
+    MemoNode *known = memoFind(s, depth, forbidden);
+    if (known)
+        return known->back;
+
+    // Échéance de la tranche (vérifiée tous les 8 nœuds : un nœud parcourt
+    // tous les placements du bateau, la tranche ne déborde que de quelques µs)
+    if ((++s->expansions & 7) == 0 && s->deadline && chronoNowNs() > s->deadline) {
+        s->paused = 1;
+        return 0.0;
+    }
+
+    double total = 0.0;
+    for (int c = 0; c < s->candCount[depth]; c++) {
+        const Placement *p = &s->cands[depth][c];
+        if (cellSetIntersects(&p->cells, forbidden))
+            continue;
+
+        CellSet next;
+        for (int i = 0; i < CELL_WORDS; i++)
+            next.w[i] = forbidden->w[i] | p->halo.w[i];
+        total += countBack(s, depth + 1, &next);
+    }
+
+    if (!s->paused && !s->failed && !memoInsert(s, depth, forbidden, total))
+        s->failed = 1;
+    return total;
+}
+
+// ============================================================================
+// FONCTION : countForward (interne)
+// DESCRIPTION : Parcours des nœuds niveau par niveau depuis la racine : le
+//               poids d'un placement est (chemins jusqu'au nœud) x (complétions
+//               après le placement), sommé sur tous les nœuds où il est joué
+// PARAMÈTRES :
+//   - s     : résolution (table complète après countBack)
+//   - depth : niveau en cours (en entrée : où reprendre, en sortie : où s'arrêter)
+//   - index : emplacement en cours de la table (idem)
+// RETOUR : 1 si le parcours est allé au bout, 0 s'il s'est arrêté à l'échéance
+// ============================================================================
+static int countForward(Solver *s, int *depth, size_t *index) {
+    for (; *depth < s->shipCount; (*depth)++, *index = 0) {
+        for (; *index < s->memoCap; (*index)++) {
+            MemoNode *node = &s->memo[*index];
+            if (node->depth != *depth || node->fwd == 0.0 || node->back == 0.0)
+                continue;
+            if ((++s->expansions & 7) == 0 && s->deadline && chronoNowNs() > s->deadline)
+                return 0;  // Ce nœud n'est pas encore traité : reprise ici
+
+            int d = *depth;
+            for (int c = 0; c < s->candCount[d]; c++) {
+                const Placement *p = &s->cands[d][c];
+                if (cellSetIntersects(&p->cells, &node->key))
+                    continue;
+
+                CellSet next;
+                for (int i = 0; i < CELL_WORDS; i++)
+                    next.w[i] = node->key.w[i] | p->halo.w[i];
+
+                double back;
+                MemoNode *child = NULL;
+                if (d + 1 == s->shipCount) {
+                    CellSet open = uncoveredHits(s, &next);
+                    back = cellSetIsEmpty(&open) ? 1.0 : 0.0;
+                } else {
+                    child = memoFind(s, d + 1, &next);
+                    back = child ? child->back : 0.0;
+                }
+                if (back == 0.0)
+                    continue;
+
+                s->candWeight[d][c] += node->fwd * back;
+                if (child)
+                    child->fwd += node->fwd;
+            }
+        }
+    }
+    return 1;
+}
+
+// Étapes d'une résolution par tranches
+typedef enum {
+    TASK_BACK,          // Comptage des complétions (countBack)
+    TASK_FORWARD,       // Poids des placements (countForward)
+    TASK_FINISHED       // Résultat final connu
+} TaskStage;
+
+// Résolution en cours (voir solverTaskCreate)
+struct SolverTask {
+    Solver s;
+    CellSet root;                 // Zone interdite initiale
+    TaskStage stage;
+    SolverStatus status;          // Issue une fois TASK_FINISHED
+    int fwdDepth;                 // Reprise de countForward
+    size_t fwdIndex;
+    SolverResult out;             // Résultat en construction
+};
+
+// ============================================================================
+// FONCTION : solverTaskCreate
+// DESCRIPTION : Prépare les placements, l'ordre des bateaux et la table ;
+//               la taille estimée décide tout de suite des cas triviaux
+// ============================================================================
+SolverTask *solverTaskCreate(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                             const ShipConfig *remaining, double maxSearch) {
+    SolverTask *t = calloc(1, sizeof(SolverTask));
+    if (!t)
+        return NULL;
+
+    Solver *s = &t->s;
+    int order[SHIP_COUNT];
+    t->stage = TASK_FINISHED;
+    t->status = SOLVER_DONE;
+
+    // Cases touchées et zone interdite initiale (cases non libres)
+    for (int x = 0; x < GRID; x++) {
+        cellSetAddRow(&s->hits, x, hitRows[x] & ROW_MASK);
+        cellSetAddRow(&t->root, x, (uint16_t)(~freeRows[x] & ROW_MASK));
+    }
+
+    // ÉTAPE 1 : taille estimée (produit des placements possibles de chaque
+    // bateau), calculée sans rien allouer pour écarter vite les grosses positions
+    t->out.estimate = 1.0;
+    for (int i = 0; i < SHIP_COUNT; i++) {
+        if (remaining->sizes[i] == 0)
+            continue;
+        int k = s->shipCount++;
+        s->candCount[k] = buildPlacements(freeRows, hitRows, remaining->sizes[i], NULL);
+        order[k] = remaining->sizes[i] > 0 ? remaining->sizes[i] : -remaining->sizes[i];
+        t->out.estimate *= s->candCount[k];
+    }
+
+    // Aucune flotte possible ou espace de recherche trop grand
+    if (t->out.estimate == 0.0)
+        return t;
+    if (t->out.estimate > maxSearch) {
+        t->status = SOLVER_SKIPPED;
+        return t;
+    }
+    t->status = SOLVER_ABORTED;  // Tant que la préparation n'est pas finie
+
+    // Liste des placements de chaque bateau restant
+    for (int i = 0, k = 0; i < SHIP_COUNT; i++) {
+        if (remaining->sizes[i] == 0)
+            continue;
+        s->cands[k] = malloc(sizeof(Placement) * (size_t)s->candCount[k]);
+        s->candWeight[k] = calloc((size_t)s->candCount[k], sizeof(double));
+        if (!s->cands[k] || !s->candWeight[k])
+            return t;
+        buildPlacements(freeRows, hitRows, remaining->sizes[i], s->cands[k]);
+        k++;
+    }
+
+    // ÉTAPE 2 : les bateaux les plus contraints d'abord (moins de placements)
+    for (int i = 1; i < s->shipCount; i++) {
+        for (int j = i; j > 0 && s->candCount[j] < s->candCount[j - 1]; j--) {
+            Placement *tp = s->cands[j]; s->cands[j] = s->cands[j - 1]; s->cands[j - 1] = tp;
+            double *tw = s->candWeight[j]; s->candWeight[j] = s->candWeight[j - 1]; s->candWeight[j - 1] = tw;
+            int tc = s->candCount[j]; s->candCount[j] = s->candCount[j - 1]; s->candCount[j - 1] = tc;
+            int to = order[j]; order[j] = order[j - 1]; order[j - 1] = to;
+        }
+    }
+
+    // Portée et nombre de cases des niveaux suivants (pour la propagation)
+    for (int d = s->shipCount - 1; d >= 0; d--) {
+        s->reach[d] = s->reach[d + 1];
+        for (int c = 0; c < s->candCount[d]; c++)
+            for (int i = 0; i < CELL_WORDS; i++)
+                s->reach[d].w[i] |= s->cands[d][c].cells.w[i];
+        s->cellsLeft[d] = s->cellsLeft[d + 1] + order[d];
+    }
+
+    // Table de mémoïsation (agrandie au besoin)
+    s->memoCap = 256;
+    s->memo = malloc(sizeof(MemoNode) * s->memoCap);
+    if (!s->memo)
+        return t;
+    for (size_t i = 0; i < s->memoCap; i++)
+        s->memo[i].depth = -1;
+
+    t->stage = TASK_BACK;
+    t->status = SOLVER_PENDING;
+    return t;
+}
+
+// ============================================================================
+// FONCTION : spreadWeights (interne)
+// DESCRIPTION : ÉTAPE 4 : report des poids des placements sur leurs cases ;
+//               un placement dont il ne reste qu'une case non touchée coule
+//               sur un tir à cette case
+// ============================================================================
+static void spreadWeights(const Solver *s, SolverResult *out) {
+    for (int d = 0; d < s->shipCount; d++) {
+        for (int c = 0; c < s->candCount[d]; c++) {
+            double w = s->candWeight[d][c];
+            if (w == 0.0)
+                continue;
+
+            CellSet open;
+            for (int i = 0; i < CELL_WORDS; i++)
+                open.w[i] = s->cands[d][c].cells.w[i] & ~s->hits.w[i];
+            int last = cellSetCount(&open) == 1;
+
+            for (int k = 0; k < GRID * GRID; k++) {
+                if ((s->cands[d][c].cells.w[k >> 6] >> (k & 63)) & 1) {
+                    out->cells[k] += w;
+                    if (last && ((open.w[k >> 6] >> (k & 63)) & 1))
+                        out->sunk[k] += w;
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// FONCTION : solverTaskStep
+// DESCRIPTION : ÉTAPE 3 par tranches : complétions puis poids des placements,
+//               chacune reprise là où l'échéance l'a interrompue
+// ============================================================================
+SolverStatus solverTaskStep(SolverTask *t, uint64_t sliceNs, SolverResult *out) {
+    Solver *s = &t->s;
+
+    s->deadline = sliceNs ? chronoNowNs() + sliceNs : 0;
+    s->paused = 0;
+
+    if (t->stage == TASK_BACK) {
+        t->out.total = countBack(s, 0, &t->root);
+        if (s->failed) {
+            t->stage = TASK_FINISHED;
+            t->status = SOLVER_ABORTED;
+        } else if (!s->paused) {
+            MemoNode *rootNode = memoFind(s, 0, &t->root);
+            if (rootNode) {
+                rootNode->fwd = 1.0;
+                t->stage = TASK_FORWARD;
+            } else {
+                t->stage = TASK_FINISHED;  // Racine coupée par la propagation : aucune flotte
+                t->status = SOLVER_DONE;
+            }
+        }
+    }
+
+    if (t->stage == TASK_FORWARD && !s->paused) {
+        if (countForward(s, &t->fwdDepth, &t->fwdIndex)) {
+            spreadWeights(s, &t->out);
+            t->stage = TASK_FINISHED;
+            t->status = SOLVER_DONE;
+        }
+    }
+
+    if (t->stage == TASK_FINISHED && out) {
+        *out = t->out;
+        out->nodes = s->memoUsed;
+    }
+    return t->status;
+}
+
+// ============================================================================
+// FONCTION : solverTaskFree
+// DESCRIPTION : Libère une résolution
+// ============================================================================
+void solverTaskFree(SolverTask *t) {
+    if (!t)
+        return;
+    for (int k = 0; k < t->s.shipCount; k++) {
+        free(t->s.cands[k]);
+        free(t->s.candWeight[k]);
+    }
+    free(t->s.memo);
+    free(t);
+}
+
+// ============================================================================
+// FONCTION : solverRun
+// DESCRIPTION : Énumération exacte des flottes compatibles (voir solver.h) :
+//               une seule tranche de la durée du budget
+// ============================================================================
+SolverStatus solverRun(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                       const ShipConfig *remaining, double maxSearch, uint64_t budgetNs,
+                       SolverResult *out) {
+    SolverTask *t = solverTaskCreate(freeRows, hitRows, remaining, maxSearch);
+    SolverStatus status;
+
+    memset(out, 0, sizeof(*out));
+    if (!t)
+        return SOLVER_ABORTED;
+
+    status = t->status == SOLVER_PENDING ? solverTaskStep(t, budgetNs, out) : t->status;
+    if (status == SOLVER_PENDING)
+        status = SOLVER_ABORTED;  // Budget dépassé
+    out->estimate = t->out.estimate;
+    out->nodes = t->s.memoUsed;
+    solverTaskFree(t);
+    return status;
+}
+
+// ============================================================================
+// ÉCHANTILLONNAGE DE FLOTTES
+// ============================================================================
+
+// Nombre maximal de tentatives par tirage avant abandon
+#define SAMPLER_MAX_ATTEMPTS 64
+
+// Échantillonneur : placements possibles de chaque bateau restant
+struct SolverSampler {
+    int shipCount;
+    Placement *cands[SHIP_COUNT];
+    int candCount[SHIP_COUNT];
+    CellSet hits;
+    CellSet root;           // Cases non libres
+};
+
+// Générateur pseudo-aléatoire local (SplitMix64) : ne touche pas à la graine
+// globale de myRand et reste indépendant d'un fil d'exécution à l'autre
+static uint64_t samplerNext(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// ============================================================================
+// FONCTION : samplerCreate
+// DESCRIPTION : Précalcule les placements possibles de chaque bateau restant
+// ============================================================================
+SolverSampler *samplerCreate(const uint16_t freeRows[GRID], const uint16_t hitRows[GRID],
+                             const ShipConfig *remaining) {
+    SolverSampler *sp = calloc(1, sizeof(SolverSampler));
+    if (!sp)
+        return NULL;
+
+    for (int x = 0; x < GRID; x++) {
+        cellSetAddRow(&sp->hits, x, hitRows[x] & ROW_MASK);
+        cellSetAddRow(&sp->root, x, (uint16_t)(~freeRows[x] & ROW_MASK));
+    }
+
+    for (int i = 0; i < SHIP_COUNT; i++) {
+        if (remaining->sizes[i] == 0)
+            continue;
+        int k = sp->shipCount++;
+        sp->candCount[k] = buildPlacements(freeRows, hitRows, remaining->sizes[i], NULL);
+        sp->cands[k] = malloc(sizeof(Placement) * (size_t)(sp->candCount[k] + 1));
+        if (!sp->cands[k]) {
+            samplerFree(sp);
+            return NULL;
+        }
+        buildPlacements(freeRows, hitRows, remaining->sizes[i], sp->cands[k]);
+    }
+    return sp;
+}
+
+// ============================================================================
+// FONCTION : samplerFree
+// DESCRIPTION : Libère l'échantillonneur
+// ============================================================================
+void samplerFree(SolverSampler *sampler) {
+    if (!sampler)
+        return;
+    for (int k = 0; k < sampler->shipCount; k++)
+        free(sampler->cands[k]);
+    free(sampler);
+}
+
+// ============================================================================
+// FONCTION : samplerDraw
+// DESCRIPTION : Tire une flotte compatible et en déduit l'issue de chaque tir
+// ============================================================================
+int samplerDraw(const SolverSampler *sampler, uint64_t rngSeed,
+                unsigned char outcome[GRID * GRID]) {
+    uint64_t rng = rngSeed;
+
+    for (int attempt = 0; attempt < SAMPLER_MAX_ATTEMPTS; attempt++) {
+        CellSet forbidden = sampler->root;
+        const Placement *chosen[SHIP_COUNT] = {NULL};
+        int placed = 0, ok = 1;
+
+        while (ok && placed < sampler->shipCount) {
+            CellSet open = uncoveredHitsOf(&sampler->hits, &forbidden);
+            int hitCell = cellSetFirst(&open);
+
+            // Choix uniforme (réservoir) parmi les placements compatibles :
+            // ceux qui couvrent la première case touchée encore ouverte, sinon
+            // ceux du premier bateau non posé
+            const Placement *pick = NULL;
+            int pickShip = -1;
+            uint64_t seen = 0;
+            for (int k = 0; k < sampler->shipCount; k++) {
+                if (chosen[k])
+                    continue;
+                for (int c = 0; c < sampler->candCount[k]; c++) {
+                    const Placement *p = &sampler->cands[k][c];
+                    if (hitCell >= 0 && !((p->cells.w[hitCell >> 6] >> (hitCell & 63)) & 1))
+                        continue;
+                    if (cellSetIntersects(&p->cells, &forbidden))
+                        continue;
+                    if (samplerNext(&rng) % ++seen == 0) {
+                        pick = p;
+                        pickShip = k;
+                    }
+                }
+                if (hitCell < 0)
+                    break;  // Sans case touchée ouverte : bateaux dans l'ordre
+            }
+
+            if (!pick) {
+                ok = 0;  // Impasse : nouvelle tentative
+                break;
+            }
+            chosen[pickShip] = pick;
+            for (int i = 0; i < CELL_WORDS; i++)
+                forbidden.w[i] |= pick->halo.w[i];
+            placed++;
+        }
+
+        CellSet open = uncoveredHitsOf(&sampler->hits, &forbidden);
+        if (!ok || !cellSetIsEmpty(&open))
+            continue;
+
+        // Issue de chaque tir pour cette flotte
+        memset(outcome, SOLVER_OUT_MISS, GRID * GRID);
+        for (int k = 0; k < sampler->shipCount; k++) {
+            CellSet intact;
+            for (int i = 0; i < CELL_WORDS; i++)
+                intact.w[i] = chosen[k]->cells.w[i] & ~sampler->hits.w[i];
+            unsigned char result = cellSetCount(&intact) == 1 ? SOLVER_OUT_SUNK : SOLVER_OUT_HIT;
+            for (int c = 0; c < GRID * GRID; c++)
+                if ((intact.w[c >> 6] >> (c & 63)) & 1)
+                    outcome[c] = result;
+        }
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,250 @@
+// Inclusion des bibliothèques nécessaires
+#include <pthread.h>    // Fil de simulation
+#include <stdatomic.h>  // Anneaux d'instantanés sans verrou
+#include <string.h>     // Pour memcpy
+#include "spectate.h"   // Déclarations du flux des spectateurs (prototypes)
+#include "engine.h"     // Déroulement des parties
+#include "utils.h"      // Initialisations, placement automatique
+#include "ai.h"         // Fonctions d'IA
+
+// Emplacement d'instantané : seq est impair pendant l'écriture
+typedef struct {
+    atomic_uint seq;
+    BoardSnapshot snap;
+} SnapshotSlot;
+
+// Anneau d'un plateau : l'instantané numéro v est dans l'emplacement
+// v % SPECTATE_RING ; le lecteur a SPECTATE_RING - 1 publications de marge
+// avant que sa copie soit réécrite
+typedef struct {
+    _Alignas(64) atomic_uint latest;   // Dernière version publiée (0 = aucune)
+    SnapshotSlot slots[SPECTATE_RING];
+} SnapshotRing;
+
+// Partie jouée sur un plateau
+typedef struct {
+    Player players[2];
+    AIState states[2];
+    Engine engine;
+    uint64_t clockMs;            // Horloge virtuelle (les délais sont sautés)
+    uint32_t game;               // Numéro de la partie
+    uint32_t version;            // Dernière version publiée
+    int hold;                    // Passes restantes avant la partie suivante
+} SimBoard;
+
+// Signature commune des IA
+typedef void (*AIFunc)(Player *target, AIState *ai);
+static const AIFunc levelPlay[] = {enemyEasy, enemyMedium, enemyHard, enemyExpert, enemyInfo};
+
+static SnapshotRing rings[SPECTATE_BOARDS];
+static SimBoard boards[SPECTATE_BOARDS];
+static AILevel simLevels[2];
+static unsigned int simSeed;     // Graine de départ du fil de simulation
+
+static pthread_t simThread;
+static int running = 0;
+static atomic_int stopping;
+
+// Compteurs globaux (écrits par le fil de simulation seulement)
+static _Atomic uint64_t statGames, statShots, statWins[2];
+
+// ============================================================================
+// FONCTION : cellKind (interne)
+// DESCRIPTION : Traduit une case de Player.grid en état vu par le spectateur
+// ============================================================================
+static uint8_t cellKind(int v) {
+    if (v > 0) return SPECTATE_SHIP;
+    if (v == 0) return SPECTATE_WATER;
+    if (v == -99) return SPECTATE_MISS;
+    if (v <= -200) return SPECTATE_SUNK;
+    return SPECTATE_HIT;
+}
+
+// ============================================================================
+// FONCTION : publish (interne)
+// DESCRIPTION : Écrit l'instantané suivant du plateau puis le rend visible
+// ============================================================================
+static void publish(int b) {
+    SimBoard *sb = &boards[b];
+    SnapshotRing *ring = &rings[b];
+    uint32_t version = sb->version + 1;
+    SnapshotSlot *slot = &ring->slots[version % SPECTATE_RING];
+    unsigned seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->snap.version = version;
+    slot->snap.game = sb->game;
+    slot->snap.winner = sb->engine.phase == ENGINE_OVER ? sb->engine.winner : -1;
+    for (int p = 0; p < 2; p++)
+        for (int i = 0; i < GRID; i++)
+            for (int j = 0; j < GRID; j++)
+                slot->snap.cells[p][i][j] = cellKind(sb->players[p].grid[i][j]);
+
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+    atomic_store_explicit(&ring->latest, version, memory_order_release);
+    sb->version = version;
+}
+
+// ============================================================================
+// FONCTION : simNow (interne)
+// DESCRIPTION : Horloge virtuelle d'un plateau
+// ============================================================================
+static uint64_t simNow(void *ctx) {
+    return *(const uint64_t *)ctx;
+}
+
+// ============================================================================
+// FONCTION : boardStart (interne)
+// DESCRIPTION : Place deux nouvelles flottes et démarre la partie suivante
+// ============================================================================
+static void boardStart(int b) {
+    SimBoard *sb = &boards[b];
+    EngineClock clock = {simNow, &sb->clockMs};
+
+    for (int p = 0; p < 2; p++) {
+        initPlayer(&sb->players[p]);
+        initAIState(&sb->states[p]);
+        placeShips(sb->players[p].grid, &shipConfig);
+    }
+    engineInit(&sb->engine, &sb->players[0], &sb->players[1], ENGINE_AI, ENGINE_AI, clock);
+    sb->game++;
+    sb->hold = 0;
+    publish(b);
+}
+
+// ============================================================================
+// FONCTION : boardStep (interne)
+// DESCRIPTION : Joue un coup sur un plateau (délai sauté) et le publie ;
+//               une partie finie reste affichée SPECTATE_HOLD_PASSES passes
+// ============================================================================
+static void boardStep(int b) {
+    SimBoard *sb = &boards[b];
+    Engine *e = &sb->engine;
+
+    if (e->phase == ENGINE_OVER) {
+        if (sb->hold-- <= 0)
+            boardStart(b);
+        return;
+    }
+    while (e->phase == ENGINE_SHOT_DELAY) {
+        sb->clockMs = engineWakeTime(e);
+        engineStep(e, (EngineInput){ENGINE_INPUT_NONE, 0, 0});
+    }
+
+    int seat = e->current;
+    if (e->shots[seat] >= GRID * GRID) {
+        engineStep(e, (EngineInput){ENGINE_INPUT_QUIT, 0, 0});  // Sécurité
+    } else {
+        levelPlay[simLevels[seat]](engineOpponent(e), &sb->states[seat]);
+        engineStep(e, (EngineInput){ENGINE_INPUT_AI_DONE, 0, 0});
+        atomic_fetch_add_explicit(&statShots, 1, memory_order_relaxed);
+    }
+
+    if (e->phase == ENGINE_OVER) {
+        sb->hold = SPECTATE_HOLD_PASSES;
+        atomic_fetch_add_explicit(&statGames, 1, memory_order_relaxed);
+        if (e->winner >= 0)
+            atomic_fetch_add_explicit(&statWins[e->winner], 1, memory_order_relaxed);
+    }
+    publish(b);
+}
+
+// ============================================================================
+// FONCTION : simMain (interne)
+// DESCRIPTION : Fait avancer tous les plateaux d'un coup à tour de rôle ;
+//               la graine du fil (propre à chaque fil) part de simSeed
+// ============================================================================
+static void *simMain(void *arg) {
+    (void)arg;
+
+    seed = simSeed;
+    for (int b = 0; b < SPECTATE_BOARDS; b++)
+        boardStart(b);
+    while (!atomic_load_explicit(&stopping, memory_order_relaxed))
+        for (int b = 0; b < SPECTATE_BOARDS; b++)
+            boardStep(b);
+    return NULL;
+}
+
+// ============================================================================
+// FONCTION : spectateStart
+// DESCRIPTION : Remet les anneaux à zéro et lance le fil de simulation
+// ============================================================================
+int spectateStart(const AILevel levels[2], unsigned int startSeed) {
+    if (running)
+        return 1;
+
+    for (int b = 0; b < SPECTATE_BOARDS; b++) {
+        atomic_store(&rings[b].latest, 0);
+        for (int s = 0; s < SPECTATE_RING; s++)
+            atomic_store(&rings[b].slots[s].seq, 0);
+        boards[b].game = 0;
+        boards[b].version = 0;
+    }
+    atomic_store(&statGames, 0);
+    atomic_store(&statShots, 0);
+    atomic_store(&statWins[0], 0);
+    atomic_store(&statWins[1], 0);
+    simLevels[0] = levels[0];
+    simLevels[1] = levels[1];
+    simSeed = startSeed;
+    atomic_store(&stopping, 0);
+
+    if (pthread_create(&simThread, NULL, simMain, NULL) != 0)
+        return 0;
+    running = 1;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : spectateStop
+// DESCRIPTION : Demande l'arrêt après la passe en cours et attend le fil
+// ============================================================================
+void spectateStop(void) {
+    if (!running)
+        return;
+    atomic_store(&stopping, 1);
+    pthread_join(simThread, NULL);
+    running = 0;
+}
+
+// ============================================================================
+// FONCTION : spectateVersion / spectateRead
+// DESCRIPTION : Lecture du dernier instantané (copie relue si l'emplacement
+//               a changé pendant la copie)
+// ============================================================================
+uint32_t spectateVersion(int board) {
+    return atomic_load_explicit(&rings[board].latest, memory_order_acquire);
+}
+
+int spectateRead(int board, BoardSnapshot *out) {
+    SnapshotRing *ring = &rings[board];
+
+    for (;;) {
+        uint32_t version = atomic_load_explicit(&ring->latest, memory_order_acquire);
+        if (version == 0)
+            return 0;
+
+        SnapshotSlot *slot = &ring->slots[version % SPECTATE_RING];
+        unsigned before = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (before & 1)
+            continue;  // Emplacement en cours d'écriture
+        memcpy(out, &slot->snap, sizeof(*out));
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) == before)
+            return 1;
+    }
+}
+
+// ============================================================================
+// FONCTION : spectateStats
+// DESCRIPTION : Copie des compteurs globaux
+// ============================================================================
+void spectateStats(SpectateStats *out) {
+    out->games = atomic_load_explicit(&statGames, memory_order_relaxed);
+    out->shots = atomic_load_explicit(&statShots, memory_order_relaxed);
+    out->wins[0] = atomic_load_explicit(&statWins[0], memory_order_relaxed);
+    out->wins[1] = atomic_load_explicit(&statWins[1], memory_order_relaxed);
+}
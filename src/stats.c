@@ -0,0 +1,248 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdlib.h>     // Pour malloc, free
+#include <string.h>     // Pour memset
+#include "stats.h"      // Déclarations des histogrammes (prototypes)
+
+// Numéro du fil appelant dans les ensembles (-1 = pas encore attribué)
+static _Thread_local int histThread = -1;
+static atomic_int histThreads;
+
+// ============================================================================
+// FONCTION : histMsb (interne)
+// DESCRIPTION : Position du bit de poids fort (value > 0)
+// ============================================================================
+static int histMsb(uint64_t value) {
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(value);
+#else
+    int msb = 0;
+    while (value >>= 1)
+        msb++;
+    return msb;
+#endif
+}
+
+// ============================================================================
+// FONCTION : histIndex (interne)
+// DESCRIPTION : Case d'une valeur : les HIST_SUB premières valeurs ont
+//               chacune leur case ; au-delà, la valeur est décalée pour ne
+//               garder que HIST_SUB_BITS + 1 bits significatifs, et le
+//               décalage choisit la série de cases
+// RETOUR : indice de la case, -1 si la valeur est hors plage
+// ============================================================================
+static int histIndex(uint64_t value) {
+    if (value < HIST_SUB)
+        return (int)value;
+    int shift = histMsb(value) - HIST_SUB_BITS;
+    if (shift > HIST_MAX_BITS - HIST_SUB_BITS - 1)
+        return -1;
+    return shift * HIST_SUB + (int)(value >> shift);
+}
+
+// ============================================================================
+// FONCTION : histBucketHigh (interne)
+// DESCRIPTION : Plus grande valeur d'une case
+// ============================================================================
+static uint64_t histBucketHigh(int index) {
+    if (index < 2 * HIST_SUB)
+        return (uint64_t)index;
+    int shift = index / HIST_SUB - 1;
+    uint64_t low = (uint64_t)(index - shift * HIST_SUB) << shift;
+    return low + ((uint64_t)1 << shift) - 1;
+}
+
+// ============================================================================
+// FONCTION : histInit
+// DESCRIPTION : Vide un histogramme
+// ============================================================================
+void histInit(Histogram *h) {
+    memset(h, 0, sizeof(*h));
+    h->min = UINT64_MAX;
+}
+
+// ============================================================================
+// FONCTION : histRecord
+// DESCRIPTION : Une case (ou le compte hors plage), le compte, les extrêmes
+//               et la somme
+// ============================================================================
+void histRecord(Histogram *h, uint64_t value) {
+    int index = histIndex(value);
+
+    if (index >= 0)
+        h->buckets[index]++;
+    else
+        h->overflow++;
+    h->count++;
+    h->sum += (double)value;
+    if (value < h->min) h->min = value;
+    if (value > h->max) h->max = value;
+}
+
+// ============================================================================
+// FONCTION : histRecordCount
+// DESCRIPTION : Comme count appels à histRecord
+// ============================================================================
+void histRecordCount(Histogram *h, uint64_t value, uint64_t count) {
+    int index = histIndex(value);
+
+    if (count == 0)
+        return;
+    if (index >= 0)
+        h->buckets[index] += count;
+    else
+        h->overflow += count;
+    h->count += count;
+    h->sum += (double)value * (double)count;
+    if (value < h->min) h->min = value;
+    if (value > h->max) h->max = value;
+}
+
+// ============================================================================
+// FONCTION : histMerge
+// DESCRIPTION : Somme case par case (mêmes cases pour tous les histogrammes)
+// ============================================================================
+void histMerge(Histogram *dst, const Histogram *src) {
+    if (src->count == 0)
+        return;
+    for (int i = 0; i < HIST_BUCKETS; i++)
+        dst->buckets[i] += src->buckets[i];
+    dst->overflow += src->overflow;
+    dst->count += src->count;
+    dst->sum += src->sum;
+    if (src->min < dst->min) dst->min = src->min;
+    if (src->max > dst->max) dst->max = src->max;
+}
+
+// ============================================================================
+// FONCTION : histPercentile
+// DESCRIPTION : Parcourt les cases jusqu'au rang voulu ; au-delà de la
+//               dernière case, le rang est parmi les valeurs hors plage
+// ============================================================================
+uint64_t histPercentile(const Histogram *h, double p) {
+    if (h->count == 0)
+        return 0;
+    if (p <= 0.0)
+        return h->min;
+
+    uint64_t rank = (uint64_t)(p / 100.0 * (double)h->count + 0.5);
+    if (rank < 1)
+        rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            uint64_t high = histBucketHigh(i);
+            return high < h->max ? high : h->max;
+        }
+    }
+    return h->max;  // Valeurs hors plage
+}
+
+// ============================================================================
+// FONCTION : histMean
+// DESCRIPTION : Moyenne des valeurs
+// ============================================================================
+double histMean(const Histogram *h) {
+    return h->count ? h->sum / (double)h->count : 0.0;
+}
+
+// ============================================================================
+// FONCTION : histPrint
+// DESCRIPTION : Ligne de résumé lisible
+// ============================================================================
+void histPrint(const Histogram *h, FILE *out, const char *label, const char *unit, double scale) {
+    if (h->count == 0) {
+        fprintf(out, "%s : aucune valeur\n", label);
+        return;
+    }
+    fprintf(out, "%s : %llu valeurs, moy. %.1f %s, p50 %.1f, p90 %.1f, p99 %.1f, p99,9 %.1f,"
+            " max %.1f %s\n", label, (unsigned long long)h->count, histMean(h) / scale, unit,
+            (double)histPercentile(h, 50.0) / scale, (double)histPercentile(h, 90.0) / scale,
+            (double)histPercentile(h, 99.0) / scale, (double)histPercentile(h, 99.9) / scale,
+            (double)h->max / scale, unit);
+    if (h->overflow)
+        fprintf(out, "%s : %llu valeurs hors plage (2^%d et plus) : les centiles qui y"
+                " tombent valent le maximum\n", label, (unsigned long long)h->overflow, HIST_MAX_BITS);
+}
+
+// ============================================================================
+// FONCTION : histCsvHeader
+// DESCRIPTION : En-tête des lignes de histCsvRow
+// ============================================================================
+void histCsvHeader(FILE *out) {
+    fprintf(out, "series,metric,unit,count,min,mean,p50,p90,p99,p999,max,overflow\n");
+}
+
+// ============================================================================
+// FONCTION : histCsvRow
+// DESCRIPTION : Même résumé que histPrint, séparé par des virgules (point
+//               décimal quelle que soit la langue : locale C par défaut)
+// ============================================================================
+void histCsvRow(const Histogram *h, FILE *out, const char *series, const char *metric,
+                const char *unit, double scale) {
+    fprintf(out, "%s,%s,%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%llu\n", series, metric, unit,
+            (unsigned long long)h->count, h->count ? (double)h->min / scale : 0.0,
+            histMean(h) / scale, (double)histPercentile(h, 50.0) / scale,
+            (double)histPercentile(h, 90.0) / scale, (double)histPercentile(h, 99.0) / scale,
+            (double)histPercentile(h, 99.9) / scale, (double)h->max / scale,
+            (unsigned long long)h->overflow);
+}
+
+// ============================================================================
+// FONCTION : histSetInit
+// DESCRIPTION : Aucune instance
+// ============================================================================
+void histSetInit(HistogramSet *set) {
+    for (int i = 0; i < HIST_MAX_THREADS; i++)
+        atomic_init(&set->local[i], NULL);
+    atomic_init(&set->dropped, 0);
+}
+
+// ============================================================================
+// FONCTION : histSetRecord
+// DESCRIPTION : Le fil prend un numéro à son premier enregistrement (valable
+//               pour tous les ensembles) ; seul ce fil écrit dans son
+//               instance, publiée une fois créée
+// ============================================================================
+void histSetRecord(HistogramSet *set, uint64_t value) {
+    if (histThread < 0)
+        histThread = atomic_fetch_add(&histThreads, 1);
+    if (histThread >= HIST_MAX_THREADS) {
+        atomic_fetch_add_explicit(&set->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    Histogram *h = atomic_load_explicit(&set->local[histThread], memory_order_relaxed);
+    if (!h) {
+        if (!(h = malloc(sizeof(Histogram)))) {
+            atomic_fetch_add_explicit(&set->dropped, 1, memory_order_relaxed);
+            return;
+        }
+        histInit(h);
+        atomic_store_explicit(&set->local[histThread], h, memory_order_release);
+    }
+    histRecord(h, value);
+}
+
+// ============================================================================
+// FONCTION : histSetMerge
+// DESCRIPTION : Somme des instances existantes
+// ============================================================================
+void histSetMerge(HistogramSet *set, Histogram *out) {
+    histInit(out);
+    for (int i = 0; i < HIST_MAX_THREADS; i++) {
+        Histogram *h = atomic_load_explicit(&set->local[i], memory_order_acquire);
+        if (h)
+            histMerge(out, h);
+    }
+}
+
+// ============================================================================
+// FONCTION : histSetFree
+// DESCRIPTION : Libère les instances
+// ============================================================================
+void histSetFree(HistogramSet *set) {
+    for (int i = 0; i < HIST_MAX_THREADS; i++)
+        free(atomic_exchange(&set->local[i], NULL));
+    atomic_store(&set->dropped, 0);
+}
@@ -0,0 +1,102 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdlib.h>     // Pour calloc, free
+#include <stdint.h>     // Types entiers de taille fixe
+#include <stdatomic.h>  // Accès atomiques
+#include "ttable.h"     // Déclarations du cache (prototypes)
+
+// ============================================================================
+// FONCTIONS INTERNES : encodage d'un résultat sur 64 bits
+//   bits  0-7  : bestX + 1 (0 = entrée vide)
+//   bits  8-15 : bestY
+//   bits 16-31 : densité maximale (saturée à 65535)
+//   bits 32-63 : somme des densités
+// ============================================================================
+static uint64_t packResult(const TTResult *in) {
+    uint64_t maxWeight = in->maxWeight > 0xFFFF ? 0xFFFF : (uint64_t)in->maxWeight;
+    return (uint64_t)(in->bestX + 1)
+         | ((uint64_t)in->bestY << 8)
+         | (maxWeight << 16)
+         | ((uint64_t)(uint32_t)in->totalWeight << 32);
+}
+
+static void unpackResult(uint64_t data, TTResult *out) {
+    out->bestX = (int)(data & 0xFF) - 1;
+    out->bestY = (int)((data >> 8) & 0xFF);
+    out->maxWeight = (int)((data >> 16) & 0xFFFF);
+    out->totalWeight = (int)(data >> 32);
+}
+
+// ============================================================================
+// FONCTION : ttInit / ttFree / ttClear
+// DESCRIPTION : Gestion de la mémoire de la table
+// ============================================================================
+int ttInit(TTable *tt, int log2Entries) {
+    uint64_t count = 1ULL << log2Entries;
+
+    tt->entries = calloc(count, sizeof(TTEntry));  // Toutes les entrées vides
+    if (!tt->entries)
+        return 0;
+
+    tt->mask = count - 1;
+    atomic_init(&tt->probes, 0);
+    atomic_init(&tt->hits, 0);
+    atomic_init(&tt->stores, 0);
+    return 1;
+}
+
+void ttFree(TTable *tt) {
+    free(tt->entries);
+    tt->entries = NULL;
+}
+
+void ttClear(TTable *tt) {
+    for (uint64_t i = 0; i <= tt->mask; i++) {
+        atomic_store_explicit(&tt->entries[i].check, 0, memory_order_relaxed);
+        atomic_store_explicit(&tt->entries[i].data, 0, memory_order_relaxed);
+    }
+    atomic_store(&tt->probes, 0);
+    atomic_store(&tt->hits, 0);
+    atomic_store(&tt->stores, 0);
+}
+
+// ============================================================================
+// FONCTION : ttProbe
+// DESCRIPTION : Lecture sans verrou ; l'entrée n'est acceptée que si
+//               vérification XOR données redonne exactement la clé
+// ============================================================================
+int ttProbe(TTable *tt, uint64_t key, TTResult *out) {
+    TTEntry *e = &tt->entries[key & tt->mask];
+    uint64_t data = atomic_load_explicit(&e->data, memory_order_relaxed);
+    uint64_t check = atomic_load_explicit(&e->check, memory_order_relaxed);
+
+    atomic_fetch_add_explicit(&tt->probes, 1, memory_order_relaxed);
+
+    if ((data & 0xFF) == 0 || (check ^ data) != key)
+        return 0;  // Entrée vide, autre observation ou écriture concurrente
+
+    atomic_fetch_add_explicit(&tt->hits, 1, memory_order_relaxed);
+    unpackResult(data, out);
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : ttStore
+// DESCRIPTION : Écriture sans verrou (remplacement systématique)
+// ============================================================================
+void ttStore(TTable *tt, uint64_t key, const TTResult *in) {
+    TTEntry *e = &tt->entries[key & tt->mask];
+    uint64_t data = packResult(in);
+
+    atomic_store_explicit(&e->data, data, memory_order_relaxed);
+    atomic_store_explicit(&e->check, key ^ data, memory_order_relaxed);
+    atomic_fetch_add_explicit(&tt->stores, 1, memory_order_relaxed);
+}
+
+// ============================================================================
+// FONCTION : ttHitRate
+// DESCRIPTION : Taux de succès des consultations
+// ============================================================================
+double ttHitRate(TTable *tt) {
+    unsigned long long probes = atomic_load(&tt->probes);
+    return probes ? (double)atomic_load(&tt->hits) / (double)probes : 0.0;
+}
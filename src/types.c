@@ -1,8 +1,5 @@
-// Inclusion de la bibliothèque SDL3 pour les fonctions et types graphiques
-#include <SDL3/SDL.h>
-
 // Inclusion du fichier d'en-tête contenant les définitions de types personnalisés
-// Ce fichier définit les structures Player, ShipConfig, AIState, GameState, GraphicsContext
+// Ce fichier définit les structures Player, ShipConfig, AIState, Score
 // ainsi que les constantes comme NAME_LEN
 #include "types.h"
 
@@ -30,17 +27,11 @@ ShipConfig shipConfig = {
 // Contient la mémoire des tirs, les positions touchées, les stratégies de recherche
 AIState aiState;
 
-// État général du jeu (gestion des tours, délais, joueur courant)
-// Utilisé pour contrôler le flux du jeu dans la boucle principale
-GameState gameState;
-
-// Contexte graphique SDL (fenêtre et renderer)
-// Stocke les pointeurs vers la fenêtre SDL et le renderer pour le dessin
-GraphicsContext graphics;
-
 // Graine pour le générateur de nombres pseudo-aléatoires maison
 // Initialisée à 98765, sera modifiée avec SDL_GetTicks() pour plus de variabilité
-unsigned int seed = 98765;
+// Une graine par fil d'exécution : des parties jouées en parallèle (tournoi)
+// ont chacune leur suite de tirages, identique à celle d'une partie seule
+_Thread_local unsigned int seed = 98765;
 
 // Mode de placement des bateaux (1 = automatique, 2 = manuel)
 // Déterminé par l'utilisateur au début du jeu
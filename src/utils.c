@@ -1,5 +1,4 @@
 // Inclusion des bibliothèques nécessaires
-#include <SDL3/SDL.h>   // Bibliothèque graphique SDL3 (pour showInfoBox)
 #include <stdio.h>      // Bibliothèque standard d'entrée/sortie (pour snprintf)
 #include "types.h"      // Définitions des types personnalisés (Player, AIState, etc.)
 #include "utils.h"      // Déclarations des fonctions utilitaires (prototypes)
@@ -56,22 +55,12 @@ void initAIState(AIState *ai) {
     
     // Nettoie la grille des tirs de l'IA
     clearGrid(ai->shots);
-}
 
-// ============================================================================
-// FONCTION : initGameState
-// DESCRIPTION : Initialise l'état du jeu (début de partie)
-// PARAMÈTRES :
-//   - gs : pointeur vers l'état du jeu à initialiser
-// RETOUR : aucun (void)
-// ============================================================================
-void initGameState(GameState *gs) {
-    gs->currentPlayer = 0;          // Le joueur 1 commence
-    gs->waitingNextPlayer = 1;      // En attente du premier tour (PvP)
-    gs->waitingDelay = 0;           // Pas de délai IA actif
-    gs->waitingPvPDelay = 0;        // Pas de délai PvP actif
-    gs->lastActionTime = 0;         // Pas de dernière action
-    gs->lastPlayerActionTime = 0;   // Pas de dernière action joueur
+    // Observation vierge : toutes les cases inconnues, hachage nul
+    for (int i = 0; i < GRID; i++)
+        for (int j = 0; j < GRID; j++)
+            ai->obs[i][j] = 0;
+    ai->hash = 0;
 }
 
 // ============================================================================
@@ -284,54 +273,12 @@ void markShipSunk(int g[GRID][GRID], int shipId) {
                 g[i][j] = -200 - shipId;  // Marque comme coulé (valeur spéciale)
 }
 
-// ============================================================================
-// FONCTION : getCurrentPlayer
-// DESCRIPTION : Retourne le joueur dont c'est le tour
-// PARAMÈTRES :
-//   - mode : mode de jeu (1 = PvP, autre = solo)
-//   - gs   : état du jeu
-// RETOUR : pointeur vers le joueur actuel
-// ============================================================================
-Player* getCurrentPlayer(int mode, GameState *gs) {
-    if (mode == 1)  // Mode PvP
-        return (gs->currentPlayer == 0) ? &player1 : &player2;
-    return &player1;  // Mode solo : toujours le joueur 1
-}
-
-// ============================================================================
-// FONCTION : getOpponent
-// DESCRIPTION : Retourne l'adversaire du joueur actuel
-// PARAMÈTRES :
-//   - mode : mode de jeu (1 = PvP, autre = solo)
-//   - gs   : état du jeu
-// RETOUR : pointeur vers l'adversaire
-// ============================================================================
-Player* getOpponent(int mode, GameState *gs) {
-    if (mode == 1)  // Mode PvP
-        return (gs->currentPlayer == 0) ? &player2 : &player1;
-    return &player2;  // Mode solo : l'adversaire est toujours l'IA (joueur 2)
-}
-
-// ============================================================================
-// FONCTION : showInfoBox
-// DESCRIPTION : Affiche une boîte de dialogue d'information SDL
-// PARAMÈTRES :
-//   - window : fenêtre SDL parente
-//   - format : format du message (comme printf)
-//   - a, b   : valeurs à formater
-// RETOUR : aucun (void)
-// ============================================================================
-void showInfoBox(SDL_Window *window, const char *format, int a, int b) {
-    char buf[256];  // Buffer pour le message formaté
-    snprintf(buf, sizeof(buf), format, a, b);  // Formate le message
-    SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Info", buf, window);
-}
-
 // ============================================================================
 // FONCTION : getScoreModeFromGameMode
-// DESCRIPTION : Convertit le mode de jeu (1-4) en mode de score (enum ScoreMode)
+// DESCRIPTION : Convertit le mode de jeu (1-6) en mode de score (enum ScoreMode)
 // PARAMÈTRES :
-//   - mode : mode de jeu (1 = PvP, 2 = facile, 3 = moyen, 4 = difficile)
+//   - mode : mode de jeu (1 = PvP, 2 = facile, 3 = moyen, 4 = difficile,
+//            5 = expert, 6 = info)
 // RETOUR : ScoreMode correspondant
 // ============================================================================
 ScoreMode getScoreModeFromGameMode(int mode) {
@@ -340,6 +287,8 @@ ScoreMode getScoreModeFromGameMode(int mode) {
         case 2: return SCORE_EASY;    // Mode 2 = IA facile
         case 3: return SCORE_MEDIUM;  // Mode 3 = IA moyen
         case 4: return SCORE_HARD;    // Mode 4 = IA difficile
+        case 5: return SCORE_EXPERT;  // Mode 5 = IA experte
+        case 6: return SCORE_INFO;    // Mode 6 = IA info
         case 1: return SCORE_PVP;     // Mode 1 = PvP
         default: return SCORE_EASY;   // Par défaut (ne devrait pas arriver)
     }
@@ -0,0 +1,45 @@
+// Inclusion des bibliothèques nécessaires
+#include "vclock.h"     // Déclarations de l'horloge virtuelle (prototypes)
+
+// ============================================================================
+// FONCTION : vclockInit
+// DESCRIPTION : Prend l'instant réel courant comme origine du temps virtuel
+// ============================================================================
+void vclockInit(VirtualClock *vc, EngineClock source, unsigned rate) {
+    vc->source = source;
+    vc->realBase = source.now(source.ctx);
+    vc->virtualBase = 0;
+    vc->rate = rate;
+}
+
+// ============================================================================
+// FONCTION : vclockNow
+// DESCRIPTION : Temps virtuel = base + temps réel écoulé depuis la base x vitesse
+// ============================================================================
+uint64_t vclockNow(const VirtualClock *vc) {
+    uint64_t real = vc->source.now(vc->source.ctx);
+    return vc->virtualBase + (real - vc->realBase) * vc->rate;
+}
+
+// ============================================================================
+// FONCTION : vclockSetRate
+// DESCRIPTION : Reprend la base à l'instant du changement
+// ============================================================================
+void vclockSetRate(VirtualClock *vc, unsigned rate) {
+    vc->virtualBase = vclockNow(vc);
+    vc->realBase = vc->source.now(vc->source.ctx);
+    vc->rate = rate;
+}
+
+// ============================================================================
+// FONCTION : vclockEngineClock
+// DESCRIPTION : Adaptateur vers l'interface EngineClock
+// ============================================================================
+static uint64_t vclockRead(void *ctx) {
+    return vclockNow((const VirtualClock *)ctx);
+}
+
+EngineClock vclockEngineClock(VirtualClock *vc) {
+    EngineClock clock = {vclockRead, vc};
+    return clock;
+}
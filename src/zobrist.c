@@ -0,0 +1,41 @@
+// Inclusion des bibliothèques nécessaires
+#include <stdint.h>     // Types entiers de taille fixe
+#include "types.h"      // Définitions des types personnalisés (GRID)
+#include "zobrist.h"    // Déclarations du hachage (prototypes)
+
+// ============================================================================
+// FONCTION : zobristKey
+// DESCRIPTION : Clé de Zobrist d'une case dans un état
+// ALGORITHME : Mélangeur SplitMix64 appliqué à l'index (case, état)
+//   Pas de table à initialiser : la fonction est pure, donc utilisable sans
+//   précaution depuis plusieurs fils d'exécution, et les clés sont stables
+// ============================================================================
+uint64_t zobristKey(int x, int y, int state) {
+    if (state == OBS_UNKNOWN)
+        return 0;  // Une case inconnue ne contribue pas au hachage
+
+    uint64_t z = 0x9E3779B97F4A7C15ULL * (uint64_t)(((x * GRID + y) * OBS_STATES + state) + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// ============================================================================
+// FONCTION : zobristHashBoard
+// DESCRIPTION : Hachage complet d'une grille d'observation
+// ============================================================================
+uint64_t zobristHashBoard(unsigned char obs[GRID][GRID]) {
+    uint64_t hash = 0;
+    for (int x = 0; x < GRID; x++)
+        for (int y = 0; y < GRID; y++)
+            hash ^= zobristKey(x, y, obs[x][y]);
+    return hash;
+}
+
+// ============================================================================
+// FONCTION : zobristUpdate
+// DESCRIPTION : Mise à jour incrémentale du hachage
+// ============================================================================
+void zobristUpdate(uint64_t *hash, int x, int y, int oldState, int newState) {
+    *hash ^= zobristKey(x, y, oldState) ^ zobristKey(x, y, newState);
+}
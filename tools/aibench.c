@@ -0,0 +1,415 @@
+// ========================================================================
+// PROGRAMME : aibench (banc d'essai des IA, cible make bench)
+// DESCRIPTION : Fait jouer chaque IA sur une série fixe de parties (mêmes
+//               flottes, mêmes tirages à graine égale) et mesure sa force
+//               (coups pour gagner : moyenne, p50, p99), la durée de chaque
+//               décision (p50, p99, p99,9) et le débit. La série est jouée
+//               plusieurs fois et chaque mesure de temps garde la meilleure
+//               répétition (la moins perturbée par le reste de la machine).
+//               La sortie est un fichier CSV, une ligne par IA ; avec -b,
+//               les mesures sont comparées à celles d'un fichier de
+//               référence et toute dégradation au-delà du seuil est une
+//               régression ; les queues de distribution des durées (p99,
+//               p99,9), trop instables d'une exécution à l'autre, sont
+//               signalées sans compter comme régression, et un écart de
+//               durée sous 50 ns est ignoré (pour les IA rapides, il tient
+//               du bruit de l'horloge). Avec -p, les
+//               compteurs matériels (Linux) de chaque décision donnent, par
+//               IA, l'IPC, les défauts de cache et les branchements mal
+//               prédits par partie, puis par décision selon l'avancement de
+//               la partie (les boucles de rejet des tirs au hasard et les
+//               parcours de grille de l'IA difficile coûtent surtout en fin
+//               de partie)
+// USAGE : ./aibench [-n parties] [-s graine] [-a ia] [-o fichier] [-b référence]
+//                   [-r pourcent] [-R répétitions] [-p]
+//   -n parties   : parties par IA (défaut : propre à chaque IA, de 1000
+//                  pour les IA rapides à 20 pour l'IA info)
+//   -s graine    : graine de la série (défaut : 12345)
+//   -a ia        : ne mesure que cette IA (easy, medium, hard, expert, info)
+//   -o fichier   : écrit les résultats dans ce fichier (défaut : sortie standard)
+//   -b référence : compare aux résultats d'un fichier produit par aibench
+//   -r pourcent  : dégradation tolérée avant de signaler une régression
+//                  (défaut : 10)
+//   -R répétitions : séries jouées par IA, la meilleure mesure de temps est
+//                  gardée (défaut : 5)
+//   -p           : compteurs matériels sur la sortie d'erreur (perf_event_open ;
+//                  deux lectures par décision allongent les durées mesurées,
+//                  à ne pas comparer à une référence prise sans -p ;
+//                  compteurs relevés sur la première répétition)
+// CODE DE SORTIE : 0 si rien n'a régressé, 2 sinon, 1 en cas d'erreur
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour printf, fprintf, fopen
+#include <stdlib.h>     // Pour atoi, strtoul, strtod
+#include <math.h>       // Pour fabs
+#include <string.h>     // Pour strcmp, strtok
+#include "types.h"      // Définitions des types (Player, AIState, seed)
+#include "utils.h"      // Placement automatique, fin de partie
+#include "ai.h"         // Fonctions d'IA
+#include "kernels.h"    // Dispatch des noyaux
+#include "chrono.h"     // Horloge monotone
+#include "philox.h"     // Flux de tirages de chaque partie
+#include "pool.h"       // Groupe de fils (IA info)
+#include "stats.h"      // Histogrammes des coups et des durées
+#include "perfcount.h"  // Compteurs matériels (option -p)
+
+// Signature commune des IA
+typedef void (*AIFunc)(Player *target, AIState *ai);
+
+// IA mesurées et nombre de parties par défaut (même durée de mesure environ)
+typedef struct {
+    const char *name;
+    AIFunc play;
+    int games;
+} AIEntry;
+
+static const AIEntry entrants[] = {
+    {"easy",   enemyEasy,   1000},
+    {"medium", enemyMedium, 1000},
+    {"hard",   enemyHard,   1000},
+    {"expert", enemyExpert, 200},
+    {"info",   enemyInfo,   20},
+};
+#define ENTRANT_COUNT ((int)(sizeof(entrants) / sizeof(entrants[0])))
+
+// Séries jouées par IA par défaut (meilleure mesure de temps gardée)
+#define BENCH_REPS 5
+
+// Écart de durée de décision ignoré à la comparaison (µs) : de l'ordre de
+// la résolution de l'horloge, il tient du bruit pour les IA rapides
+#define BENCH_FLOOR_US 0.05
+
+// Colonnes du fichier de résultats et sens de chaque mesure
+typedef struct {
+    const char *name;    // En-tête de colonne
+    int better;          // -1 : plus petit est meilleur, 1 : plus grand, 0 : non comparé
+    int strength;        // 1 : ne dépend que des parties jouées (nombre, graine)
+    int gated;           // 1 : une dégradation est une régression, 0 : seulement signalée
+    double floor;        // Écart absolu ignoré à la comparaison (unité de la colonne)
+} Column;
+
+static const Column columns[] = {
+    {"ai", 0, 0, 0, 0.0},
+    {"games", 0, 0, 0, 0.0},
+    {"seed", 0, 0, 0, 0.0},
+    {"shots_mean", -1, 1, 1, 0.0},
+    {"shots_p50", -1, 1, 1, 0.0},
+    {"shots_p99", -1, 1, 1, 0.0},
+    {"decision_mean_us", -1, 0, 1, BENCH_FLOOR_US},
+    {"decision_p50_us", -1, 0, 1, BENCH_FLOOR_US},
+    {"decision_p99_us", -1, 0, 0, BENCH_FLOOR_US},
+    {"decision_p999_us", -1, 0, 0, BENCH_FLOOR_US},
+    {"games_per_s", 1, 0, 1, 0.0},
+};
+#define COLUMN_COUNT ((int)(sizeof(columns) / sizeof(columns[0])))
+
+// Tranches d'avancement de la partie pour les compteurs (coups déjà tirés)
+#define PERF_STAGES 3
+static const int stageFirst[PERF_STAGES] = {0, 40, 80};
+static const char *stageNames[PERF_STAGES] = {"coups 1-40", "coups 41-80", "coups 81+"};
+
+// Compteurs matériels (option -p, sinon aucun compteur ouvert)
+static PerfCounters counters;
+
+// Mesures d'une IA (mêmes colonnes que le fichier, sauf le nom)
+typedef struct {
+    char name[16];
+    double values[COLUMN_COUNT];
+} BenchRow;
+
+// ============================================================================
+// FONCTION : benchGame (interne)
+// DESCRIPTION : Joue la partie n°game et enregistre la durée de chaque
+//               décision et, si les compteurs sont ouverts, ses compteurs
+//               matériels dans la tranche de son numéro de coup
+// RETOUR : nombre de coups pour couler la flotte
+// ============================================================================
+static int benchGame(AIFunc play, uint64_t runSeed, int game, Histogram *decisions,
+                     PerfTotals *perf) {
+    Player target;
+    AIState state;
+    int shots = 0;
+
+    seed = philoxSeed(runSeed, (uint32_t)game, RNG_STREAM_FLEET);
+    initPlayer(&target);
+    initAIState(&state);
+    placeShips(target.grid, &shipConfig);
+    seed = philoxSeed(runSeed, (uint32_t)game, RNG_STREAM_AI);
+
+    while (!allDestroyed(target.grid) && shots < GRID * GRID) {
+        PerfReading counted;
+        int stage = PERF_STAGES - 1;
+        while (stage > 0 && shots < stageFirst[stage])
+            stage--;
+
+        if (perf)
+            perfBegin(&counters, &counted);
+        uint64_t start = chronoNowNs();
+        play(&target, &state);
+        if (decisions)
+            histRecord(decisions, chronoNowNs() - start);
+        if (perf)
+            perfEnd(&counters, &counted, &perf[stage]);
+        shots++;
+    }
+    return shots;
+}
+
+// ============================================================================
+// FONCTION : benchEntrant (interne)
+// DESCRIPTION : Une partie d'échauffement (caches, pages, tables des IA),
+//               puis reps fois la série mesurée ; les mesures de force sont
+//               les mêmes à chaque série, chaque mesure de temps garde la
+//               meilleure série. Les compteurs matériels ne suivent que la
+//               première
+// ============================================================================
+static void benchEntrant(const AIEntry *entrant, int games, unsigned int runSeed, int reps,
+                         BenchRow *row) {
+    static Histogram shots, decisions;
+    PerfTotals perf[PERF_STAGES];
+    PerfTotals *counted = counters.members > 0 ? perf : NULL;
+    double *v = row->values;
+
+    for (int s = 0; s < PERF_STAGES; s++)
+        perfTotalsInit(&perf[s]);
+    benchGame(entrant->play, runSeed, games, NULL, NULL);  // Hors série : partie n°games
+
+    for (int r = 0; r < reps; r++) {
+        histInit(&shots);
+        histInit(&decisions);
+        uint64_t start = chronoNowNs();
+        for (int g = 0; g < games; g++)
+            histRecord(&shots, (uint64_t)benchGame(entrant->play, runSeed, g, &decisions,
+                                                   r == 0 ? counted : NULL));
+        double seconds = (double)(chronoNowNs() - start) / 1e9;
+
+        double timing[COLUMN_COUNT];
+        timing[6] = histMean(&decisions) / 1e3;
+        timing[7] = (double)histPercentile(&decisions, 50.0) / 1e3;
+        timing[8] = (double)histPercentile(&decisions, 99.0) / 1e3;
+        timing[9] = (double)histPercentile(&decisions, 99.9) / 1e3;
+        timing[10] = seconds > 0 ? games / seconds : 0.0;
+        for (int c = 6; c < COLUMN_COUNT; c++)
+            if (r == 0 || timing[c] * columns[c].better > v[c] * columns[c].better)
+                v[c] = timing[c];
+    }
+
+    if (counted) {
+        PerfTotals all;
+        perfTotalsInit(&all);
+        for (int s = 0; s < PERF_STAGES; s++) {
+            for (int e = 0; e < PERF_EVENT_COUNT; e++)
+                all.value[e] += perf[s].value[e];
+            all.regions += perf[s].regions;
+        }
+        perfPrint(&counters, &all, stderr, entrant->name, games, "partie");
+        for (int s = 0; s < PERF_STAGES; s++) {
+            char label[48];
+            if (perf[s].regions == 0)
+                continue;
+            snprintf(label, sizeof(label), "  %s (%llu décisions)", stageNames[s],
+                     (unsigned long long)perf[s].regions);
+            perfPrint(&counters, &perf[s], stderr, label, (double)perf[s].regions, "décision");
+        }
+    }
+
+    snprintf(row->name, sizeof(row->name), "%s", entrant->name);
+    v[1] = games;
+    v[2] = runSeed;
+    v[3] = histMean(&shots);
+    v[4] = (double)histPercentile(&shots, 50.0);
+    v[5] = (double)histPercentile(&shots, 99.0);
+}
+
+// ============================================================================
+// FONCTION : writeRow (interne)
+// DESCRIPTION : Une ligne du fichier de résultats
+// ============================================================================
+static void writeRow(FILE *out, const BenchRow *row) {
+    fprintf(out, "%s", row->name);
+    for (int c = 1; c < COLUMN_COUNT; c++)
+        fprintf(out, ",%.6g", row->values[c]);
+    fprintf(out, "\n");
+}
+
+// ============================================================================
+// FONCTION : readBaseline (interne)
+// DESCRIPTION : Lit un fichier de résultats ; les colonnes sont repérées par
+//               leur en-tête (un fichier d'une version antérieure, avec moins
+//               de colonnes, reste lisible)
+// PARAMÈTRES :
+//   - path : chemin du fichier
+//   - rows : lignes lues (ENTRANT_COUNT au plus)
+//   - have : 1 pour chaque colonne présente dans le fichier
+// RETOUR : nombre de lignes lues, -1 si le fichier est illisible
+// ============================================================================
+static int readBaseline(const char *path, BenchRow rows[ENTRANT_COUNT], int have[COLUMN_COUNT]) {
+    FILE *f = fopen(path, "r");
+    char line[512];
+    int map[32];          // Colonne du fichier -> colonne connue (-1 = ignorée)
+    int fields = 0, count = 0;
+
+    if (!f)
+        return -1;
+    memset(have, 0, sizeof(int) * COLUMN_COUNT);
+    if (!fgets(line, sizeof(line), f)) {
+        fclose(f);
+        return -1;
+    }
+    for (char *tok = strtok(line, ",\r\n"); tok && fields < 32; tok = strtok(NULL, ",\r\n")) {
+        map[fields] = -1;
+        for (int c = 0; c < COLUMN_COUNT; c++)
+            if (strcmp(tok, columns[c].name) == 0) {
+                map[fields] = c;
+                have[c] = 1;
+            }
+        fields++;
+    }
+    if (!have[0]) {
+        fclose(f);
+        return -1;
+    }
+
+    while (count < ENTRANT_COUNT && fgets(line, sizeof(line), f)) {
+        BenchRow *row = &rows[count];
+        int field = 0;
+        memset(row, 0, sizeof(*row));
+        for (char *tok = strtok(line, ",\r\n"); tok && field < fields; tok = strtok(NULL, ",\r\n"), field++) {
+            if (map[field] == 0)
+                snprintf(row->name, sizeof(row->name), "%s", tok);
+            else if (map[field] > 0)
+                row->values[map[field]] = strtod(tok, NULL);
+        }
+        if (row->name[0])
+            count++;
+    }
+    fclose(f);
+    return count;
+}
+
+// ============================================================================
+// FONCTION : compareRow (interne)
+// DESCRIPTION : Compare chaque mesure à la référence, dans le sens où elle
+//               s'améliore, et signale celles qui se dégradent de plus de
+//               threshold % et de plus de l'écart ignoré de la colonne ;
+//               seules les colonnes contrôlées comptent comme régressions
+// RETOUR : nombre de régressions
+// ============================================================================
+static int compareRow(const BenchRow *row, const BenchRow *base, const int have[COLUMN_COUNT],
+                      double threshold) {
+    int regressions = 0;
+    int sameGames = !(have[1] && base->values[1] != row->values[1])
+                 && !(have[2] && base->values[2] != row->values[2]);
+
+    if (!sameGames)
+        fprintf(stderr, "%s : référence jouée sur d'autres parties (nombre ou graine),"
+                " force non comparée\n", row->name);
+
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+        if (!have[c] || columns[c].better == 0 || base->values[c] <= 0.0
+            || (columns[c].strength && !sameGames))
+            continue;
+        double change = 100.0 * (row->values[c] - base->values[c]) / base->values[c];
+        double worse = columns[c].better < 0 ? change : -change;
+        if (worse > threshold && fabs(row->values[c] - base->values[c]) >= columns[c].floor) {
+            fprintf(stderr, "%s %s %s : %.6g -> %.6g (%+.1f %%)\n",
+                    columns[c].gated ? "RÉGRESSION" : "écart (non contrôlé)", row->name,
+                    columns[c].name, base->values[c], row->values[c], change);
+            regressions += columns[c].gated;
+        }
+    }
+    return regressions;
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int games = 0;                  // Parties par IA (0 = valeur propre à l'IA)
+    unsigned int runSeed = 12345;   // Graine de la série
+    const char *only = NULL;        // Filtre sur le nom d'IA
+    const char *outPath = NULL;     // Fichier de résultats
+    const char *basePath = NULL;    // Fichier de référence
+    double threshold = 10.0;        // Dégradation tolérée (%)
+    int reps = BENCH_REPS;          // Séries jouées par IA
+    int perf = 0;                   // Compteurs matériels
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            runSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            basePath = argv[++i];
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            threshold = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-R") == 0 && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0) {
+            perf = 1;
+        } else {
+            fprintf(stderr, "Usage : %s [-n parties] [-s graine] [-a ia] [-o fichier]"
+                    " [-b référence] [-r pourcent] [-R répétitions] [-p]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (games < 0 || threshold < 0 || reps < 1) {
+        fprintf(stderr, "Nombre de parties, seuil ou répétitions invalide\n");
+        return 1;
+    }
+
+    BenchRow base[ENTRANT_COUNT];
+    int have[COLUMN_COUNT], baseCount = 0;
+    if (basePath && (baseCount = readBaseline(basePath, base, have)) < 0) {
+        fprintf(stderr, "Référence illisible : %s\n", basePath);
+        return 1;
+    }
+
+    FILE *out = outPath ? fopen(outPath, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "Impossible d'écrire %s\n", outPath);
+        return 1;
+    }
+
+    // Conditions fixes : dispatch au meilleur niveau, un seul fil
+    dispatchInit(CPU_AVX512);
+    poolInit(1);
+    if (perf && perfOpen(&counters) == 0)
+        fprintf(stderr, "Compteurs matériels indisponibles (perf_event_open refusé)\n");
+
+    for (int c = 0; c < COLUMN_COUNT; c++)
+        fprintf(out, "%s%s", c ? "," : "", columns[c].name);
+    fprintf(out, "\n");
+
+    int regressions = 0, matched = 0;
+    for (int a = 0; a < ENTRANT_COUNT; a++) {
+        if (only && strcmp(only, entrants[a].name) != 0)
+            continue;
+
+        BenchRow row;
+        benchEntrant(&entrants[a], games > 0 ? games : entrants[a].games, runSeed, reps, &row);
+        writeRow(out, &row);
+        fflush(out);
+
+        for (int b = 0; b < baseCount; b++)
+            if (strcmp(base[b].name, row.name) == 0) {
+                regressions += compareRow(&row, &base[b], have, threshold);
+                matched++;
+            }
+    }
+
+    if (outPath)
+        fclose(out);
+    poolShutdown();
+    perfClose(&counters);
+    if (basePath)
+        fprintf(stderr, "%d IA comparées à %s : %d régression%s (seuil %.1f %%)\n", matched,
+                basePath, regressions, regressions > 1 ? "s" : "", threshold);
+    return regressions > 0 ? 2 : 0;
+}
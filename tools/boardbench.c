@@ -0,0 +1,539 @@
+// ========================================================================
+// PROGRAMME : boardbench (micro-banc d'essai des primitives de grille)
+// DESCRIPTION : Mesure en ns par appel les primitives de utils.c
+//               (isAreaFree, canPlaceShip, canPlaceShip5x2Manual, placeShips,
+//               isShipSunk, markShipSunk, allDestroyed) sur des grilles de
+//               partie réelles : l'IA difficile joue des parties à graine
+//               fixe, arrêtées au début (10 % des coups), au milieu (50 %)
+//               et à la fin (90 %). Chaque mesure est précédée d'un
+//               échauffement et répétée ; le meilleur temps et la médiane des
+//               répétitions sont rapportés. Avec -b, chaque médiane est
+//               comparée à celle d'un fichier produit par -o (avant / après
+//               une optimisation). Avec -p, les compteurs matériels (Linux)
+//               des répétitions donnent l'IPC, les défauts de cache et les
+//               branchements mal prédits par appel. Les variantes de
+//               randFill (kernels.h) utilisables sur ce processeur sont
+//               d'abord comparées à randFillGeneric (valeurs et graine
+//               finale, code de sortie 1 si elles diffèrent), puis mesurées
+//               en ns par tirage
+// USAGE : ./boardbench [-n appels] [-r répétitions] [-w appels] [-s graine]
+//                      [-f primitive] [-o fichier] [-b référence] [-p]
+//   -n appels      : appels par répétition (défaut : 20000)
+//   -r répétitions : répétitions mesurées (défaut : 15)
+//   -w appels      : appels d'échauffement avant les répétitions (défaut : 20000)
+//   -s graine      : graine des grilles et des arguments (défaut : 12345)
+//   -f primitive   : ne mesure que cette primitive
+//   -o fichier     : écrit aussi les résultats en CSV dans ce fichier
+//   -b référence   : compare les médianes à un fichier écrit par -o
+//   -p             : compteurs matériels par appel (perf_event_open)
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour printf, fprintf, fopen
+#include <stdlib.h>     // Pour atoi, strtoul, strtod, qsort
+#include <string.h>     // Pour memcpy, strcmp, strtok
+#include "types.h"      // Définitions des types (Player, AIState, seed)
+#include "utils.h"      // Primitives mesurées
+#include "ai.h"         // IA difficile (grilles de partie)
+#include "kernels.h"    // Dispatch des noyaux
+#include "chrono.h"     // Horloge monotone
+#include "philox.h"     // Flux de tirages de chaque partie
+#include "perfcount.h"  // Compteurs matériels (option -p)
+
+// Grilles par phase de partie (parcourues tour à tour : la mesure ne se
+// réduit pas à une seule grille apprise par le prédicteur de branchements)
+#define BOARD_COUNT 32
+
+// Jeux d'arguments précalculés par primitive (puissance de deux)
+#define ARG_COUNT 1024
+
+// Répétitions au plus
+#define MAX_REPS 1000
+
+// Tirages par appel de randFill dans la boucle mesurée
+#define FILL_CHUNK 256
+
+// Phases de partie : part des coups de la partie déjà joués
+typedef struct {
+    const char *name;
+    int percent;
+} Phase;
+
+static const Phase phases[] = {
+    {"early", 10},
+    {"mid",   50},
+    {"late",  90},
+};
+#define PHASE_COUNT ((int)(sizeof(phases) / sizeof(phases[0])))
+
+// Arguments d'un appel (position, dimensions ou taille, orientation, bateau)
+typedef struct {
+    int x, y;
+    int width, height;
+    int size;
+    int vertical;
+    int shipId;
+} BenchArgs;
+
+// Grilles d'une phase et copie de travail (primitives qui écrivent)
+typedef struct {
+    int boards[BOARD_COUNT][GRID][GRID];
+    int work[BOARD_COUNT][GRID][GRID];
+    int shots;                         // Coups joués sur l'ensemble des grilles
+} PhaseBoards;
+
+static PhaseBoards phaseBoards[PHASE_COUNT];
+static BenchArgs args[ARG_COUNT];
+
+static int fillBuf[FILL_CHUNK];
+
+// Résultats accumulés : empêche le compilateur d'écarter les appels
+static volatile long sink;
+
+// Compteurs matériels (option -p, sinon aucun compteur ouvert)
+static PerfCounters counters;
+
+// Boucle mesurée : ops appels sur les grilles g, résultat accumulé
+typedef long (*BenchLoop)(int g[][GRID][GRID], int ops);
+
+// ============================================================================
+// BOUCLES MESURÉES (une par primitive : pas de choix dans la boucle)
+// L'appel i utilise la grille i % BOARD_COUNT et les arguments i % ARG_COUNT
+// ============================================================================
+static long loopIsAreaFree(int g[][GRID][GRID], int ops) {
+    long acc = 0;
+    for (int i = 0; i < ops; i++) {
+        const BenchArgs *a = &args[i & (ARG_COUNT - 1)];
+        acc += isAreaFree(g[i % BOARD_COUNT], a->x, a->y, a->width, a->height);
+    }
+    return acc;
+}
+
+static long loopCanPlaceShip(int g[][GRID][GRID], int ops) {
+    long acc = 0;
+    for (int i = 0; i < ops; i++) {
+        const BenchArgs *a = &args[i & (ARG_COUNT - 1)];
+        acc += canPlaceShip(g[i % BOARD_COUNT], a->x, a->y, a->size, a->vertical);
+    }
+    return acc;
+}
+
+static long loopCanPlaceShip5x2(int g[][GRID][GRID], int ops) {
+    long acc = 0;
+    for (int i = 0; i < ops; i++) {
+        const BenchArgs *a = &args[i & (ARG_COUNT - 1)];
+        acc += canPlaceShip5x2Manual(g[i % BOARD_COUNT], a->x, a->y, a->vertical);
+    }
+    return acc;
+}
+
+static long loopIsShipSunk(int g[][GRID][GRID], int ops) {
+    long acc = 0;
+    for (int i = 0; i < ops; i++)
+        acc += isShipSunk(g[i % BOARD_COUNT], args[i & (ARG_COUNT - 1)].shipId);
+    return acc;
+}
+
+static long loopMarkShipSunk(int g[][GRID][GRID], int ops) {
+    for (int i = 0; i < ops; i++)
+        markShipSunk(g[i % BOARD_COUNT], args[i & (ARG_COUNT - 1)].shipId);
+    return g[0][0][0];
+}
+
+static long loopAllDestroyed(int g[][GRID][GRID], int ops) {
+    long acc = 0;
+    for (int i = 0; i < ops; i++)
+        acc += allDestroyed(g[i % BOARD_COUNT]);
+    return acc;
+}
+
+static long loopClearGrid(int g[][GRID][GRID], int ops) {
+    for (int i = 0; i < ops; i++)
+        clearGrid(g[i % BOARD_COUNT]);
+    return g[0][0][0];
+}
+
+static long loopPlaceShips(int g[][GRID][GRID], int ops) {
+    long acc = 0;
+    for (int i = 0; i < ops; i++) {
+        int (*b)[GRID] = g[i % BOARD_COUNT];
+        clearGrid(b);
+        placeShips(b, &shipConfig);
+        acc += b[0][0];
+    }
+    return acc;
+}
+
+// Tirages randFill : ops valeurs par blocs de FILL_CHUNK (ns par tirage)
+static long loopRandFill(void (*fill)(int *out, int count), int ops) {
+    long acc = 0;
+    for (int done = 0; done < ops; done += FILL_CHUNK) {
+        int n = ops - done < FILL_CHUNK ? ops - done : FILL_CHUNK;
+        fill(fillBuf, n);
+        acc += fillBuf[n - 1];
+    }
+    return acc;
+}
+
+static long loopRandFillGeneric(int g[][GRID][GRID], int ops) {
+    (void)g;
+    return loopRandFill(randFillGeneric, ops);
+}
+
+static long loopRandFillSse42(int g[][GRID][GRID], int ops) {
+    (void)g;
+    return loopRandFill(randFillSse42, ops);
+}
+
+static long loopRandFillAvx2(int g[][GRID][GRID], int ops) {
+    (void)g;
+    return loopRandFill(randFillAvx2, ops);
+}
+
+static long loopRandFillAvx512(int g[][GRID][GRID], int ops) {
+    (void)g;
+    return loopRandFill(randFillAvx512, ops);
+}
+
+// Primitives mesurées
+typedef struct {
+    const char *name;
+    BenchLoop loop;
+    int phased;          // 1 : mesurée sur chaque phase, 0 : sur une grille vide
+    int writes;          // 1 : écrit dans la grille (copie de travail)
+    CpuLevel level;      // Extensions requises (ignorée si le processeur ne les a pas)
+} Primitive;
+
+// placeShips part d'une grille vide : son appel comprend clearGrid, mesuré
+// à part pour pouvoir le retrancher. markShipSunk écrit dans une copie des
+// grilles refaite avant chaque répétition : seul son premier appel sur un
+// bateau touché écrit, les suivants ne font que parcourir la grille (coût
+// dominant, identique). Les variantes de randFill ne lisent pas les grilles :
+// un appel est un tirage
+static const Primitive primitives[] = {
+    {"isAreaFree",            loopIsAreaFree,      1, 0, CPU_GENERIC},
+    {"canPlaceShip",          loopCanPlaceShip,    1, 0, CPU_GENERIC},
+    {"canPlaceShip5x2Manual", loopCanPlaceShip5x2, 1, 0, CPU_GENERIC},
+    {"isShipSunk",            loopIsShipSunk,      1, 0, CPU_GENERIC},
+    {"markShipSunk",          loopMarkShipSunk,    1, 1, CPU_GENERIC},
+    {"allDestroyed",          loopAllDestroyed,    1, 0, CPU_GENERIC},
+    {"clearGrid",             loopClearGrid,       0, 1, CPU_GENERIC},
+    {"placeShips",            loopPlaceShips,      0, 1, CPU_GENERIC},
+    {"randFillGeneric",       loopRandFillGeneric, 0, 0, CPU_GENERIC},
+    {"randFillSse42",         loopRandFillSse42,   0, 0, CPU_SSE42},
+    {"randFillAvx2",          loopRandFillAvx2,    0, 0, CPU_AVX2},
+    {"randFillAvx512",        loopRandFillAvx512,  0, 0, CPU_AVX512},
+};
+#define PRIMITIVE_COUNT ((int)(sizeof(primitives) / sizeof(primitives[0])))
+
+// Résultat d'une mesure
+typedef struct {
+    char primitive[32];
+    char phase[16];
+    double best;         // Meilleure répétition (ns par appel)
+    double median;       // Médiane des répétitions (ns par appel)
+    double worst;        // Pire répétition (ns par appel)
+} BenchResult;
+
+// ============================================================================
+// FONCTION : buildPhase (interne)
+// DESCRIPTION : Grilles d'une phase : la partie n°b est jouée une première
+//               fois pour connaître sa longueur, puis rejouée (mêmes
+//               tirages) jusqu'à la part de coups voulue
+// ============================================================================
+static void buildPhase(PhaseBoards *pb, uint64_t runSeed, int percent) {
+    pb->shots = 0;
+    for (int b = 0; b < BOARD_COUNT; b++) {
+        Player target;
+        AIState state;
+        int shots = 0, stop = -1;
+
+        for (int pass = 0; pass < 2; pass++) {
+            shots = 0;
+            seed = philoxSeed(runSeed, (uint32_t)b, RNG_STREAM_FLEET);
+            initPlayer(&target);
+            initAIState(&state);
+            placeShips(target.grid, &shipConfig);
+            seed = philoxSeed(runSeed, (uint32_t)b, RNG_STREAM_AI);
+
+            while (!allDestroyed(target.grid) && shots < GRID * GRID && shots != stop) {
+                enemyHard(&target, &state);
+                shots++;
+            }
+            stop = shots * percent / 100;
+        }
+        memcpy(pb->boards[b], target.grid, sizeof(target.grid));
+        pb->shots += shots;
+    }
+}
+
+// ============================================================================
+// FONCTION : buildArgs (interne)
+// DESCRIPTION : Arguments tirés comme ceux du jeu : positions dans la grille,
+//               dimensions et tailles de la flotte, bateaux existants
+// ============================================================================
+static void buildArgs(uint64_t runSeed) {
+    seed = philoxSeed(runSeed, 0, RNG_STREAM_AI) ^ 0x5bd1e995u;
+    for (int i = 0; i < ARG_COUNT; i++) {
+        BenchArgs *a = &args[i];
+        int s = myRand() % SHIP_COUNT;
+        int size = shipConfig.sizes[s];
+
+        a->vertical = myRand() % 2;
+        a->size = size > 0 ? size : 5;
+        if (size > 0) {
+            a->width = a->vertical ? 1 : size;
+            a->height = a->vertical ? size : 1;
+        } else {
+            a->width = a->vertical ? 2 : 5;
+            a->height = a->vertical ? 5 : 2;
+        }
+        a->x = myRand() % GRID;
+        a->y = myRand() % GRID;
+        a->shipId = 1 + myRand() % SHIP_COUNT;
+    }
+}
+
+// ============================================================================
+// FONCTION : checkRandFill (interne)
+// DESCRIPTION : Compare chaque variante de randFill utilisable à
+//               randFillGeneric : mêmes valeurs et même graine finale, pour
+//               plusieurs graines et des longueurs autour des largeurs de
+//               registre (4, 8 et 16 tirages), restes compris
+// RETOUR : nombre de variantes qui diffèrent
+// ============================================================================
+static int checkRandFill(unsigned int runSeed) {
+    static const struct {
+        const char *name;
+        void (*fill)(int *out, int count);
+        CpuLevel level;
+    } variants[] = {
+        {"randFillSse42",  randFillSse42,  CPU_SSE42},
+        {"randFillAvx2",   randFillAvx2,   CPU_AVX2},
+        {"randFillAvx512", randFillAvx512, CPU_AVX512},
+    };
+    static const int lengths[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 100, FILL_CHUNK};
+    const unsigned int seeds[] = {runSeed, 0u, 0xffffffffu};
+    static int expected[FILL_CHUNK], got[FILL_CHUNK];
+    CpuLevel detected = cpuDetect();
+    int failures = 0;
+
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        if (variants[v].level > detected)
+            continue;
+        int same = 1;
+        for (size_t s = 0; s < sizeof(seeds) / sizeof(seeds[0]) && same; s++) {
+            for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]) && same; l++) {
+                int n = lengths[l];
+                seed = seeds[s];
+                randFillGeneric(expected, n);
+                unsigned int expectedSeed = seed;
+                seed = seeds[s];
+                memset(got, 0, sizeof(got));
+                variants[v].fill(got, n);
+                if (seed != expectedSeed || memcmp(got, expected, (size_t)n * sizeof(int)) != 0) {
+                    fprintf(stderr, "%s diffère de randFillGeneric (graine %u, %d tirages)\n",
+                            variants[v].name, seeds[s], n);
+                    same = 0;
+                }
+            }
+        }
+        failures += !same;
+    }
+    return failures;
+}
+
+// ============================================================================
+// FONCTION : compareDouble (interne)
+// DESCRIPTION : Ordre croissant pour qsort
+// ============================================================================
+static int compareDouble(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// ============================================================================
+// FONCTION : measure (interne)
+// DESCRIPTION : Échauffement, puis reps répétitions de ops appels ; les
+//               grilles écrites sont recopiées avant chaque répétition, hors
+//               mesure (compteurs matériels compris)
+// ============================================================================
+static void measure(const Primitive *p, PhaseBoards *pb, int ops, int reps, int warmup,
+                    BenchResult *r, PerfTotals *perf) {
+    static double perOp[MAX_REPS];
+    int (*grids)[GRID][GRID] = p->writes ? pb->work : pb->boards;
+
+    if (p->writes)
+        memcpy(pb->work, pb->boards, sizeof(pb->work));
+    if (warmup > 0)
+        sink += p->loop(grids, warmup);
+
+    perfTotalsInit(perf);
+    for (int r = 0; r < reps; r++) {
+        PerfReading counted;
+        if (p->writes)
+            memcpy(pb->work, pb->boards, sizeof(pb->work));
+        perfBegin(&counters, &counted);
+        uint64_t start = chronoNowNs();
+        sink += p->loop(grids, ops);
+        perOp[r] = (double)(chronoNowNs() - start) / ops;
+        perfEnd(&counters, &counted, perf);
+    }
+
+    qsort(perOp, (size_t)reps, sizeof(double), compareDouble);
+    r->best = perOp[0];
+    r->median = reps % 2 ? perOp[reps / 2] : (perOp[reps / 2 - 1] + perOp[reps / 2]) / 2.0;
+    r->worst = perOp[reps - 1];
+}
+
+// ============================================================================
+// FONCTION : readBaseline (interne)
+// DESCRIPTION : Lit un fichier écrit par -o (en-tête puis primitive, phase,
+//               appels, répétitions, meilleur, médiane, pire)
+// RETOUR : nombre de lignes lues, -1 si le fichier est illisible
+// ============================================================================
+static int readBaseline(const char *path, BenchResult *rows, int max) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int count = 0;
+
+    if (!f)
+        return -1;
+    if (!fgets(line, sizeof(line), f) || strncmp(line, "primitive,", 10) != 0) {
+        fclose(f);
+        return -1;
+    }
+    while (count < max && fgets(line, sizeof(line), f)) {
+        BenchResult *r = &rows[count];
+        char *tok[7];
+        int n = 0;
+        for (char *t = strtok(line, ",\r\n"); t && n < 7; t = strtok(NULL, ",\r\n"))
+            tok[n++] = t;
+        if (n < 7)
+            continue;
+        snprintf(r->primitive, sizeof(r->primitive), "%s", tok[0]);
+        snprintf(r->phase, sizeof(r->phase), "%s", tok[1]);
+        r->best = strtod(tok[4], NULL);
+        r->median = strtod(tok[5], NULL);
+        r->worst = strtod(tok[6], NULL);
+        count++;
+    }
+    fclose(f);
+    return count;
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int ops = 20000;                // Appels par répétition
+    int reps = 15;                  // Répétitions mesurées
+    int warmup = 20000;             // Appels d'échauffement
+    unsigned int runSeed = 12345;   // Graine des grilles et des arguments
+    const char *only = NULL;        // Filtre sur la primitive
+    const char *outPath = NULL;     // Fichier CSV
+    const char *basePath = NULL;    // Fichier de référence
+    int perf = 0;                   // Compteurs matériels
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            ops = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            warmup = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            runSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            basePath = argv[++i];
+        } else if (strcmp(argv[i], "-p") == 0) {
+            perf = 1;
+        } else {
+            fprintf(stderr, "Usage : %s [-n appels] [-r répétitions] [-w appels] [-s graine]"
+                    " [-f primitive] [-o fichier] [-b référence] [-p]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (ops < 1 || reps < 1 || reps > MAX_REPS || warmup < 0) {
+        fprintf(stderr, "Appels, répétitions (1 à %d) ou échauffement invalides\n", MAX_REPS);
+        return 1;
+    }
+
+    static BenchResult base[PRIMITIVE_COUNT * PHASE_COUNT];
+    int baseCount = 0;
+    if (basePath && (baseCount = readBaseline(basePath, base, PRIMITIVE_COUNT * PHASE_COUNT)) < 0) {
+        fprintf(stderr, "Référence illisible : %s\n", basePath);
+        return 1;
+    }
+
+    FILE *csv = NULL;
+    if (outPath && !(csv = fopen(outPath, "w"))) {
+        fprintf(stderr, "Impossible d'écrire %s\n", outPath);
+        return 1;
+    }
+
+    // Grilles et arguments : ne dépendent que de la graine
+    dispatchInit(CPU_AVX512);
+    for (int p = 0; p < PHASE_COUNT; p++)
+        buildPhase(&phaseBoards[p], runSeed, phases[p].percent);
+    buildArgs(runSeed);
+    if (checkRandFill(runSeed) > 0) {
+        if (csv)
+            fclose(csv);
+        return 1;
+    }
+    if (perf && perfOpen(&counters) == 0)
+        fprintf(stderr, "Compteurs matériels indisponibles (perf_event_open refusé)\n");
+
+    printf("Grilles : %d par phase, IA difficile, graine %u (", BOARD_COUNT, runSeed);
+    for (int p = 0; p < PHASE_COUNT; p++)
+        printf("%s%s = %d %% des coups, %.1f tirs", p ? ", " : "", phases[p].name,
+               phases[p].percent, (double)phaseBoards[p].shots / BOARD_COUNT);
+    printf(")\nrandFill : variantes jusqu'à %s identiques à randFillGeneric\n",
+           cpuLevelName(cpuDetect()));
+    printf("%d répétitions de %d appels après %d appels d'échauffement\n\n", reps, ops, warmup);
+    printf("%-22s %-6s %10s %10s %10s%s\n", "primitive", "phase", "min ns", "médiane", "max ns",
+           basePath ? "   référence" : "");
+    if (csv)
+        fprintf(csv, "primitive,phase,ops,reps,ns_min,ns_median,ns_max\n");
+
+    for (int i = 0; i < PRIMITIVE_COUNT; i++) {
+        const Primitive *prim = &primitives[i];
+        if ((only && strcmp(only, prim->name) != 0) || prim->level > cpuDetect())
+            continue;
+
+        for (int p = 0; p < (prim->phased ? PHASE_COUNT : 1); p++) {
+            BenchResult r;
+            PerfTotals counted;
+            measure(prim, &phaseBoards[p], ops, reps, warmup, &r, &counted);
+            snprintf(r.primitive, sizeof(r.primitive), "%s", prim->name);
+            snprintf(r.phase, sizeof(r.phase), "%s", prim->phased ? phases[p].name : "empty");
+
+            printf("%-22s %-6s %10.2f %10.2f %10.2f", r.primitive, r.phase, r.best, r.median,
+                   r.worst);
+            for (int b = 0; b < baseCount; b++)
+                if (strcmp(base[b].primitive, r.primitive) == 0
+                    && strcmp(base[b].phase, r.phase) == 0 && base[b].median > 0.0)
+                    printf("   %8.2f (%+.1f %%)", base[b].median,
+                           100.0 * (r.median - base[b].median) / base[b].median);
+            printf("\n");
+            if (counters.members > 0)
+                perfPrint(&counters, &counted, stdout, "    compteurs", (double)ops * reps,
+                          "appel");
+            fflush(stdout);
+            if (csv)
+                fprintf(csv, "%s,%s,%d,%d,%.3f,%.3f,%.3f\n", r.primitive, r.phase, ops, reps,
+                        r.best, r.median, r.worst);
+        }
+    }
+
+    if (csv)
+        fclose(csv);
+    perfClose(&counters);
+    return 0;
+}
@@ -0,0 +1,119 @@
+// ========================================================================
+// PROGRAMME : bookgen (générateur de la bibliothèque d'ouvertures)
+// DESCRIPTION : Explore hors ligne toutes les suites manqué/touché des
+//               premiers tirs de l'IA experte sur une grille vide et écrit
+//               le tir choisi pour chaque observation rencontrée (book.h)
+// USAGE : ./bookgen [-d profondeur] [-o fichier]
+//   -d profondeur : nombre de tirs explorés (défaut : 16, soit 2^16 - 1 positions)
+//   -o fichier    : fichier à écrire (défaut : opening.book)
+// NOTE : seules les issues « manqué » et « touché » sont explorées ; une
+//        observation avec un bateau coulé sort de la bibliothèque et l'IA
+//        revient au calcul normal
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour printf, fprintf
+#include <stdlib.h>     // Pour atoi, malloc, free
+#include <string.h>     // Pour strcmp
+#include "types.h"      // Définitions des types (Player, AIState, shipConfig)
+#include "utils.h"      // Initialisation des joueurs et de l'IA
+#include "ai.h"         // Choix du tir de l'IA experte
+#include "book.h"       // Écriture du fichier
+#include "kernels.h"    // Dispatch des noyaux
+#include "chrono.h"     // Horloge monotone
+
+// Profondeur maximale acceptée (2^20 positions)
+#define BOOKGEN_MAX_DEPTH 20
+
+// Entrées générées
+static BookEntry *entries = NULL;
+static size_t entryCount = 0;
+
+// ============================================================================
+// FONCTION : explore
+// DESCRIPTION : Parcours en profondeur de l'arbre des issues de tir
+// PARAMÈTRES :
+//   - board : grille adverse telle que l'IA la connaît (-99 manqué, -1 touché)
+//   - ai    : état de l'IA pour cette suite de tirs
+//   - depth : nombre de tirs restant à explorer
+// ============================================================================
+static void explore(const Player *board, const AIState *ai, int depth) {
+    int x, y;
+    Player nextBoard = *board;
+    AIState next = *ai;
+
+    if (depth == 0)
+        return;
+
+    expertChooseShot(&nextBoard, &next, &x, &y);
+    if (x == -1)
+        return;
+
+    entries[entryCount].key = ai->hash;
+    entries[entryCount].move = (uint8_t)(x * GRID + y);
+    entryCount++;
+
+    // Deux issues : manqué puis touché (la valeur exacte d'une touche
+    // n'intervient pas, seul l'état observé compte)
+    static const int outcomes[2] = {-99, -1};
+    for (int k = 0; k < 2; k++) {
+        nextBoard = *board;
+        next = *ai;
+        next.shots[x][y] = 1;
+        nextBoard.grid[x][y] = outcomes[k];
+        aiObserveShot(&nextBoard, &next, x, y);
+        explore(&nextBoard, &next, depth - 1);
+    }
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int depth = 16;
+    const char *path = BOOK_DEFAULT_PATH;
+    Player board;
+    AIState ai;
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else {
+            fprintf(stderr, "Usage : %s [-d profondeur] [-o fichier]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (depth <= 0 || depth > BOOKGEN_MAX_DEPTH) {
+        fprintf(stderr, "Profondeur invalide (1 à %d)\n", BOOKGEN_MAX_DEPTH);
+        return 1;
+    }
+
+    dispatchInit(CPU_AVX512);
+    aiSetCache(NULL);  // Calcul complet de chaque position
+
+    entries = malloc(sizeof(BookEntry) * (((size_t)1 << depth) - 1));
+    if (!entries) {
+        fprintf(stderr, "Mémoire insuffisante\n");
+        return 1;
+    }
+
+    uint64_t start = chronoNowNs();
+    initPlayer(&board);
+    initAIState(&ai);
+    explore(&board, &ai, depth);
+    double seconds = (double)(chronoNowNs() - start) / 1e9;
+
+    size_t written = bookWrite(path, entries, entryCount, &shipConfig, depth);
+    free(entries);
+    if (written == 0) {
+        fprintf(stderr, "Écriture impossible : %s\n", path);
+        return 1;
+    }
+
+    printf("Bibliothèque %s : %zu positions (%zu explorées, profondeur %d) en %.2f s\n",
+           path, written, entryCount, depth, seconds);
+    return 0;
+}
@@ -0,0 +1,523 @@
+// ========================================================================
+// PROGRAMME : loadgen (générateur de charge pour le serveur de parties)
+// DESCRIPTION : Connecte des milliers de joueurs simulés au serveur (server)
+//               sur la boucle locale et leur fait jouer des parties complètes
+//               à pleine vitesse : flotte tirée par placeShips, tirs choisis
+//               par une IA existante à partir de ce que le joueur a observé
+//               (elle ne voit jamais la grille adverse, comme un vrai client)
+//               Mesure le débit de parties, la latence aller-retour de chaque
+//               tir (FIRE -> RESULT) et le temps CPU du serveur
+//               Des spectateurs (-w) suivent en plus des parties en cours et
+//               vérifient que le flux reconstitue une flotte détruite
+//               Linux uniquement (epoll, /proc)
+// USAGE : ./loadgen [-c clients] [-w spectateurs] [-d secondes] [-p port]
+//                   [-u chemin] [-a ia] [-s graine] [-P pid]
+//   -c clients  : nombre de joueurs simulés (défaut : 2000)
+//   -w spectateurs : nombre de spectateurs (défaut : 0)
+//   -d secondes : durée de la mesure (défaut : 10)
+//   -p port     : port TCP du serveur sur 127.0.0.1 (défaut : 7777)
+//   -u chemin   : socket Unix du serveur (remplace le TCP)
+//   -a ia       : IA des joueurs : easy, expert, info (défaut : easy)
+//   -s graine   : graine des flottes et des IA (défaut : 12345)
+//   -P pid      : processus du serveur, pour mesurer son temps CPU
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#define _GNU_SOURCE     // Pour les extensions Linux
+#include <stdio.h>      // Pour printf, fprintf
+#include <stdlib.h>     // Pour atoi, malloc
+#include <string.h>     // Pour strcmp, memcpy
+#include <errno.h>      // Codes d'erreur des appels système
+#include <fcntl.h>      // Sockets non bloquantes
+#include <unistd.h>     // Pour read, write, close, sysconf
+#include <sys/epoll.h>  // Boucle d'événements
+#include <sys/socket.h> // Sockets
+#include <sys/un.h>     // Sockets Unix
+#include <sys/resource.h>  // Limite de descripteurs, temps CPU
+#include <netinet/in.h> // Adresses IPv4
+#include <netinet/tcp.h>   // TCP_NODELAY
+#include <arpa/inet.h>  // Pour htonl, htons
+#include "types.h"      // Player, AIState, seed
+#include "utils.h"      // placeShips, initPlayer, markShipSunk
+#include "ai.h"         // Choix des tirs des IA
+#include "kernels.h"    // Dispatch des noyaux
+#include "proto.h"      // Protocole binaire
+#include "chrono.h"     // Horloge monotone
+#include "stats.h"      // Histogramme des allers-retours
+
+// Événements traités par appel à epoll_wait
+#define EVENT_BATCH 1024
+
+// IA jouables à l'aveugle : leur choix ne dépend que de l'observation
+// (les IA moyenne et difficile résolvent leurs tirs sur la vraie grille
+// au milieu de leur poursuite, elles ne peuvent pas jouer en réseau)
+typedef enum {
+    BOT_EASY,                    // Case au hasard
+    BOT_EXPERT,                  // Densité maximale
+    BOT_INFO                     // Gain d'information maximal
+} BotLevel;
+
+static const char *const botNames[] = {"easy", "expert", "info"};
+
+// Joueur simulé
+typedef struct {
+    int fd;
+    int seat;                    // Place dans la partie en cours (-1 = aucune)
+    int myTurn;                  // Un FIRE est attendu de ce joueur
+    int shipCells;               // Cases de sa flotte encore intactes
+    uint64_t sentAt;             // Envoi du dernier FIRE (ns)
+    int watcher;                 // Spectateur plutôt que joueur
+    int rewatch;                 // Spectateur à réabonner (aucune partie en cours)
+    int rxLen;
+    uint8_t rx[2 * PROTO_MAX_MESSAGE];
+    Player view;                 // Grille adverse telle qu'observée (0 = inconnu)
+    AIState state;               // État de l'IA
+    int boards[2][GRID][GRID];   // Grilles reconstituées (spectateur)
+} Bot;
+
+// Latences aller-retour mesurées (ns)
+static Histogram latencies;
+
+// Compteurs
+static uint64_t gamesOver, forfeits, shots, errors, lost;
+static uint64_t feedMessages, feedGames, feedMismatches;
+static int rewatchPending;
+
+static BotLevel level = BOT_EASY;
+static int running = 1;
+
+// ============================================================================
+// FONCTION : sendRaw (interne)
+// DESCRIPTION : Envoie un message ; un joueur n'a jamais plus d'un message
+//               en vol, le tampon du noyau suffit toujours
+// RETOUR : 1 si le message est parti, 0 sinon
+// ============================================================================
+static int sendRaw(Bot *b, const ProtoMsg *msg) {
+    uint8_t buf[PROTO_MAX_MESSAGE];
+    size_t n = protoEncode(msg, buf, sizeof(buf));
+
+    return write(b->fd, buf, n) == (ssize_t)n;
+}
+
+// ============================================================================
+// FONCTION : sendHello / sendPlace (internes)
+// DESCRIPTION : Demande de partie ; flotte tirée au hasard par placeShips
+// ============================================================================
+static int sendHello(Bot *b) {
+    ProtoMsg msg = {.type = MSG_HELLO, .u.version = PROTO_VERSION};
+    return sendRaw(b, &msg);
+}
+
+static int sendPlace(Bot *b) {
+    int grid[GRID][GRID];
+    ProtoMsg msg = {.type = MSG_PLACE};
+
+    clearGrid(grid);
+    placeShips(grid, &shipConfig);
+    protoFleetFromGrid(grid, msg.u.fleet);
+
+    b->shipCells = 0;
+    for (int i = 0; i < GRID; i++)
+        for (int j = 0; j < GRID; j++)
+            b->shipCells += grid[i][j] > 0;
+    return sendRaw(b, &msg);
+}
+
+// ============================================================================
+// FONCTION : fire (interne)
+// DESCRIPTION : Choisit un tir avec l'IA du joueur sur sa grille observée
+// ============================================================================
+static int fire(Bot *b) {
+    ProtoMsg msg = {.type = MSG_FIRE};
+    int x = -1, y = -1;
+
+    switch (level) {
+    case BOT_EASY:
+        do {
+            x = myRand() % GRID;
+            y = myRand() % GRID;
+        } while (b->state.shots[x][y]);
+        break;
+    case BOT_EXPERT: expertChooseShot(&b->view, &b->state, &x, &y); break;
+    case BOT_INFO:   infoChooseShot(&b->view, &b->state, &x, &y); break;
+    }
+    if (x < 0)
+        return 0;
+
+    msg.u.fire.x = (uint8_t)x;
+    msg.u.fire.y = (uint8_t)y;
+    b->myTurn = 0;
+    b->sentAt = chronoNowNs();
+    return sendRaw(b, &msg);
+}
+
+// ============================================================================
+// FONCTION : observe (interne)
+// DESCRIPTION : Reporte le résultat d'un de ses tirs sur la grille observée,
+//               comme aiResolveShot le ferait sur la vraie grille
+// ============================================================================
+static void observe(Bot *b, int x, int y, int cell) {
+    b->state.shots[x][y] = 1;
+    protoApplyCell(b->view.grid, x, y, cell);
+    aiObserveShot(&b->view, &b->state, x, y);
+}
+
+// ============================================================================
+// FONCTION : sendWatch / onFeed (internes)
+// DESCRIPTION : Abonnement d'un spectateur à une partie en cours, puis
+//               reconstitution des deux grilles à partir du flux ; en fin de
+//               partie la flotte du perdant doit être entièrement coulée
+// ============================================================================
+static int sendWatch(Bot *b) {
+    ProtoMsg msg = {.type = MSG_WATCH};
+
+    msg.u.watch.version = PROTO_VERSION;
+    msg.u.watch.match = PROTO_ANY_MATCH;
+    return sendRaw(b, &msg);
+}
+
+static int onFeed(Bot *b, const ProtoMsg *msg) {
+    feedMessages++;
+    switch (msg->type) {
+    case MSG_KEYFRAME:
+        for (int p = 0; p < 2; p++)
+            for (int c = 0; c < GRID * GRID; c++)
+                b->boards[p][c / GRID][c % GRID] = protoCellValue(msg->u.keyframe.cells[p][c]);
+        return 1;
+
+    case MSG_DELTA: {
+        int c = msg->u.delta.index;
+        if (msg->u.delta.board > 1 || c >= GRID * GRID)
+            return 0;
+        protoApplyCell(b->boards[msg->u.delta.board], c / GRID, c % GRID,
+                       protoCellValue(msg->u.delta.code));
+        return 1;
+    }
+
+    case MSG_OVER:
+        if (msg->u.over.reason == OVER_FLEET_DESTROYED) {
+            feedGames++;
+            if (msg->u.over.winner > 1 || !allDestroyed(b->boards[1 - msg->u.over.winner]))
+                feedMismatches++;
+        }
+        return running ? sendWatch(b) : 1;
+
+    case MSG_ERROR:
+        b->rewatch = rewatchPending = 1;   // Aucune partie en cours : nouvel essai au tour suivant
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+
+// ============================================================================
+// FONCTION : onMessage (interne)
+// DESCRIPTION : Réagit à un message du serveur
+// RETOUR : 0 si la connexion doit être fermée, 1 sinon
+// ============================================================================
+static int onMessage(Bot *b, const ProtoMsg *msg) {
+    if (b->watcher)
+        return onFeed(b, msg);
+
+    switch (msg->type) {
+    case MSG_MATCHED:
+        b->seat = msg->u.seat;
+        return sendPlace(b);
+
+    case MSG_START:
+        initPlayer(&b->view);
+        initAIState(&b->state);
+        b->myTurn = b->seat == 0;
+        return b->myTurn ? fire(b) : 1;
+
+    case MSG_RESULT: {
+        int x = msg->u.result.x, y = msg->u.result.y, cell = msg->u.result.cell;
+        if (msg->u.result.seat == b->seat) {
+            histRecord(&latencies, chronoNowNs() - b->sentAt);
+            shots++;
+            observe(b, x, y, cell);
+            return 1;
+        }
+        // Tir adverse : la main revient, sauf s'il vient de couler la flotte
+        b->shipCells -= cell != -99;
+        b->myTurn = b->shipCells > 0;
+        return b->myTurn ? fire(b) : 1;
+    }
+
+    case MSG_OVER:
+        b->seat = -1;
+        b->myTurn = 0;
+        gamesOver++;
+        if (msg->u.over.reason == OVER_FORFEIT)
+            forfeits++;
+        return running ? sendHello(b) : 1;
+
+    case MSG_ERROR:
+        errors++;
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+
+// ============================================================================
+// FONCTION : onReadable (interne)
+// DESCRIPTION : Lit et traite les messages complets
+// RETOUR : 0 si la connexion est perdue, 1 sinon
+// ============================================================================
+static int onReadable(Bot *b) {
+    ssize_t n = read(b->fd, b->rx + b->rxLen, sizeof(b->rx) - (size_t)b->rxLen);
+    int offset = 0;
+
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR))
+        return 0;
+    if (n < 0)
+        return 1;
+    b->rxLen += (int)n;
+
+    for (;;) {
+        ProtoMsg msg;
+        int used = protoDecode(b->rx + offset, (size_t)(b->rxLen - offset), &msg);
+        if (used == 0)
+            break;
+        if (used < 0 || !onMessage(b, &msg))
+            return 0;
+        offset += used;
+    }
+    memmove(b->rx, b->rx + offset, (size_t)(b->rxLen - offset));
+    b->rxLen -= offset;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : connectBot (interne)
+// DESCRIPTION : Connexion (bloquante, immédiate sur la boucle locale) puis
+//               passage en mode non bloquant
+// RETOUR : descripteur, -1 en cas d'échec
+// ============================================================================
+static int connectBot(int port, const char *unixPath) {
+    int fd;
+
+    if (unixPath) {
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, unixPath, sizeof(addr.sun_path) - 1);
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        struct sockaddr_in addr;
+        int one = 1;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons((uint16_t)port);
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+        if (fd >= 0)
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    if (fd >= 0)
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+// ============================================================================
+// FONCTION : processCpuSeconds (interne)
+// DESCRIPTION : Temps CPU d'un autre processus (champs 14 et 15 de /proc/pid/stat)
+// RETOUR : secondes, -1 si le processus est introuvable
+// ============================================================================
+static double processCpuSeconds(int pid) {
+    char path[64], line[1024];
+    FILE *f;
+
+    snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+    if (!(f = fopen(path, "r")))
+        return -1.0;
+    size_t len = fread(line, 1, sizeof(line) - 1, f);
+    fclose(f);
+    line[len] = '\0';
+
+    // Le nom du programme (champ 2) peut contenir des espaces : on repart de ')'
+    char *p = strrchr(line, ')');
+    unsigned long utime, stime;
+    if (!p || sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+                     &utime, &stime) != 2)
+        return -1.0;
+    return (double)(utime + stime) / (double)sysconf(_SC_CLK_TCK);
+}
+
+static double selfCpuSeconds(void) {
+    struct rusage ru;
+
+    getrusage(RUSAGE_SELF, &ru);
+    return (double)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec)
+         + (double)(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e6;
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int clients = 2000;             // Joueurs simulés
+    int watchers = 0;               // Spectateurs
+    int duration = 10;              // Durée de la mesure (s)
+    int port = 7777;                // Port TCP du serveur
+    const char *unixPath = NULL;    // Socket Unix du serveur
+    unsigned int baseSeed = 12345;  // Graine des flottes et des IA
+    int serverPid = 0;              // Processus du serveur (0 = inconnu)
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            clients = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            watchers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            duration = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+            unixPath = argv[++i];
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            baseSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-P") == 0 && i + 1 < argc) {
+            serverPid = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            const char *name = argv[++i];
+            int found = -1;
+            for (int l = 0; l < (int)(sizeof(botNames) / sizeof(botNames[0])); l++)
+                if (strcmp(botNames[l], name) == 0)
+                    found = l;
+            if (found < 0) {
+                fprintf(stderr, "IA inconnue ou non jouable en réseau : %s (easy, expert, info)\n", name);
+                return 1;
+            }
+            level = (BotLevel)found;
+        } else {
+            fprintf(stderr, "Usage : %s [-c clients] [-w spectateurs] [-d secondes] [-p port] "
+                            "[-u chemin] [-a ia] [-s graine] [-P pid]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (clients < 2 || watchers < 0 || duration <= 0) {
+        fprintf(stderr, "Options invalides\n");
+        return 1;
+    }
+
+    // Un descripteur par joueur et par spectateur
+    int total = clients + watchers;
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < (rlim_t)total + 16) {
+        rl.rlim_cur = rl.rlim_max < (rlim_t)total + 16 ? rl.rlim_max : (rlim_t)total + 16;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+
+    dispatchInit(CPU_AVX512);
+    histInit(&latencies);
+    seed = baseSeed;
+
+    Bot *bots = calloc((size_t)total, sizeof(Bot));
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (!bots || epfd < 0) {
+        fprintf(stderr, "Initialisation impossible\n");
+        return 1;
+    }
+
+    // Connexion de tous les joueurs, puis demande de partie ; les spectateurs
+    // s'abonnent une fois les premières parties commencées
+    uint64_t connectStart = chronoNowNs();
+    for (int c = 0; c < total; c++) {
+        Bot *b = &bots[c];
+        struct epoll_event ev;
+
+        b->seat = -1;
+        if ((b->fd = connectBot(port, unixPath)) < 0) {
+            fprintf(stderr, "Connexion %d refusée : %s\n", c, strerror(errno));
+            return 1;
+        }
+        ev.events = EPOLLIN;
+        ev.data.u32 = (uint32_t)c;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, b->fd, &ev);
+        b->watcher = c >= clients;
+        if (b->watcher)
+            b->rewatch = rewatchPending = 1;
+        else
+            sendHello(b);
+    }
+    printf("%d joueurs (%s) connectés en %.2f s\n", clients, botNames[level],
+           (double)(chronoNowNs() - connectStart) / 1e9);
+    fflush(stdout);
+
+    // Mesure
+    struct epoll_event events[EVENT_BATCH];
+    double serverCpu0 = serverPid > 0 ? processCpuSeconds(serverPid) : -1.0;
+    double selfCpu0 = selfCpuSeconds();
+    uint64_t start = chronoNowNs();
+    uint64_t end = start + (uint64_t)duration * 1000000000ull;
+    uint64_t games0 = gamesOver;
+    uint64_t lastRewatch = 0;
+
+    while (chronoNowNs() < end) {
+        int count = epoll_wait(epfd, events, EVENT_BATCH, rewatchPending ? 10 : 100);
+        for (int i = 0; i < count; i++) {
+            Bot *b = &bots[events[i].data.u32];
+            if (b->fd >= 0 && !onReadable(b)) {
+                close(b->fd);   // Retire aussi le descripteur d'epoll
+                b->fd = -1;
+                lost++;
+            }
+        }
+        // Réabonnements groupés, au plus toutes les 10 ms
+        if (rewatchPending && chronoNowNs() - lastRewatch >= 10000000ull) {
+            lastRewatch = chronoNowNs();
+            rewatchPending = 0;
+            for (int c = clients; c < total; c++)
+                if (bots[c].rewatch && bots[c].fd >= 0) {
+                    bots[c].rewatch = 0;
+                    sendWatch(&bots[c]);
+                }
+        }
+    }
+    running = 0;
+
+    double seconds = (double)(chronoNowNs() - start) / 1e9;
+    double serverCpu = serverCpu0 >= 0 ? processCpuSeconds(serverPid) - serverCpu0 : -1.0;
+    double selfCpu = selfCpuSeconds() - selfCpu0;
+    uint64_t games = (gamesOver - games0) / 2;   // Les deux joueurs de chaque partie sont ici
+
+    for (int c = 0; c < total; c++)
+        if (bots[c].fd >= 0)
+            close(bots[c].fd);
+
+    printf("Sur %.1f s : %lu parties terminées, %lu tirs\n", seconds,
+           (unsigned long)games, (unsigned long)shots);
+    printf("  Débit        : %.0f parties/s, %.0f tirs/s\n", games / seconds, shots / seconds);
+    if (latencies.count > 0)
+        printf("  Aller-retour : p50 %.0f µs, p99 %.0f µs, p99,9 %.0f µs, max %.0f µs (%llu tirs)\n",
+               (double)histPercentile(&latencies, 50.0) / 1e3,
+               (double)histPercentile(&latencies, 99.0) / 1e3,
+               (double)histPercentile(&latencies, 99.9) / 1e3, (double)latencies.max / 1e3,
+               (unsigned long long)latencies.count);
+    if (serverCpu >= 0)
+        printf("  CPU serveur  : %.1f s (%.0f %% d'un cœur)\n", serverCpu, 100.0 * serverCpu / seconds);
+    if (watchers > 0)
+        printf("  Spectateurs  : %lu messages reçus, %lu fins de partie vérifiées, %lu incohérentes\n",
+               (unsigned long)feedMessages, (unsigned long)feedGames, (unsigned long)feedMismatches);
+    printf("  CPU client   : %.1f s (%.0f %% d'un cœur)\n", selfCpu, 100.0 * selfCpu / seconds);
+    if (errors > 0 || forfeits > 0 || lost > 0)
+        printf("  Anomalies    : %lu erreurs, %lu forfaits, %lu connexions perdues\n",
+               (unsigned long)errors, (unsigned long)forfeits, (unsigned long)lost);
+
+    free(bots);
+    close(epfd);
+    return 0;
+}
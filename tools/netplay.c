@@ -0,0 +1,383 @@
+// ========================================================================
+// PROGRAMME : netplay (partie à deux en réseau, en lockstep)
+// DESCRIPTION : Joue une partie contre un autre netplay sans serveur : les
+//               pairs n'échangent que leurs tirs, la réponse à chaque tir
+//               reçu et un octet de contrôle de leur état (lockstep.h)
+//               Chaque flotte est engagée par son empreinte SHA-256 avant
+//               le premier tir puis dévoilée à la fin : la partie est alors
+//               rejouée dans le moteur pour vérifier toutes les réponses
+//               Les tirs sont choisis par une IA qui ne voit que ce qu'elle
+//               a observé (comme un client de loadgen)
+// USAGE : ./netplay -l | -c [-H adresse] [-p port] [-u chemin] [-a ia]
+//                   [-s graine] [-x] [-v]
+//   -l          : héberge la partie (attend un pair)
+//   -c          : rejoint la partie d'un hôte
+//   -H adresse  : adresse IPv4 d'écoute ou de l'hôte (défaut : 127.0.0.1)
+//   -p port     : port TCP (défaut : 7778)
+//   -u chemin   : socket Unix (remplace le TCP)
+//   -a ia       : IA qui tire : easy, expert, info (défaut : expert)
+//   -s graine   : graine de la flotte et de l'IA, décalée de la place (pour
+//                 rejouer une partie ; défaut : tirée de /dev/urandom)
+//   -x          : triche (cache le premier bateau touché) pour vérifier
+//                 que l'adversaire la détecte
+//   -v          : affiche chaque tir
+//   Code de sortie : 0 partie vérifiée, 2 anomalie détectée, 1 erreur
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#define _GNU_SOURCE     // Pour les extensions Linux
+#include <stdio.h>      // Pour printf, fprintf
+#include <stdlib.h>     // Pour atoi, strtoul
+#include <string.h>     // Pour strcmp, memset
+#include <errno.h>      // Codes d'erreur des appels système
+#include <fcntl.h>      // Pour open (/dev/urandom)
+#include <unistd.h>     // Pour read, write, close, unlink
+#include <sys/socket.h> // Sockets
+#include <sys/un.h>     // Sockets Unix
+#include <netinet/in.h> // Adresses IPv4
+#include <netinet/tcp.h>   // TCP_NODELAY
+#include <arpa/inet.h>  // Pour inet_pton, htons
+#include "types.h"      // Player, AIState, seed
+#include "utils.h"      // placeShips, initPlayer, initAIState
+#include "ai.h"         // Choix des tirs des IA
+#include "kernels.h"    // Dispatch des noyaux
+#include "lockstep.h"   // Protocole lockstep
+#include "chrono.h"     // Horloge monotone
+
+// IA jouables à l'aveugle (voir loadgen)
+typedef enum {
+    BOT_EASY,                    // Case au hasard
+    BOT_EXPERT,                  // Densité maximale
+    BOT_INFO                     // Gain d'information maximal
+} BotLevel;
+
+static const char *const botNames[] = {"easy", "expert", "info"};
+
+// Octets échangés
+static size_t bytesSent, bytesReceived;
+
+// ============================================================================
+// FONCTIONS : sendMsg / recvMsg (internes)
+// DESCRIPTION : Un message entier, en E/S bloquantes
+// RETOUR : 1 en cas de succès, 0 si la connexion est perdue ou le flux invalide
+// ============================================================================
+static int sendMsg(int fd, const LockstepMsg *msg) {
+    uint8_t buf[LOCKSTEP_MAX_MESSAGE];
+    size_t len = lockstepEncode(msg, buf, sizeof(buf)), done = 0;
+
+    while (done < len) {
+        ssize_t n = write(fd, buf + done, len - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return 0;
+        done += (size_t)n;
+    }
+    bytesSent += len;
+    return 1;
+}
+
+static int recvMsg(int fd, LockstepMsg *msg) {
+    uint8_t buf[LOCKSTEP_MAX_MESSAGE];
+    size_t len = 1, done = 0;
+
+    while (done < len) {
+        ssize_t n = read(fd, buf + done, len - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return 0;
+        done += (size_t)n;
+        if (done == 1 && (len = lockstepSize(buf[0])) == 0)
+            return 0;
+    }
+    bytesReceived += len;
+    return lockstepDecode(buf, len, msg) > 0;
+}
+
+// ============================================================================
+// FONCTION : openPeer (interne)
+// DESCRIPTION : Hôte : écoute et accepte un seul pair ; invité : se connecte,
+//               en réessayant pendant cinq secondes si l'hôte n'écoute pas encore
+// RETOUR : descripteur connecté, -1 en cas d'échec
+// ============================================================================
+static int openPeer(int host, const char *address, int port, const char *unixPath) {
+    struct sockaddr_storage storage;
+    socklen_t len;
+    int family;
+
+    memset(&storage, 0, sizeof(storage));
+    if (unixPath) {
+        struct sockaddr_un *addr = (struct sockaddr_un *)&storage;
+        addr->sun_family = AF_UNIX;
+        strncpy(addr->sun_path, unixPath, sizeof(addr->sun_path) - 1);
+        family = AF_UNIX;
+        len = sizeof(*addr);
+    } else {
+        struct sockaddr_in *addr = (struct sockaddr_in *)&storage;
+        addr->sin_family = AF_INET;
+        addr->sin_port = htons((uint16_t)port);
+        if (inet_pton(AF_INET, address, &addr->sin_addr) != 1)
+            return -1;
+        family = AF_INET;
+        len = sizeof(*addr);
+    }
+
+    int fd = -1;
+    if (host) {
+        int one = 1;
+        int listener = socket(family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listener < 0)
+            return -1;
+        if (unixPath)
+            unlink(unixPath);
+        else
+            setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(listener, (struct sockaddr *)&storage, len) == 0 && listen(listener, 1) == 0)
+            fd = accept4(listener, NULL, NULL, SOCK_CLOEXEC);
+        close(listener);
+        if (unixPath)
+            unlink(unixPath);
+    } else {
+        uint64_t deadline = chronoNowNs() + 5000000000ULL;
+        for (;;) {
+            fd = socket(family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (fd < 0 || connect(fd, (struct sockaddr *)&storage, len) == 0)
+                break;
+            close(fd);
+            fd = -1;
+            if (chronoNowNs() > deadline)
+                break;
+            usleep(50000);
+        }
+    }
+
+    if (fd >= 0 && !unixPath) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+// ============================================================================
+// FONCTION : randomBytes (interne)
+// DESCRIPTION : Octets imprévisibles (sel de l'engagement, jeton du tirage
+//               au sort, graine), lus dans /dev/urandom (repli sur l'horloge
+//               et le numéro de processus)
+// ============================================================================
+static void randomBytes(uint8_t *out, size_t n) {
+    int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+
+    if (fd >= 0 && read(fd, out, n) == (ssize_t)n) {
+        close(fd);
+        return;
+    }
+    if (fd >= 0)
+        close(fd);
+    uint64_t mix = chronoNowNs() ^ (uint64_t)getpid() << 32;
+    for (size_t i = 0; i < n; i++) {
+        mix = mix * 6364136223846793005ULL + 1442695040888963407ULL;
+        out[i] = (uint8_t)(mix >> 56);
+    }
+}
+
+// ============================================================================
+// FONCTION : chooseShot (interne)
+// DESCRIPTION : Tir de l'IA à partir de la grille observée
+// ============================================================================
+static void chooseShot(BotLevel level, Player *view, AIState *state, int *x, int *y) {
+    switch (level) {
+    case BOT_EASY:
+        do {
+            *x = myRand() % GRID;
+            *y = myRand() % GRID;
+        } while (state->shots[*x][*y]);
+        break;
+    case BOT_EXPERT: expertChooseShot(view, state, x, y); break;
+    case BOT_INFO:   infoChooseShot(view, state, x, y); break;
+    }
+}
+
+// ============================================================================
+// FONCTION : cheat (interne)
+// DESCRIPTION : Triche de l'option -x : la première touche reçue est annoncée
+//               dans l'eau. La grille publique locale est falsifiée de la même
+//               façon pour que l'octet de contrôle reste cohérent : seule la
+//               vérification de fin de partie peut la détecter
+// RETOUR : 1 si la réponse a été falsifiée, 0 sinon
+// ============================================================================
+static int cheat(Lockstep *ls) {
+    int code = ls->answer;
+
+    if (code == LOCKSTEP_NONE || (code & 0x30) != 0x10)
+        return 0;
+    const LockstepShot *last = &ls->log[ls->shots - 1];
+    ls->boards[ls->seat][last->index / GRID][last->index % GRID] = -99;
+    ls->log[ls->shots - 1].code = 0x20;
+    ls->answer = 0x20;
+    return 1;
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int host = -1;                  // 1 hôte, 0 invité
+    const char *address = "127.0.0.1";
+    int port = 7778;                // Port TCP
+    const char *unixPath = NULL;    // Socket Unix
+    BotLevel level = BOT_EXPERT;    // IA qui tire
+    unsigned int baseSeed = 0;      // Graine de la flotte et de l'IA (option -s)
+    int seeded = 0;                 // Graine imposée par -s
+    int cheating = 0;               // Option -x
+    int verbose = 0;                // Option -v
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-l") == 0) {
+            host = 1;
+        } else if (strcmp(argv[i], "-c") == 0) {
+            host = 0;
+        } else if (strcmp(argv[i], "-H") == 0 && i + 1 < argc) {
+            address = argv[++i];
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+            unixPath = argv[++i];
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            baseSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+            seeded = 1;
+        } else if (strcmp(argv[i], "-x") == 0) {
+            cheating = 1;
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+        } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            const char *name = argv[++i];
+            int found = -1;
+            for (int l = 0; l < (int)(sizeof(botNames) / sizeof(botNames[0])); l++)
+                if (strcmp(botNames[l], name) == 0)
+                    found = l;
+            if (found < 0) {
+                fprintf(stderr, "IA inconnue ou non jouable en réseau : %s (easy, expert, info)\n", name);
+                return 1;
+            }
+            level = (BotLevel)found;
+        } else {
+            host = -1;
+            break;
+        }
+    }
+    if (host < 0) {
+        fprintf(stderr, "Usage : %s -l | -c [-H adresse] [-p port] [-u chemin] [-a ia] "
+                        "[-s graine] [-x] [-v]\n", argv[0]);
+        return 1;
+    }
+
+    dispatchInit(CPU_AVX512);
+
+    // Graine propre à chaque pair : tirée au hasard, ou imposée par -s et
+    // décalée de la place pour que les deux pairs lancés avec la même
+    // graine n'aient pas la même flotte ni les mêmes tirs
+    if (seeded) {
+        seed = baseSeed + (host ? 0u : 1u);
+    } else {
+        uint8_t bytes[sizeof(seed)];
+        randomBytes(bytes, sizeof(bytes));
+        memcpy(&seed, bytes, sizeof(seed));
+    }
+
+    // Flotte placée et engagée avant même la connexion
+    Player own, view;
+    AIState state;
+    Lockstep ls;
+    LockstepMsg msg, peer;
+    uint8_t salt[LOCKSTEP_SALT], nonce[LOCKSTEP_NONCE];
+
+    initPlayer(&own);
+    initPlayer(&view);
+    initAIState(&state);
+    placeShips(own.grid, &shipConfig);
+    randomBytes(salt, LOCKSTEP_SALT);
+    randomBytes(nonce, LOCKSTEP_NONCE);
+    lockstepInit(&ls, host ? 0 : 1, own.grid, salt, nonce, &msg);
+
+    int fd = openPeer(host, address, port, unixPath);
+    if (fd < 0) {
+        fprintf(stderr, "Connexion impossible : %s\n", strerror(errno));
+        return 1;
+    }
+
+    LockstepStatus status = LOCKSTEP_OK;
+    uint64_t start = chronoNowNs();
+    if (!sendMsg(fd, &msg) || !recvMsg(fd, &peer)) {
+        fprintf(stderr, "Connexion perdue avant la partie\n");
+        return 1;
+    }
+
+    // Tirage au sort du premier tireur : jetons dévoilés après les engagements
+    status = lockstepStart(&ls, &peer, &msg);
+    if (status == LOCKSTEP_OK && (!sendMsg(fd, &msg) || !recvMsg(fd, &peer))) {
+        fprintf(stderr, "Connexion perdue avant la partie\n");
+        return 1;
+    }
+    if (status == LOCKSTEP_OK)
+        status = lockstepFlip(&ls, &peer);
+    if (verbose && status == LOCKSTEP_OK)
+        printf("Place %d, la place %d commence\n", ls.seat, ls.first);
+
+    // Tour à tour : un MOVE envoyé ou reçu par coup, jusqu'au tir manquant
+    while (status == LOCKSTEP_OK && ls.turn >= 0) {
+        if (lockstepMyTurn(&ls)) {
+            int x = -1, y = -1;
+            if (!ls.over)
+                chooseShot(level, &view, &state, &x, &y);
+            if (cheating && !ls.over && cheat(&ls))
+                cheating = 0;
+            status = lockstepMove(&ls, x, y, &msg);
+            if (status == LOCKSTEP_OK && !sendMsg(fd, &msg)) {
+                fprintf(stderr, "Connexion perdue\n");
+                return 1;
+            }
+            if (verbose && x >= 0)
+                printf("  tir %2d %2d\n", x, y);
+        } else {
+            int pending = ls.pending;
+            if (!recvMsg(fd, &msg)) {
+                fprintf(stderr, "Connexion perdue (abandon de l'adversaire)\n");
+                return 1;
+            }
+            status = lockstepReceive(&ls, &msg);
+            if (status == LOCKSTEP_OK && pending >= 0) {
+                int x = pending / GRID, y = pending % GRID;
+                state.shots[x][y] = 1;
+                protoApplyCell(view.grid, x, y, protoCellValue(msg.u.move.answer));
+                aiObserveShot(&view, &state, x, y);
+                if (verbose)
+                    printf("  réponse %2d %2d : %d\n", x, y, protoCellValue(msg.u.move.answer));
+            }
+        }
+    }
+
+    // Fin de partie : les flottes sont dévoilées et la partie rejouée
+    if (status == LOCKSTEP_OK) {
+        lockstepReveal(&ls, &msg);
+        if (!sendMsg(fd, &msg) || !recvMsg(fd, &peer)) {
+            fprintf(stderr, "Connexion perdue avant la vérification\n");
+            return 1;
+        }
+        status = lockstepVerify(&ls, &peer);
+    }
+    double ms = (double)(chronoNowNs() - start) / 1e6;
+    close(fd);
+
+    printf("Place %d (%s, %s) : ", ls.seat, host ? "hôte" : "invité", botNames[level]);
+    if (ls.over)
+        printf("%s en %d tirs\n", ls.winner == ls.seat ? "victoire" : "défaite", ls.shots);
+    else
+        printf("partie interrompue après %d tirs\n", ls.shots);
+    printf("  Octets envoyés  : %zu\n", bytesSent);
+    printf("  Octets reçus    : %zu\n", bytesReceived);
+    printf("  Durée           : %.1f ms\n", ms);
+    printf("  Vérification    : %s\n", lockstepStatusName(status));
+    return status == LOCKSTEP_OK ? 0 : 2;
+}
@@ -0,0 +1,189 @@
+// ========================================================================
+// PROGRAMME : selfplay (parties IA contre IA sans interface graphique)
+// DESCRIPTION : Fait s'affronter deux IA à travers le moteur de partie
+//               (engine.h) avec une horloge virtuelle qui saute les délais
+//               entre les tours : mêmes règles et même déroulement que le jeu,
+//               sans SDL, à pleine vitesse
+// USAGE : ./selfplay [-n parties] [-s graine] [-a ia1] [-b ia2]
+//   -n parties : nombre de parties (défaut : 200)
+//   -s graine  : graine de la série (défaut : 12345)
+//   -a ia1     : IA du joueur 1, qui commence (défaut : hard)
+//   -b ia2     : IA du joueur 2 (défaut : expert)
+//   IA : easy, medium, hard, expert, info
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour printf, fprintf
+#include <stdlib.h>     // Pour atoi, strtoul
+#include <string.h>     // Pour strcmp
+#include "types.h"      // Définitions des types (Player, AIState, seed)
+#include "utils.h"      // Placement automatique, initialisations
+#include "ai.h"         // Fonctions d'IA
+#include "kernels.h"    // Dispatch des noyaux
+#include "chrono.h"     // Horloge monotone (débit)
+#include "engine.h"     // Moteur de partie
+#include "philox.h"     // Flux de tirages de chaque partie
+#include "stats.h"      // Distribution des coups par victoire
+
+// Signature commune des IA
+typedef void (*AIFunc)(Player *target, AIState *ai);
+
+// IA disponibles
+typedef struct {
+    const char *name;
+    AIFunc play;
+} AIEntry;
+
+static const AIEntry entrants[] = {
+    {"easy",   enemyEasy},
+    {"medium", enemyMedium},
+    {"hard",   enemyHard},
+    {"expert", enemyExpert},
+    {"info",   enemyInfo},
+};
+#define ENTRANT_COUNT ((int)(sizeof(entrants) / sizeof(entrants[0])))
+
+// ============================================================================
+// FONCTION : findEntrant (interne)
+// DESCRIPTION : Recherche une IA par son nom
+// RETOUR : entrée trouvée, NULL sinon
+// ============================================================================
+static const AIEntry *findEntrant(const char *name) {
+    for (int i = 0; i < ENTRANT_COUNT; i++)
+        if (strcmp(entrants[i].name, name) == 0)
+            return &entrants[i];
+    return NULL;
+}
+
+// ============================================================================
+// FONCTION : virtualNow (interne)
+// DESCRIPTION : Horloge virtuelle : le temps n'avance que quand le pilote
+//               saute à la fin d'un délai
+// ============================================================================
+static uint64_t virtualNow(void *ctx) {
+    return *(const uint64_t *)ctx;
+}
+
+// Résultat d'une partie
+typedef struct {
+    int winner;          // Vainqueur (0 ou 1, -1 = abandon)
+    int shots;           // Tirs du vainqueur
+    uint64_t virtualMs;  // Durée de la partie sur l'horloge virtuelle
+} GameResult;
+
+// ============================================================================
+// FONCTION : playGame
+// DESCRIPTION : Joue une partie complète entre deux IA à travers le moteur
+// PARAMÈTRES :
+//   - ai      : IA des deux joueurs
+//   - runSeed : graine de la série
+//   - game    : numéro de la partie (flottes et tirages des IA tirés de ses
+//               propres flux, indépendants des autres parties)
+// RETOUR : résultat de la partie
+// ============================================================================
+static GameResult playGame(const AIEntry *ai[2], uint64_t runSeed, int game) {
+    Player players[2];
+    AIState states[2];
+    uint64_t virtualMs = 0;
+    EngineClock clock = {virtualNow, &virtualMs};
+    Engine e;
+
+    seed = philoxSeed(runSeed, (uint32_t)game, RNG_STREAM_FLEET);
+    for (int p = 0; p < 2; p++) {
+        initPlayer(&players[p]);
+        initAIState(&states[p]);
+        placeShips(players[p].grid, &shipConfig);
+    }
+    seed = philoxSeed(runSeed, (uint32_t)game, RNG_STREAM_AI);
+    engineInit(&e, &players[0], &players[1], ENGINE_AI, ENGINE_AI, clock);
+
+    while (e.phase != ENGINE_OVER) {
+        EngineInput input = {ENGINE_INPUT_NONE, 0, 0};
+
+        if (e.phase == ENGINE_AI_TURN) {
+            // Sécurité : une IA ne peut pas tirer plus de GRID * GRID fois
+            if (e.shots[e.current] >= GRID * GRID) {
+                input.type = ENGINE_INPUT_QUIT;
+            } else {
+                ai[e.current]->play(engineOpponent(&e), &states[e.current]);
+                input.type = ENGINE_INPUT_AI_DONE;
+            }
+        } else if (engineWakeTime(&e) > virtualMs) {
+            virtualMs = engineWakeTime(&e);  // Saute le délai entre les tours
+        }
+        engineStep(&e, input);
+    }
+
+    GameResult r = {e.winner, e.winner >= 0 ? e.shots[e.winner] : 0, virtualMs};
+    return r;
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int games = 200;                // Nombre de parties
+    unsigned int baseSeed = 12345;  // Graine de la série
+    const AIEntry *ai[2] = {findEntrant("hard"), findEntrant("expert")};
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            baseSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if ((strcmp(argv[i], "-a") == 0 || strcmp(argv[i], "-b") == 0) && i + 1 < argc) {
+            int p = argv[i][1] == 'b';
+            if (!(ai[p] = findEntrant(argv[++i]))) {
+                fprintf(stderr, "IA inconnue : %s\n", argv[i]);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Usage : %s [-n parties] [-s graine] [-a ia1] [-b ia2]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (games <= 0) {
+        fprintf(stderr, "Nombre de parties invalide\n");
+        return 1;
+    }
+
+    dispatchInit(CPU_AVX512);
+    aiSetSolver(AI_SOLVER_MAX_SEARCH, 0);  // Sans échéance : parties reproductibles
+
+    int wins[2] = {0, 0}, aborted = 0;
+    static Histogram winShots[2];
+    histInit(&winShots[0]);
+    histInit(&winShots[1]);
+    uint64_t virtualMs = 0;
+    uint64_t start = chronoNowNs();
+
+    for (int g = 0; g < games; g++) {
+        GameResult r = playGame(ai, baseSeed, g);
+        virtualMs += r.virtualMs;
+        if (r.winner < 0) {
+            aborted++;
+            continue;
+        }
+        wins[r.winner]++;
+        histRecord(&winShots[r.winner], (uint64_t)r.shots);
+    }
+    double seconds = (double)(chronoNowNs() - start) / 1e9;
+
+    printf("%d parties, %s (joueur 1) contre %s (joueur 2)\n", games, ai[0]->name, ai[1]->name);
+    for (int p = 0; p < 2; p++) {
+        printf("  %-7s : %d victoires, %.2f coups par victoire", ai[p]->name, wins[p],
+               histMean(&winShots[p]));
+        if (wins[p] > 0)
+            printf(" (p50 %llu, p90 %llu, max %llu)",
+                   (unsigned long long)histPercentile(&winShots[p], 50.0),
+                   (unsigned long long)histPercentile(&winShots[p], 90.0),
+                   (unsigned long long)winShots[p].max);
+        printf("\n");
+    }
+    if (aborted > 0)
+        printf("  %d parties abandonnées\n", aborted);
+    printf("Débit : %.0f parties/s (%.1f s de jeu simulées par seconde réelle)\n",
+           seconds > 0 ? games / seconds : 0.0, seconds > 0 ? virtualMs / 1e3 / seconds : 0.0);
+    return 0;
+}
@@ -0,0 +1,903 @@
+// ========================================================================
+// PROGRAMME : server (serveur de parties joueur contre joueur)
+// DESCRIPTION : Héberge des milliers de parties simultanées sur un seul fil :
+//               boucle d'événements epoll, protocole binaire de proto.h,
+//               sessions et parties rangées dans des tables slab.h
+//               Les clients sont appariés dans l'ordre d'arrivée ; chaque
+//               partie est un moteur engine.h à deux places distantes
+//               Les spectateurs d'une partie lisent tous le même journal
+//               (image complète puis un delta par tir) : chaque envoi est
+//               écrit directement depuis ce journal partagé, sans copie
+//               Linux uniquement (epoll, accept4)
+// USAGE : ./server [-p port] [-u chemin] [-m sessions] [-w parties] [-v]
+//   -p port     : port TCP sur 127.0.0.1 (défaut : 7777, 0 = pas de TCP)
+//   -u chemin   : socket Unix (en plus du TCP)
+//   -m sessions : nombre maximal de sessions (défaut : 16384)
+//   -w parties  : nombre maximal de parties suivies par des spectateurs (défaut : 256)
+//   -v          : statistiques chaque seconde
+//   Ctrl+C arrête le serveur et affiche le bilan
+// ========================================================================
+
+// Inclusion des bibliothèques nécessaires
+#define _GNU_SOURCE     // Pour accept4
+#include <stdio.h>      // Pour printf, fprintf
+#include <stdlib.h>     // Pour atoi
+#include <string.h>     // Pour strcmp, memmove
+#include <errno.h>      // Codes d'erreur des appels système
+#include <signal.h>     // Arrêt par Ctrl+C
+#include <unistd.h>     // Pour read, write, close
+#include <sys/epoll.h>  // Boucle d'événements
+#include <sys/socket.h> // Sockets
+#include <sys/un.h>     // Sockets Unix
+#include <sys/uio.h>    // Pour writev
+#include <sys/resource.h>  // Limite de descripteurs, temps CPU
+#include <netinet/in.h> // Adresses IPv4
+#include <netinet/tcp.h>   // TCP_NODELAY
+#include <arpa/inet.h>  // Pour htonl, htons
+#include "types.h"      // Player, shipConfig
+#include "utils.h"      // initPlayer
+#include "engine.h"     // Moteur de partie
+#include "proto.h"      // Protocole binaire
+#include "slab.h"       // Tables de sessions et de parties
+#include "chrono.h"     // Horloge monotone (statistiques)
+
+// Taille des tampons de réception et d'émission d'une session
+#define RX_CAP 64
+#define TX_CAP 512
+
+// Événements traités par appel à epoll_wait
+#define EVENT_BATCH 1024
+
+// Journal d'une partie suivie : au plus 2 * GRID * GRID deltas et une image
+// complète tous les FEED_KEYFRAME_SHOTS tirs, la partie entière y tient
+#define FEED_LOG 8192
+#define FEED_KEYFRAME_SHOTS 64
+
+// Marqueurs des sockets d'écoute dans epoll (les sessions utilisent gen << 32 | indice)
+#define TAG_TCP UINT64_MAX
+#define TAG_UNIX (UINT64_MAX - 1)
+
+// Étape d'une session
+typedef enum {
+    SESSION_IDLE,                // Connectée, attend HELLO
+    SESSION_WAITING,             // Attend un adversaire
+    SESSION_PLACING,             // Adversaire trouvé, attend PLACE
+    SESSION_PLAYING,             // Partie en cours
+    SESSION_WATCHING             // Spectateur d'une partie
+} SessionState;
+
+// Client connecté
+typedef struct {
+    int fd;
+    SessionState state;
+    int match;                   // Partie en cours (-1 = aucune)
+    uint32_t matchGen;           // Génération de la partie
+    int seat;                    // Place dans la partie (0 commence)
+    int dirty;                   // Déjà dans la liste des envois en attente
+    int wantOut;                 // EPOLLOUT armé (tampon d'émission plein côté noyau)
+    int overflow;                // Le client ne lit plus : fermeture en fin de tour
+    int feed;                    // Journal suivi (spectateur, -1 = aucun)
+    int feedOffset;              // Octets du journal déjà envoyés
+    int prevWatcher, nextWatcher;  // Spectateurs du même journal (-1 = fin)
+    int rxLen, txLen;
+    uint8_t rx[RX_CAP];
+    uint8_t tx[TX_CAP];
+} Session;
+
+// Partie entre deux sessions
+typedef struct {
+    Player players[2];
+    Engine engine;
+    int sessions[2];
+    uint32_t gens[2];
+    int placed[2];
+    int started;                 // Les deux flottes sont placées
+    int feed;                    // Journal des spectateurs (-1 = aucun spectateur)
+} Match;
+
+// Journal partagé par les spectateurs d'une partie ; il survit à la partie
+// jusqu'à ce que le dernier spectateur ait reçu la fin
+typedef struct {
+    int match;                   // Partie suivie (-1 = terminée)
+    int closed;                  // OVER écrit : plus rien ne sera ajouté
+    int watchers;                // Nombre de spectateurs
+    int head;                    // Premier spectateur (-1 = aucun)
+    int len;                     // Octets écrits
+    int keyframeAt;              // Début de la dernière image complète
+    int sinceKeyframe;           // Tirs depuis cette image
+    uint8_t log[FEED_LOG];
+} Feed;
+
+// Compteurs du serveur
+typedef struct {
+    uint64_t accepted, refused, closed;
+    uint64_t messages, shots, errors;
+    uint64_t matches, finished, forfeits;
+    uint64_t watches, feedBytes;
+} ServerStats;
+
+static Slab sessions, matches, feeds;
+static ServerStats stats;
+static int epfd = -1;
+static int waitingIndex = -1;    // Session en attente d'adversaire
+static uint32_t waitingGen;
+static int *dirtyList;           // Sessions avec des octets à envoyer
+static int dirtyCount;
+static volatile sig_atomic_t stopRequested = 0;
+
+// ============================================================================
+// FONCTION : onSignal (interne)
+// DESCRIPTION : Demande l'arrêt de la boucle d'événements
+// ============================================================================
+static void onSignal(int sig) {
+    (void)sig;
+    stopRequested = 1;
+}
+
+// ============================================================================
+// FONCTION : session / sessionAlive (internes)
+// DESCRIPTION : Accès à une session et vérification d'une référence
+// ============================================================================
+static Session *session(int index) {
+    return slabGet(&sessions, index);
+}
+
+static int sessionAlive(int index, uint32_t gen) {
+    return index >= 0 && slabGen(&sessions, index) == gen && session(index)->fd >= 0;
+}
+
+// ============================================================================
+// FONCTION : markDirty (interne)
+// DESCRIPTION : Inscrit la session dans la liste traitée en fin de tour
+//               (envois, puis libération des sessions fermées)
+// ============================================================================
+static void markDirty(int index) {
+    Session *s = session(index);
+
+    if (!s->dirty) {
+        s->dirty = 1;
+        dirtyList[dirtyCount++] = index;
+    }
+}
+
+// ============================================================================
+// FONCTION : sendMsg / sendError (internes)
+// DESCRIPTION : Ajoute un message au tampon d'émission ; les envois sont
+//               regroupés et écrits en fin de tour de boucle (flushAll)
+//               Un tampon plein fait fermer la session en fin de tour
+// ============================================================================
+static void sendMsg(int index, const ProtoMsg *msg) {
+    Session *s = session(index);
+    size_t n = protoEncode(msg, s->tx + s->txLen, TX_CAP - (size_t)s->txLen);
+
+    if (n == 0)
+        s->overflow = 1;
+    s->txLen += (int)n;
+    markDirty(index);
+}
+
+static void sendError(int index, ProtoError code) {
+    ProtoMsg msg = {.type = MSG_ERROR, .u.error = (uint8_t)code};
+    stats.errors++;
+    sendMsg(index, &msg);
+}
+
+// ============================================================================
+// FONCTION : feedAppend (interne)
+// DESCRIPTION : Ajoute un message au journal et réveille ses spectateurs
+// RETOUR : 1 si le message est écrit, 0 si le journal est plein
+// ============================================================================
+static int feedAppend(Feed *f, const ProtoMsg *msg) {
+    size_t n = protoEncode(msg, f->log + f->len, FEED_LOG - (size_t)f->len);
+
+    if (n == 0)
+        return 0;
+    f->len += (int)n;
+    for (int w = f->head; w >= 0; w = session(w)->nextWatcher)
+        markDirty(w);
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : feedKeyframe (interne)
+// DESCRIPTION : Écrit l'image complète de la partie ; les nouveaux
+//               spectateurs commencent à la dernière image
+// ============================================================================
+static void feedKeyframe(Feed *f, const Match *match) {
+    ProtoMsg msg = {.type = MSG_KEYFRAME};
+    int at = f->len;
+
+    msg.u.keyframe.current = (uint8_t)match->engine.current;
+    for (int p = 0; p < 2; p++)
+        for (int i = 0; i < GRID; i++)
+            for (int j = 0; j < GRID; j++)
+                msg.u.keyframe.cells[p][i * GRID + j] = protoCellCode(match->players[p].grid[i][j]);
+    if (feedAppend(f, &msg))
+        f->keyframeAt = at;   // Sinon la précédente reste valable
+    f->sinceKeyframe = 0;
+}
+
+// ============================================================================
+// FONCTION : detachWatcher (interne)
+// DESCRIPTION : Retire un spectateur de son journal ; un journal sans
+//               spectateur est libéré (la partie n'a plus à l'alimenter)
+// ============================================================================
+static void detachWatcher(int index) {
+    Session *s = session(index);
+    int fi = s->feed;
+    Feed *f = slabGet(&feeds, fi);
+
+    if (s->prevWatcher >= 0) session(s->prevWatcher)->nextWatcher = s->nextWatcher;
+    else f->head = s->nextWatcher;
+    if (s->nextWatcher >= 0) session(s->nextWatcher)->prevWatcher = s->prevWatcher;
+    s->feed = -1;
+    s->state = SESSION_IDLE;
+
+    if (--f->watchers == 0) {
+        if (f->match >= 0)
+            ((Match *)slabGet(&matches, f->match))->feed = -1;
+        slabRelease(&feeds, fi);
+    }
+}
+
+// ============================================================================
+// FONCTION : matchId / findMatch (internes)
+// DESCRIPTION : Numéro public d'une partie (indice et bas de la génération,
+//               pour qu'un numéro périmé ne désigne pas une autre partie)
+// ============================================================================
+static uint32_t matchId(int m) {
+    return (slabGen(&matches, m) & 0xFFFu) << 20 | (uint32_t)m;
+}
+
+static int findMatch(uint32_t id) {
+    if (id == PROTO_ANY_MATCH) {
+        // Une partie déjà suivie d'abord (un journal de plus ne coûte rien), sinon la première
+        int found = -1;
+        for (int m = 0; m < matches.capacity; m++) {
+            Match *match = slabGet(&matches, m);
+            if (!match->started)
+                continue;
+            if (match->feed >= 0)
+                return m;
+            if (found < 0)
+                found = m;
+        }
+        return found;
+    }
+
+    int m = (int)(id & 0xFFFFF);
+    if (m >= matches.capacity || matchId(m) != id || !((Match *)slabGet(&matches, m))->started)
+        return -1;
+    return m;
+}
+
+// ============================================================================
+// FONCTION : endMatch (interne)
+// DESCRIPTION : Envoie OVER aux sessions encore connectées, les remet en
+//               attente de HELLO et libère la partie
+// ============================================================================
+static void endMatch(int m, int winner, OverReason reason) {
+    Match *match = slabGet(&matches, m);
+    ProtoMsg msg = {.type = MSG_OVER};
+
+    msg.u.over.winner = winner < 0 ? 255 : (uint8_t)winner;
+    msg.u.over.reason = (uint8_t)reason;
+    for (int p = 0; p < 2; p++) {
+        if (!sessionAlive(match->sessions[p], match->gens[p]))
+            continue;
+        Session *s = session(match->sessions[p]);
+        s->state = SESSION_IDLE;
+        s->match = -1;
+        sendMsg(match->sessions[p], &msg);
+    }
+    if (match->feed >= 0) {
+        Feed *f = slabGet(&feeds, match->feed);
+        feedAppend(f, &msg);
+        f->closed = 1;
+        f->match = -1;
+    }
+    stats.finished++;
+    if (reason == OVER_FORFEIT)
+        stats.forfeits++;
+    match->started = 0;
+    slabRelease(&matches, m);
+}
+
+// ============================================================================
+// FONCTION : closeSession (interne)
+// DESCRIPTION : Ferme la connexion ; l'adversaire éventuel gagne par forfait
+// ============================================================================
+static void closeSession(int index) {
+    Session *s = session(index);
+
+    if (s->fd < 0)
+        return;
+    close(s->fd);   // Retire aussi le descripteur d'epoll
+    s->fd = -1;
+    if (waitingIndex == index)
+        waitingIndex = -1;
+    if (s->match >= 0 && slabGen(&matches, s->match) == s->matchGen)
+        endMatch(s->match, 1 - s->seat, OVER_FORFEIT);
+    if (s->feed >= 0)
+        detachWatcher(index);
+    stats.closed++;
+    // L'emplacement n'est rendu qu'après les envois du tour (voir flushAll)
+    markDirty(index);
+}
+
+// ============================================================================
+// FONCTION : onHello (interne)
+// DESCRIPTION : Apparie la session avec celle qui attend, ou la met en attente
+// ============================================================================
+static void onHello(int index, const ProtoMsg *msg) {
+    Session *s = session(index);
+
+    if (s->state != SESSION_IDLE) {
+        sendError(index, ERR_BAD_STATE);
+        return;
+    }
+    if (msg->u.version != PROTO_VERSION) {
+        sendError(index, ERR_BAD_VERSION);
+        return;
+    }
+    if (!sessionAlive(waitingIndex, waitingGen) || waitingIndex == index) {
+        waitingIndex = index;
+        waitingGen = slabGen(&sessions, index);
+        s->state = SESSION_WAITING;
+        return;
+    }
+
+    int m = slabAlloc(&matches);
+    if (m < 0) {
+        sendError(index, ERR_BAD_STATE);   // Ne devrait pas arriver : une partie pour deux sessions
+        return;
+    }
+    Match *match = slabGet(&matches, m);
+    match->feed = -1;
+    match->sessions[0] = waitingIndex;
+    match->sessions[1] = index;
+    for (int p = 0; p < 2; p++) {
+        Session *player = session(match->sessions[p]);
+        ProtoMsg matched = {.type = MSG_MATCHED, .u.seat = (uint8_t)p};
+        match->gens[p] = slabGen(&sessions, match->sessions[p]);
+        initPlayer(&match->players[p]);
+        player->state = SESSION_PLACING;
+        player->match = m;
+        player->matchGen = slabGen(&matches, m);
+        player->seat = p;
+        sendMsg(match->sessions[p], &matched);
+    }
+    waitingIndex = -1;
+    stats.matches++;
+}
+
+// ============================================================================
+// FONCTION : onPlace (interne)
+// DESCRIPTION : Vérifie la flotte ; la partie démarre quand les deux sont placées
+// ============================================================================
+static void onPlace(int index, const ProtoMsg *msg) {
+    Session *s = session(index);
+
+    if (s->state != SESSION_PLACING) {
+        sendError(index, ERR_BAD_STATE);
+        return;
+    }
+    Match *match = slabGet(&matches, s->match);
+    if (match->placed[s->seat]) {
+        sendError(index, ERR_BAD_STATE);
+        return;
+    }
+    if (!protoPlaceFleet(msg->u.fleet, &shipConfig, match->players[s->seat].grid)) {
+        sendError(index, ERR_BAD_FLEET);
+        return;
+    }
+    match->placed[s->seat] = 1;
+    if (!match->placed[1 - s->seat])
+        return;
+
+    engineInit(&match->engine, &match->players[0], &match->players[1],
+               ENGINE_REMOTE, ENGINE_REMOTE, engineMonotonicClock());
+    match->started = 1;
+    ProtoMsg start = {.type = MSG_START, .u.match = matchId(s->match)};
+    for (int p = 0; p < 2; p++) {
+        session(match->sessions[p])->state = SESSION_PLAYING;
+        sendMsg(match->sessions[p], &start);
+    }
+}
+
+// ============================================================================
+// FONCTION : onFire (interne)
+// DESCRIPTION : Joue le tir dans le moteur et diffuse le résultat aux deux joueurs
+// ============================================================================
+static void onFire(int index, const ProtoMsg *msg) {
+    Session *s = session(index);
+
+    if (s->state != SESSION_PLAYING) {
+        sendError(index, ERR_BAD_STATE);
+        return;
+    }
+    int m = s->match;
+    Match *match = slabGet(&matches, m);
+    Engine *e = &match->engine;
+    if (e->current != s->seat) {
+        sendError(index, ERR_NOT_YOUR_TURN);
+        return;
+    }
+
+    int x = msg->u.fire.x, y = msg->u.fire.y;
+    Player *target = engineOpponent(e);
+    EngineEvent event = engineStep(e, (EngineInput){ENGINE_INPUT_SHOT, x, y});
+    if (event == ENGINE_EVENT_IGNORED) {
+        sendError(index, ERR_BAD_SHOT);
+        return;
+    }
+    stats.shots++;
+
+    ProtoMsg result = {.type = MSG_RESULT};
+    result.u.result.seat = (uint8_t)s->seat;
+    result.u.result.x = (uint8_t)x;
+    result.u.result.y = (uint8_t)y;
+    result.u.result.cell = (int16_t)target->grid[x][y];
+    for (int p = 0; p < 2; p++)
+        sendMsg(match->sessions[p], &result);
+
+    // Spectateurs : un delta de 3 octets, et de temps en temps une image complète
+    if (match->feed >= 0) {
+        Feed *f = slabGet(&feeds, match->feed);
+        ProtoMsg delta = {.type = MSG_DELTA};
+        delta.u.delta.board = (uint8_t)(1 - s->seat);
+        delta.u.delta.index = (uint8_t)(x * GRID + y);
+        delta.u.delta.code = protoCellCode(target->grid[x][y]);
+        feedAppend(f, &delta);
+        if (++f->sinceKeyframe >= FEED_KEYFRAME_SHOTS && event != ENGINE_EVENT_OVER)
+            feedKeyframe(f, match);
+    }
+
+    if (event == ENGINE_EVENT_OVER)
+        endMatch(m, e->winner, OVER_FLEET_DESTROYED);
+}
+
+// ============================================================================
+// FONCTION : onWatch (interne)
+// DESCRIPTION : Abonne la session au journal d'une partie en cours (créé au
+//               premier spectateur, avec une image complète) ; l'envoi
+//               commence à la dernière image complète
+// ============================================================================
+static void onWatch(int index, const ProtoMsg *msg) {
+    Session *s = session(index);
+
+    if (s->state != SESSION_IDLE) {
+        sendError(index, ERR_BAD_STATE);
+        return;
+    }
+    if (msg->u.watch.version != PROTO_VERSION) {
+        sendError(index, ERR_BAD_VERSION);
+        return;
+    }
+    int m = findMatch(msg->u.watch.match);
+    if (m < 0) {
+        sendError(index, ERR_NO_MATCH);
+        return;
+    }
+
+    Match *match = slabGet(&matches, m);
+    if (match->feed < 0) {
+        int fi = slabAlloc(&feeds);
+        if (fi < 0) {
+            sendError(index, ERR_FULL);
+            return;
+        }
+        Feed *f = slabGet(&feeds, fi);
+        f->match = m;
+        f->head = -1;
+        match->feed = fi;
+        feedKeyframe(f, match);
+    }
+
+    Feed *f = slabGet(&feeds, match->feed);
+    s->state = SESSION_WATCHING;
+    s->feed = match->feed;
+    s->feedOffset = f->keyframeAt;
+    s->prevWatcher = -1;
+    s->nextWatcher = f->head;
+    if (f->head >= 0)
+        session(f->head)->prevWatcher = index;
+    f->head = index;
+    f->watchers++;
+    stats.watches++;
+    markDirty(index);
+}
+
+// ============================================================================
+// FONCTION : onReadable (interne)
+// DESCRIPTION : Lit ce qui est disponible et traite les messages complets
+// ============================================================================
+static void onReadable(int index) {
+    Session *s = session(index);
+    ssize_t n = read(s->fd, s->rx + s->rxLen, RX_CAP - (size_t)s->rxLen);
+
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+        closeSession(index);
+        return;
+    }
+    if (n < 0)
+        return;
+    s->rxLen += (int)n;
+
+    int offset = 0;
+    while (s->fd >= 0) {
+        ProtoMsg msg;
+        int used = protoDecode(s->rx + offset, (size_t)(s->rxLen - offset), &msg);
+        if (used == 0)
+            break;
+        if (used < 0) {
+            stats.errors++;
+            closeSession(index);   // Type inconnu : flux désynchronisé
+            return;
+        }
+        offset += used;
+        stats.messages++;
+        switch (msg.type) {
+        case MSG_HELLO: onHello(index, &msg); break;
+        case MSG_PLACE: onPlace(index, &msg); break;
+        case MSG_FIRE:  onFire(index, &msg); break;
+        case MSG_WATCH: onWatch(index, &msg); break;
+        default:        sendError(index, ERR_BAD_STATE); break;   // Message du serveur
+        }
+    }
+    if (offset > 0 && s->fd >= 0) {
+        memmove(s->rx, s->rx + offset, (size_t)(s->rxLen - offset));
+        s->rxLen -= offset;
+    }
+}
+
+// ============================================================================
+// FONCTION : watchOut (interne)
+// DESCRIPTION : Arme ou désarme EPOLLOUT selon qu'il reste des octets à envoyer
+// ============================================================================
+static void watchOut(int index, int wantOut) {
+    Session *s = session(index);
+    struct epoll_event ev;
+
+    if (s->wantOut == wantOut)
+        return;
+    ev.events = EPOLLIN | (wantOut ? EPOLLOUT : 0);
+    ev.data.u64 = (uint64_t)slabGen(&sessions, index) << 32 | (uint32_t)index;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, s->fd, &ev);
+    s->wantOut = wantOut;
+}
+
+// ============================================================================
+// FONCTION : flush (interne)
+// DESCRIPTION : Écrit en un appel le tampon d'émission de la session puis,
+//               pour un spectateur, la suite du journal partagé (écrite
+//               depuis le journal même) ; un spectateur qui a reçu la fin
+//               de la partie est détaché
+// RETOUR : 0 si la connexion est rompue, 1 sinon
+// ============================================================================
+static int flush(int index) {
+    Session *s = session(index);
+    Feed *f = s->feed >= 0 ? slabGet(&feeds, s->feed) : NULL;
+
+    for (;;) {
+        struct iovec iov[2];
+        int count = 0;
+        if (s->txLen > 0)
+            iov[count++] = (struct iovec){s->tx, (size_t)s->txLen};
+        if (f && s->feedOffset < f->len)
+            iov[count++] = (struct iovec){f->log + s->feedOffset, (size_t)(f->len - s->feedOffset)};
+        if (count == 0)
+            break;
+
+        ssize_t n = writev(s->fd, iov, count);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN) {
+                watchOut(index, 1);   // Reprise sur EPOLLOUT
+                return 1;
+            }
+            return 0;
+        }
+        size_t fromTx = (size_t)n < (size_t)s->txLen ? (size_t)n : (size_t)s->txLen;
+        memmove(s->tx, s->tx + fromTx, (size_t)s->txLen - fromTx);
+        s->txLen -= (int)fromTx;
+        if (f) {
+            s->feedOffset += (int)((size_t)n - fromTx);
+            stats.feedBytes += (size_t)n - fromTx;
+        }
+    }
+    if (f && f->closed)
+        detachWatcher(index);
+    watchOut(index, 0);
+    return 1;
+}
+
+// ============================================================================
+// FONCTION : flushAll (interne)
+// DESCRIPTION : Un seul write par session et par tour de boucle ; rend les
+//               emplacements des sessions fermées pendant le tour
+// ============================================================================
+static void flushAll(void) {
+    // La liste peut grandir pendant le parcours (forfait après une écriture ratée)
+    for (int i = 0; i < dirtyCount; i++) {
+        int index = dirtyList[i];
+        Session *s = session(index);
+        if (s->fd >= 0 && (s->overflow || (!s->wantOut && !flush(index))))
+            closeSession(index);
+    }
+    for (int i = 0; i < dirtyCount; i++) {
+        Session *s = session(dirtyList[i]);
+        s->dirty = 0;
+        if (s->fd < 0)
+            slabRelease(&sessions, dirtyList[i]);
+    }
+    dirtyCount = 0;
+}
+
+// ============================================================================
+// FONCTION : acceptAll (interne)
+// DESCRIPTION : Accepte toutes les connexions en attente sur une socket d'écoute
+// ============================================================================
+static void acceptAll(int listenFd, int tcp) {
+    for (;;) {
+        int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EMFILE || errno == ENFILE)
+                stats.refused++;
+            return;
+        }
+
+        int index = slabAlloc(&sessions);
+        if (index < 0) {
+            close(fd);   // Table pleine
+            stats.refused++;
+            continue;
+        }
+        if (tcp) {
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+
+        Session *s = session(index);
+        s->fd = fd;
+        s->state = SESSION_IDLE;
+        s->match = -1;
+        s->feed = -1;
+
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u64 = (uint64_t)slabGen(&sessions, index) << 32 | (uint32_t)index;
+        if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            slabRelease(&sessions, index);
+            stats.refused++;
+            continue;
+        }
+        stats.accepted++;
+    }
+}
+
+// ============================================================================
+// FONCTION : watchListener / listenTcp / listenUnix (internes)
+// DESCRIPTION : Ouvre une socket d'écoute non bloquante et l'ajoute à epoll
+// RETOUR : descripteur, -1 en cas d'échec
+// ============================================================================
+static int watchListener(int fd, uint64_t tag) {
+    struct epoll_event ev;
+
+    ev.events = EPOLLIN;
+    ev.data.u64 = tag;
+    if (listen(fd, SOMAXCONN) < 0 || epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int listenTcp(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    int one = 1;
+    struct sockaddr_in addr;
+
+    if (fd < 0)
+        return -1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons((uint16_t)port);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return watchListener(fd, TAG_TCP);
+}
+
+static int listenUnix(const char *path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    struct sockaddr_un addr;
+
+    if (fd < 0 || strlen(path) >= sizeof(addr.sun_path)) {
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return watchListener(fd, TAG_UNIX);
+}
+
+// ============================================================================
+// FONCTION : raiseFileLimit (interne)
+// DESCRIPTION : Porte la limite de descripteurs au maximum autorisé
+// ============================================================================
+static void raiseFileLimit(int wanted) {
+    struct rlimit rl;
+
+    if (getrlimit(RLIMIT_NOFILE, &rl) != 0 || rl.rlim_cur >= (rlim_t)wanted)
+        return;
+    rl.rlim_cur = rl.rlim_max < (rlim_t)wanted ? rl.rlim_max : (rlim_t)wanted;
+    setrlimit(RLIMIT_NOFILE, &rl);
+    if (rl.rlim_cur < (rlim_t)wanted)
+        fprintf(stderr, "Limite de descripteurs : %lu (moins que %d sessions)\n",
+                (unsigned long)rl.rlim_cur, wanted);
+}
+
+// ============================================================================
+// FONCTION : cpuSeconds (interne)
+// DESCRIPTION : Temps CPU consommé par le processus (utilisateur + système)
+// ============================================================================
+static double cpuSeconds(void) {
+    struct rusage ru;
+
+    getrusage(RUSAGE_SELF, &ru);
+    return (double)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec)
+         + (double)(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e6;
+}
+
+// ============================================================================
+// FONCTION : printStats (interne)
+// DESCRIPTION : Une ligne de statistiques ; débits depuis l'appel précédent
+// ============================================================================
+static void printStats(const ServerStats *prev, double seconds, double cpu) {
+    printf("%5d sessions, %5d parties | %8.0f parties/s %9.0f tirs/s %9.0f msg/s | CPU %3.0f%%\n",
+           sessions.used, matches.used,
+           (double)(stats.finished - prev->finished) / seconds,
+           (double)(stats.shots - prev->shots) / seconds,
+           (double)(stats.messages - prev->messages) / seconds,
+           100.0 * cpu / seconds);
+    fflush(stdout);
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int port = 7777;                // Port TCP (0 = pas de TCP)
+    const char *unixPath = NULL;    // Socket Unix
+    int maxSessions = 16384;        // Taille de la table des sessions
+    int maxFeeds = 256;             // Parties suivies au plus
+    int verbose = 0;                // Statistiques chaque seconde
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+            unixPath = argv[++i];
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            maxSessions = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            maxFeeds = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+        } else {
+            fprintf(stderr, "Usage : %s [-p port] [-u chemin] [-m sessions] [-w parties] [-v]\n", argv[0]);
+            return 1;
+        }
+    }
+    // Les numéros de partie réservent 20 bits à l'indice
+    if (maxSessions < 2 || maxSessions > 1 << 21 || maxFeeds < 1 || port < 0 || port > 65535 || (port == 0 && !unixPath)) {
+        fprintf(stderr, "Options invalides\n");
+        return 1;
+    }
+
+    // Une partie pour deux sessions au plus
+    if (!slabInit(&sessions, sizeof(Session), maxSessions)
+        || !slabInit(&matches, sizeof(Match), maxSessions / 2)
+        || !slabInit(&feeds, sizeof(Feed), maxFeeds)
+        || !(dirtyList = malloc(sizeof(int) * (size_t)maxSessions))) {
+        fprintf(stderr, "Mémoire insuffisante\n");
+        return 1;
+    }
+    raiseFileLimit(maxSessions + 16);
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    int tcpFd = port > 0 ? listenTcp(port) : -1;
+    int unixFd = unixPath ? listenUnix(unixPath) : -1;
+    if (epfd < 0 || (port > 0 && tcpFd < 0) || (unixPath && unixFd < 0)) {
+        perror("Ouverture des sockets");
+        return 1;
+    }
+    if (tcpFd >= 0)
+        printf("Écoute sur 127.0.0.1:%d\n", port);
+    if (unixFd >= 0)
+        printf("Écoute sur %s\n", unixPath);
+    fflush(stdout);
+
+    struct epoll_event events[EVENT_BATCH];
+    uint64_t start = chronoNowNs(), lastReport = start;
+    ServerStats prev = stats;
+    double prevCpu = cpuSeconds();
+
+    while (!stopRequested) {
+        int count = epoll_wait(epfd, events, EVENT_BATCH, 1000);
+        if (count < 0 && errno != EINTR) {
+            perror("epoll_wait");
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            uint64_t tag = events[i].data.u64;
+            if (tag == TAG_TCP || tag == TAG_UNIX) {
+                acceptAll(tag == TAG_TCP ? tcpFd : unixFd, tag == TAG_TCP);
+                continue;
+            }
+
+            int index = (int)(uint32_t)tag;
+            if (!sessionAlive(index, (uint32_t)(tag >> 32)))
+                continue;   // Session fermée plus tôt dans ce lot
+            if (events[i].events & EPOLLOUT) {
+                if (!flush(index)) {
+                    closeSession(index);
+                    continue;
+                }
+            }
+            if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+                onReadable(index);
+        }
+        flushAll();
+
+        uint64_t now = chronoNowNs();
+        if (verbose && now - lastReport >= 1000000000ull) {
+            double cpu = cpuSeconds();
+            printStats(&prev, (double)(now - lastReport) / 1e9, cpu - prevCpu);
+            prev = stats;
+            prevCpu = cpu;
+            lastReport = now;
+        }
+    }
+
+    double seconds = (double)(chronoNowNs() - start) / 1e9;
+    printf("\nBilan sur %.1f s :\n", seconds);
+    printf("  connexions : %lu acceptées, %lu refusées, %lu fermées\n",
+           (unsigned long)stats.accepted, (unsigned long)stats.refused, (unsigned long)stats.closed);
+    printf("  parties    : %lu commencées, %lu terminées (%lu par forfait)\n",
+           (unsigned long)stats.matches, (unsigned long)stats.finished, (unsigned long)stats.forfeits);
+    printf("  messages   : %lu reçus, %lu tirs, %lu erreurs\n",
+           (unsigned long)stats.messages, (unsigned long)stats.shots, (unsigned long)stats.errors);
+    printf("  spectateurs: %lu abonnements, %lu octets diffusés\n",
+           (unsigned long)stats.watches, (unsigned long)stats.feedBytes);
+    printf("  CPU        : %.1f s (%.0f %% d'un cœur)\n", cpuSeconds(), 100.0 * cpuSeconds() / seconds);
+
+    if (unixPath)
+        unlink(unixPath);
+    free(dirtyList);
+    slabFree(&sessions);
+    slabFree(&matches);
+    slabFree(&feeds);
+    return 0;
+}
@@ -0,0 +1,790 @@
+// ========================================================================
+// PROGRAMME : tournament (tournoi des IA sans interface graphique)
+// DESCRIPTION : Fait jouer chaque IA sur la même série de flottes tirées au
+//               hasard et affiche le nombre moyen de coups pour gagner ainsi
+//               que le débit (parties par seconde) et la latence par décision
+// USAGE : ./tournament [-n parties] [-o premier] [-s graine] [-a ia] [-i niveau] [-c taille]
+//                      [-b fichier] [-e seuil] [-t fils] [-p processus] [-k fichier]
+//                      [-K secondes] [-d] [-C fichier] [-l ms] [-f µs]
+//   -n parties : nombre de parties par IA (défaut : 500)
+//   -o premier : numéro de la première partie (défaut : 0) ; la partie n°N
+//                est la même quels que soient -n, -o et -t (rejouer une
+//                partie d'une longue série : -o N -n 1)
+//   -s graine  : graine de la série (défaut : 12345)
+//   -a ia      : ne joue que cette IA (easy, medium, hard, expert, info)
+//   -i niveau  : plafond du dispatch (generic, sse4.2, avx2, avx512)
+//   -c taille  : log2 du nombre d'entrées du cache de transposition
+//                (défaut : 20, 0 = pas de passe avec cache)
+//   -b fichier : bibliothèque d'ouvertures à évaluer (générée par bookgen)
+//   -e seuil   : taille de recherche sous laquelle l'IA experte passe au
+//                solveur exact (défaut : AI_SOLVER_MAX_SEARCH, 0 = désactivé)
+//   -t fils    : fils d'exécution (défaut : nombre de processeurs) ; les parties
+//                d'une série et les calculs de l'IA info sont répartis entre
+//                eux par vol de travail, l'utilisation de chaque fil est affichée
+//                (avec -p : fils par processus, défaut : processeurs attribués)
+//   -p processus : répartit les parties entre autant de processus, chacun
+//                épinglé sur une part des processeurs ; les résultats sont
+//                regroupés en mémoire partagée et suivis en direct, un
+//                processus qui plante ne fait pas perdre ceux des autres
+//                (pas de passe avec cache ni bibliothèque)
+//   -k fichier : point de reprise (implique -p 1 au moins) : écrit
+//                régulièrement et en fin de série, repris s'il existe, pour
+//                continuer une série interrompue sans rejouer ses parties
+//   -d         : mesure la durée de chaque décision (distribution affichée)
+//   -C fichier : écrit aussi la distribution des coups et des durées de
+//                décision de chaque série dans un fichier CSV
+//   -K secondes : intervalle entre deux écritures du point de reprise
+//                (défaut : 60)
+//   -l ms      : mesure plutôt la latence par tour de l'IA à tout moment,
+//                sans puis avec spéculation pendant un tour du joueur de ms
+//                millisecondes (réflexion complète dans les deux cas), et
+//                le découpage en tranches du mode coopératif
+//   -f µs      : tranche par image du mode coopératif (défaut : ANYTIME_FRAME_BUDGET_US)
+// ========================================================================
+
+// Active nanosleep avec -std=c11 (fonction POSIX)
+#define _POSIX_C_SOURCE 200809L
+
+// Inclusion des bibliothèques nécessaires
+#include <stdio.h>      // Pour printf, fprintf
+#include <stdlib.h>     // Pour atoi, malloc, free
+#include <string.h>     // Pour strcmp, memcmp
+#include <time.h>       // Pour nanosleep
+#include <sched.h>      // Pour sched_yield
+#include <signal.h>     // Pour signal (interruption d'une série répartie)
+#include "types.h"      // Définitions des types (Player, AIState, seed)
+#include "utils.h"      // Placement automatique, fin de partie
+#include "ai.h"         // Fonctions d'IA
+#include "density.h"    // Noyau de densité sélectionné
+#include "kernels.h"    // Dispatch des noyaux (niveau choisi)
+#include "chrono.h"     // Horloge monotone
+#include "philox.h"     // Flux de tirages de chaque partie
+#include "ttable.h"     // Cache de transposition de l'IA experte
+#include "book.h"       // Bibliothèque d'ouvertures de l'IA experte
+#include "pool.h"       // Groupe de fils (parties, IA info)
+#include "shard.h"      // Parties réparties entre processus
+#include "stats.h"      // Histogrammes des coups et des latences
+#include "anytime.h"    // IA à tout moment (mesure de latence)
+#include "aiqueue.h"    // Fil de l'IA (spéculation)
+
+// Signature commune des IA
+typedef void (*AIFunc)(Player *target, AIState *ai);
+
+// Table des IA participant au tournoi
+typedef struct {
+    const char *name;  // Nom affiché
+    AIFunc play;       // Fonction jouant un coup
+    int usesCache;     // 1 si l'IA consulte le cache et la bibliothèque
+    AILevel level;     // Niveau correspondant de l'IA à tout moment
+} AIEntry;
+
+static const AIEntry entrants[] = {
+    {"easy",   enemyEasy,   0, AI_EASY},
+    {"medium", enemyMedium, 0, AI_MEDIUM},
+    {"hard",   enemyHard,   0, AI_HARD},
+    {"expert", enemyExpert, 1, AI_EXPERT},
+    {"info",   enemyInfo,   0, AI_INFO},
+};
+#define ENTRANT_COUNT ((int)(sizeof(entrants) / sizeof(entrants[0])))
+
+// Série de parties : la partie n°g tire sa flotte et les tirages de l'IA de
+// ses propres flux (philox.h), indépendants des autres parties
+typedef struct {
+    uint64_t runSeed;    // Graine de la série
+    int first;           // Numéro de la première partie
+    int games;           // Nombre de parties
+} Series;
+
+// ============================================================================
+// FONCTION : startGame
+// DESCRIPTION : Place la flotte de la partie n°game (même flotte pour toutes
+//               les IA) puis amorce myRand() sur le flux de l'IA
+// ============================================================================
+static void startGame(uint64_t runSeed, int game, Player *target, AIState *state) {
+    seed = philoxSeed(runSeed, (uint32_t)game, RNG_STREAM_FLEET);
+    initPlayer(target);
+    initAIState(state);
+    placeShips(target->grid, &shipConfig);
+    seed = philoxSeed(runSeed, (uint32_t)game, RNG_STREAM_AI);
+}
+
+// ============================================================================
+// FONCTION : playGame
+// DESCRIPTION : Joue une partie complète d'une IA contre une flotte fixe
+// PARAMÈTRES :
+//   - play    : IA qui tire
+//   - runSeed : graine de la série
+//   - game    : numéro de la partie
+//   - won     : 1 en sortie si la flotte a été coulée (peut être NULL)
+//   - latency : durée de chaque décision en ns (peut être NULL)
+// RETOUR : nombre de coups nécessaires pour couler toute la flotte
+// ============================================================================
+static int playGame(AIFunc play, uint64_t runSeed, int game, unsigned char *won,
+                    HistogramSet *latency) {
+    Player target;
+    AIState state;
+    int shots = 0;
+
+    startGame(runSeed, game, &target, &state);
+
+    // Sécurité : une IA ne peut pas tirer plus de GRID * GRID fois
+    while (!allDestroyed(target.grid) && shots < GRID * GRID) {
+        if (latency) {
+            uint64_t start = chronoNowNs();
+            play(&target, &state);
+            histSetRecord(latency, chronoNowNs() - start);
+        } else {
+            play(&target, &state);
+        }
+        shots++;
+    }
+    if (won)
+        *won = (unsigned char)allDestroyed(target.grid);
+    return shots;
+}
+
+// Résumés des histogrammes au format CSV (option -C, NULL = aucun)
+static FILE *csvOut = NULL;
+
+// Mesure de la durée de chaque décision (option -d) : deux lectures
+// d'horloge par coup, non négligeables devant les IA les plus rapides
+static int timeDecisions = 0;
+
+// Statistiques d'une série de parties
+typedef struct {
+    long total;          // Somme des coups
+    int minShots;        // Partie la plus courte
+    int maxShots;        // Partie la plus longue
+    double seconds;      // Durée de la série
+    int workers;         // Fils ayant participé
+    PoolWorkerStats activity[POOL_MAX_THREADS + POOL_MAX_CALLERS];  // Activité des fils
+    Histogram shots;     // Coups pour gagner
+    Histogram decisions; // Durée de chaque décision (ns)
+} SeriesStats;
+
+// Série en cours de jeu (contexte des tâches du groupe de fils)
+typedef struct {
+    AIFunc play;
+    const Series *series;
+    int *shots;          // Coups de chaque partie
+    unsigned char *won;  // Flotte coulée à chaque partie (peut être NULL)
+    HistogramSet *latency;  // Durée des décisions, une instance par fil (peut être NULL)
+} SeriesJob;
+
+// ============================================================================
+// FONCTION : seriesTask
+// DESCRIPTION : Joue les parties [begin, end) de la série ; chaque partie
+//               fixe la graine de son fil, son résultat ne dépend donc pas
+//               du fil qui la joue
+// ============================================================================
+static void seriesTask(void *ctx, int begin, int end) {
+    SeriesJob *job = ctx;
+    for (int g = begin; g < end; g++)
+        job->shots[g] = playGame(job->play, job->series->runSeed, job->series->first + g,
+                                 job->won ? &job->won[g] : NULL, job->latency);
+}
+
+// ============================================================================
+// FONCTION : playSeries
+// DESCRIPTION : Joue toute la série de parties pour une IA, une tâche par
+//               partie : les parties longues (IA facile) comme les courtes
+//               (IA experte) se répartissent d'elles-mêmes par vol de travail
+// PARAMÈTRES :
+//   - play      : IA qui tire
+//   - series    : parties à jouer
+//   - st        : statistiques de la série en sortie
+// RETOUR : aucun (void)
+// ============================================================================
+static void playSeries(AIFunc play, const Series *series, SeriesStats *st) {
+    int games = series->games;
+    HistogramSet latency;
+    SeriesJob job = {play, series, malloc(sizeof(int) * (size_t)games), NULL,
+                     timeDecisions ? &latency : NULL};
+    uint64_t start;
+
+    if (!job.shots) {
+        fprintf(stderr, "Mémoire insuffisante\n");
+        exit(1);
+    }
+
+    histSetInit(&latency);
+    poolResetStats();
+    start = chronoNowNs();
+    poolParallelFor(games, 1, seriesTask, &job);
+    st->seconds = (double)(chronoNowNs() - start) / 1e9;
+    st->workers = poolStats(st->activity, POOL_MAX_THREADS + POOL_MAX_CALLERS);
+    histSetMerge(&latency, &st->decisions);
+    histSetFree(&latency);
+
+    st->total = 0;
+    st->minShots = GRID * GRID;
+    st->maxShots = 0;
+    histInit(&st->shots);
+    for (int g = 0; g < games; g++) {
+        int shots = job.shots[g];
+        st->total += shots;
+        if (shots < st->minShots) st->minShots = shots;
+        if (shots > st->maxShots) st->maxShots = shots;
+        histRecord(&st->shots, (uint64_t)shots);
+    }
+    free(job.shots);
+}
+
+// ============================================================================
+// FONCTION : printSeries
+// DESCRIPTION : Affiche une ligne du tableau de résultats, puis la
+//               distribution des coups et des durées de décision (aussi
+//               écrite dans le fichier CSV)
+// ============================================================================
+static void printSeries(const char *name, const SeriesStats *st, int games) {
+    printf("%-11s %8d %11.2f %5d %5d %12.0f %10.1f\n", name, games, (double)st->total / games,
+           st->minShots, st->maxShots, st->seconds > 0 ? games / st->seconds : 0.0,
+           st->total > 0 ? 1e6 * st->seconds / (double)st->total : 0.0);
+    if (st->shots.count > 0) {
+        printf("  coups : p50 %llu, p90 %llu, p99 %llu\n",
+               (unsigned long long)histPercentile(&st->shots, 50.0),
+               (unsigned long long)histPercentile(&st->shots, 90.0),
+               (unsigned long long)histPercentile(&st->shots, 99.0));
+        if (csvOut)
+            histCsvRow(&st->shots, csvOut, name, "shots", "shots", 1.0);
+    }
+    if (st->decisions.count > 0) {
+        histPrint(&st->decisions, stdout, "  décision", "µs", 1e3);
+        if (csvOut)
+            histCsvRow(&st->decisions, csvOut, name, "decision", "us", 1e3);
+    }
+
+    // Utilisation de chaque fil (part du temps passée à exécuter des tâches)
+    uint64_t steals = 0;
+    if (st->workers == 0)
+        return;  // Un seul fil : rien à répartir
+    printf("  fils :");
+    for (int w = 0; w < st->workers; w++) {
+        const PoolWorkerStats *a = &st->activity[w];
+        printf(" %s%.0f %%", a->caller ? "appelant " : "",
+               a->wallNs ? 100.0 * (double)(a->wallNs - a->idleNs) / (double)a->wallNs : 0.0);
+        steals += a->steals;
+    }
+    printf(", %llu tâches volées\n", (unsigned long long)steals);
+}
+
+// Point de reprise d'une série répartie
+typedef struct {
+    ShardCheckpoint *ck;       // Point de reprise en mémoire
+    const char *path;          // Fichier
+    int intervalS;             // Intervalle entre deux écritures
+    int saves;                 // Écritures réussies
+    uint64_t saveNs;           // Temps passé à écrire
+} Checkpointing;
+
+// Interruption demandée (Ctrl-C, SIGTERM) pendant une série répartie
+static volatile sig_atomic_t interrupted = 0;
+
+static void onInterrupt(int sig) {
+    (void)sig;
+    interrupted = 1;
+}
+
+// Travail confié à chaque processus (copié par fork)
+typedef struct {
+    AIFunc play;         // IA qui tire
+    uint64_t runSeed;    // Graine de la série
+    int threads;         // Fils par processus (0 = processeurs attribués)
+} ShardJob;
+
+// ============================================================================
+// FONCTION : shardTask
+// DESCRIPTION : Joue la plage d'un processus par blocs de quelques parties
+//               par fil ; chaque bloc est publié d'un coup dans la mémoire
+//               partagée, si bien qu'un arrêt brutal ne perd que le bloc
+//               en cours
+// PARAMÈTRES :
+//   - slot : emplacement du processus dans la mémoire partagée
+//   - ctx  : travail (ShardJob)
+// RETOUR : code de sortie du processus
+// ============================================================================
+static int shardTask(ShardSlot *slot, void *ctx) {
+    const ShardJob *job = ctx;
+
+    // Le gestionnaire du coordinateur ne vaut pas pour les processus
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+
+    int block = aiSetThreads(job->threads > 0 ? job->threads : slot->cpus) * 8;
+    Series part = {job->runSeed, 0, 0};
+    SeriesJob sj = {job->play, &part, malloc(sizeof(int) * (size_t)block), malloc((size_t)block),
+                    NULL};
+    ShardTotals done;
+
+    if (!sj.shots || !sj.won) {
+        fprintf(stderr, "Mémoire insuffisante\n");
+        return 1;
+    }
+
+    for (int g = shardSnapshot(slot, &done); g < slot->end; g += part.games) {
+        part.first = g;
+        part.games = slot->end - g < block ? slot->end - g : block;
+        poolParallelFor(part.games, 1, seriesTask, &sj);
+
+        shardBegin(slot);
+        for (int i = 0; i < part.games; i++)
+            shardRecord(slot, sj.shots[i], sj.won[i]);
+        shardEnd(slot, g + part.games);
+    }
+
+    poolShutdown();
+    free(sj.shots);
+    free(sj.won);
+    return 0;
+}
+
+// ============================================================================
+// FONCTION : shardSeries
+// DESCRIPTION : Coordinateur : lance un processus par fragment de la série,
+//               affiche l'avancement chaque seconde puis regroupe les
+//               résultats publiés, y compris ceux d'un processus arrêté
+//               Avec un point de reprise, les fragments repartent de leur
+//               prochaine partie et les compteurs publiés sont écrits toutes
+//               les cp->intervalS secondes, à l'interruption et à la fin
+// PARAMÈTRES :
+//   - name    : nom de l'IA
+//   - play    : IA qui tire
+//   - series  : parties à jouer
+//   - shards  : nombre de processus
+//   - threads : fils par processus (0 = processeurs attribués)
+//   - cp      : point de reprise (NULL = aucun)
+// RETOUR : 1 si tous les processus ont terminé leur plage, 0 sinon
+// ============================================================================
+static int shardSeries(const char *name, AIFunc play, const Series *series, int shards,
+                       int threads, Checkpointing *cp) {
+    ShardRun *run = shardCreate(shards, series->first, series->games);
+    ShardJob job = {play, series->runSeed, threads};
+    ShardSection *sec = cp ? shardCheckpointSection(cp->ck, name) : NULL;
+    ShardTotals totals;
+    double before = sec ? sec->seconds : 0.0;  // Temps des exécutions précédentes
+    uint64_t start = chronoNowNs(), saved = start;
+
+    if (!run) {
+        fprintf(stderr, "Zone partagée indisponible\n");
+        return 0;
+    }
+    if (cp && !sec) {
+        fprintf(stderr, "Point de reprise plein\n");
+        shardFree(run);
+        return 0;
+    }
+    if (sec)
+        shardRestore(run, sec);
+
+    shardLaunch(run, shardTask, &job);
+    for (int running = run->shards, stopping = 0; running > 0;) {
+        running = shardWait(run, 1000);
+        if (interrupted && !stopping) {
+            shardStop(run);
+            stopping = 1;
+        }
+        shardMerge(run, &totals);
+        fprintf(stderr, "\r  %s : %llu / %d parties, %d processus en cours ", name,
+                (unsigned long long)totals.games, series->games, running);
+
+        // Écriture du point de reprise (le coordinateur ne calcule pas)
+        uint64_t now = chronoNowNs();
+        if (sec && (running == 0 || now - saved >= (uint64_t)cp->intervalS * 1000000000ULL)) {
+            shardCapture(run, sec);
+            sec->seconds = before + (double)(now - start) / 1e9;
+            if (shardCheckpointSave(cp->ck, cp->path))
+                cp->saves++;
+            else
+                fprintf(stderr, "\nÉcriture du point de reprise %s impossible\n", cp->path);
+            saved = chronoNowNs();
+            cp->saveNs += saved - now;
+        }
+    }
+    fprintf(stderr, "\n");
+
+    // Même ligne de tableau que les séries d'un seul processus
+    SeriesStats st = {0};
+    st.seconds = before + (double)(chronoNowNs() - start) / 1e9;
+    st.total = (long)totals.shots;
+    histInit(&st.shots);
+    for (int i = 0; i < SHARD_HIST_SIZE; i++)
+        histRecordCount(&st.shots, (uint64_t)i, totals.hist[i]);
+    st.minShots = st.shots.count ? (int)st.shots.min : 0;
+    st.maxShots = (int)st.shots.max;
+    if (totals.games > 0)
+        printSeries(name, &st, (int)totals.games);
+    if (totals.losses > 0)
+        printf("  flottes non coulées : %llu\n", (unsigned long long)totals.losses);
+
+    int complete = 1;
+    for (int s = 0; s < run->shards; s++) {
+        const ShardSlot *slot = &run->slots[s];
+        if (slot->state == SHARD_DONE)
+            continue;
+        ShardTotals part;
+        int next = shardSnapshot(slot, &part);
+        printf("  processus %d (parties %d à %d) : %s %d, parties %d à %d publiées\n", s,
+               slot->first, slot->end - 1, slot->signaled ? "arrêté par le signal" : "code de sortie",
+               slot->status, slot->first, next - 1);
+        complete = 0;
+    }
+    shardFree(run);
+    return complete;
+}
+
+// Latences par tour d'une série (microsecondes)
+typedef struct {
+    double sum;          // Somme des latences
+    double max;          // Latence maximale
+    int turns;           // Tours mesurés
+} LatencyStats;
+
+static void addLatency(LatencyStats *st, uint64_t startNs) {
+    double us = (double)(chronoNowNs() - startNs) / 1e3;
+    st->sum += us;
+    if (us > st->max) st->max = us;
+    st->turns++;
+}
+
+// Découpage du mode coopératif : sum = tranches, max = tranche la plus longue (µs)
+static void addSlice(LatencyStats *st, uint64_t startNs) {
+    double us = (double)(chronoNowNs() - startNs) / 1e3;
+    st->sum += 1.0;
+    if (us > st->max) st->max = us;
+}
+
+// ============================================================================
+// FONCTION : latencySeries
+// DESCRIPTION : Joue la série avec l'IA à tout moment et mesure le temps
+//               entre le clic (simulé) du joueur et le coup de l'IA :
+//               - sans spéculation, la réflexion démarre au clic
+//               - avec, elle démarre dès le coup précédent de l'IA et
+//                 avance pendant le tour du joueur (thinkMs)
+//               - en mode coopératif, elle avance par tranches de sliceUs
+//               Les trois réflexions vont à leur terme : mêmes coups
+// PARAMÈTRES :
+//   - level     : niveau d'IA
+//   - series    : parties à jouer
+//   - thinkMs   : durée simulée du tour du joueur
+//   - sliceUs   : tranche du mode coopératif
+//   - plain     : latences sans spéculation en sortie
+//   - spec      : latences avec spéculation en sortie
+//   - coop      : tranches du mode coopératif en sortie
+// RETOUR : 1 si les trois modes ont joué les mêmes coups, 0 sinon
+// ============================================================================
+static int latencySeries(AILevel level, const Series *series, int thinkMs,
+                         int sliceUs, LatencyStats *plain, LatencyStats *spec,
+                         LatencyStats *coop) {
+    AnytimeAI *t = malloc(sizeof(AnytimeAI));
+    struct timespec think = {thinkMs / 1000, (long)(thinkMs % 1000) * 1000000L};
+    int same = 1;
+
+    memset(plain, 0, sizeof(*plain));
+    memset(spec, 0, sizeof(*spec));
+    memset(coop, 0, sizeof(*coop));
+    if (!t)
+        return 0;
+
+    for (int g = 0; g < series->games; g++) {
+        Player a, b, c;
+        AIState sa, sb, sc;
+        unsigned int seedA, seedB, seedC;
+
+        startGame(series->runSeed, series->first + g, &a, &sa);
+        b = c = a;
+        sb = sc = sa;
+        seedA = seedB = seedC = seed;
+
+        for (int k = 0; k < GRID * GRID && !allDestroyed(a.grid); k++) {
+            // Sans spéculation : tout le calcul après le clic
+            uint64_t start = chronoNowNs();
+            seed = seedA;
+            anytimeStart(t, level, &a, &sa);
+            while (anytimeRefine(t))
+                ;
+            anytimeCommit(t, &a, &sa);
+            seedA = seed;
+            addLatency(plain, start);
+
+            // Avec spéculation : réflexion lancée avant le tour du joueur
+            seed = seedB;
+            anytimeStart(t, level, &b, &sb);
+            aiQueueSubmit(t);
+            nanosleep(&think, NULL);
+            start = chronoNowNs();
+            while (aiQueuePoll() == NULL)
+                sched_yield();
+            anytimeCommit(t, &b, &sb);
+            seedB = seed;
+            addLatency(spec, start);
+
+            // Mode coopératif : une tranche par image jusqu'au bout
+            seed = seedC;
+            anytimeStart(t, level, &c, &sc);
+            for (int more = 1; more;) {
+                start = chronoNowNs();
+                more = anytimeRefineFor(t, (uint64_t)sliceUs * 1000);
+                addSlice(coop, start);
+            }
+            anytimeCommit(t, &c, &sc);
+            seedC = seed;
+            coop->turns++;
+
+            if (memcmp(a.grid, b.grid, sizeof(a.grid)) != 0
+                || memcmp(a.grid, c.grid, sizeof(a.grid)) != 0)
+                same = 0;
+        }
+    }
+
+    free(t);
+    return same;
+}
+
+// ============================================================================
+// FONCTION PRINCIPALE : main
+// ============================================================================
+int main(int argc, char **argv) {
+    int games = 500;              // Parties par IA
+    unsigned int baseSeed = 12345;  // Graine de la série
+    int first = 0;                // Numéro de la première partie
+    const char *only = NULL;      // Filtre sur le nom d'IA
+    CpuLevel maxLevel = CPU_AVX512;
+    int cacheBits = 20;           // Taille du cache de transposition (log2)
+    const char *bookPath = NULL;  // Bibliothèque d'ouvertures à évaluer
+    double solverMax = AI_SOLVER_MAX_SEARCH;  // Seuil du solveur exact
+    int threads = 0;              // Fils d'exécution (0 = nombre de processeurs)
+    int shards = 0;               // Processus (0 = un seul, sans fork)
+    const char *checkpointPath = NULL;  // Point de reprise (séries réparties)
+    int checkpointS = 60;         // Intervalle entre deux écritures
+    const char *csvPath = NULL;   // Distributions au format CSV
+    int thinkMs = -1;             // Tour simulé du joueur (mesure de latence, -1 = non)
+    int sliceUs = ANYTIME_FRAME_BUDGET_US;  // Tranche du mode coopératif
+
+    // Lecture des options de la ligne de commande
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            first = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            baseSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            if (!cpuLevelFromName(argv[++i], &maxLevel)) {
+                fprintf(stderr, "Niveau inconnu : %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            cacheBits = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            bookPath = argv[++i];
+        } else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+            solverMax = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            shards = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            checkpointPath = argv[++i];
+        } else if (strcmp(argv[i], "-d") == 0) {
+            timeDecisions = 1;
+        } else if (strcmp(argv[i], "-C") == 0 && i + 1 < argc) {
+            csvPath = argv[++i];
+        } else if (strcmp(argv[i], "-K") == 0 && i + 1 < argc) {
+            checkpointS = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            thinkMs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            sliceUs = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage : %s [-n parties] [-o premier] [-s graine] [-a ia] [-i niveau] [-c taille]"
+                    " [-b fichier] [-e seuil] [-t fils] [-p processus] [-k fichier] [-K secondes]"
+                    " [-d] [-C fichier] [-l ms] [-f µs]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (games <= 0 || first < 0 || cacheBits < 0 || cacheBits > 30 || sliceUs <= 0) {
+        fprintf(stderr, "Nombre de parties, taille de cache ou tranche invalide\n");
+        return 1;
+    }
+    if (checkpointPath && shards == 0)
+        shards = 1;
+    if (shards < 0 || shards > SHARD_MAX || (shards > 0 && thinkMs >= 0) || checkpointS <= 0) {
+        fprintf(stderr, "Nombre de processus (1 à %d, sans -l) ou intervalle invalide\n",
+                SHARD_MAX);
+        return 1;
+    }
+
+    if (csvPath) {
+        if (!(csvOut = fopen(csvPath, "w"))) {
+            fprintf(stderr, "Impossible d'écrire %s\n", csvPath);
+            return 1;
+        }
+        histCsvHeader(csvOut);
+    }
+
+    CpuLevel level = dispatchInit(maxLevel);
+    // Solveur sans budget de temps : une échéance dépend de la charge de la
+    // machine, les résultats ne seraient plus reproductibles ; sa borne de
+    // nœuds (SOLVER_MAX_NODES) et le seuil suffisent à limiter une résolution
+    aiSetSolver(solverMax, 0);
+
+    // Parties first à first + games - 1 de la série (les mêmes pour toutes les IA)
+    Series series = {baseSeed, first, games};
+
+    // Répartition entre processus : le groupe de fils n'est démarré que dans
+    // chaque processus (un fork ne duplique pas les fils)
+    if (shards > 0) {
+        Checkpointing cp = {NULL, checkpointPath, checkpointS, 0, 0};
+        int complete = 1;
+
+        if (checkpointPath) {
+            if (!(cp.ck = malloc(sizeof(ShardCheckpoint)))) {
+                fprintf(stderr, "Mémoire insuffisante\n");
+                return 1;
+            }
+            if (shardCheckpointLoad(cp.ck, checkpointPath, baseSeed, first, games, shards) < 0) {
+                fprintf(stderr, "Point de reprise %s illisible ou d'une autre série"
+                        " (graine, parties, processus)\n", checkpointPath);
+                free(cp.ck);
+                return 1;
+            }
+        }
+        signal(SIGINT, onInterrupt);
+        signal(SIGTERM, onInterrupt);
+
+        printf("=== Tournoi des IA ===\n");
+        printf("Noyaux : %s (détecté : %s), densité : %s\n", cpuLevelName(level),
+               cpuLevelName(cpuDetect()), densityKernelName(densityGetKernel()));
+        printf("Parties par IA : %d (n° %d à %d), graine : %u, processus : %d\n", games,
+               first, first + games - 1, baseSeed, shards);
+        if (cp.ck)
+            printf("Point de reprise : %s (%d série%s reprise%s)\n", checkpointPath,
+                   cp.ck->sections, cp.ck->sections > 1 ? "s" : "", cp.ck->sections > 1 ? "s" : "");
+        printf("\n");
+        printf("%-11s %8s %11s %5s %5s %12s %10s\n", "IA", "Parties", "Coups moy.", "Min",
+               "Max", "Parties/s", "µs/coup");
+        for (int a = 0; a < ENTRANT_COUNT; a++) {
+            if (only && strcmp(only, entrants[a].name) != 0)
+                continue;
+            if (interrupted) {
+                complete = 0;
+                break;
+            }
+            aiSetCache(NULL);
+            if (!shardSeries(entrants[a].name, entrants[a].play, &series, shards, threads,
+                             cp.ck ? &cp : NULL))
+                complete = 0;
+        }
+
+        if (cp.ck) {
+            printf("Point de reprise : %d écritures, %.1f ms au total\n", cp.saves,
+                   (double)cp.saveNs / 1e6);
+            free(cp.ck);
+        }
+        if (csvOut)
+            fclose(csvOut);
+        if (interrupted && !complete)
+            printf("Série interrompue%s\n", checkpointPath ? " : relancer la même commande pour la reprendre" : "");
+        return complete ? 0 : 2;
+    }
+
+    threads = aiSetThreads(threads);
+
+    printf("=== Tournoi des IA ===\n");
+    printf("Noyaux : %s (détecté : %s), densité : %s\n",
+           cpuLevelName(level), cpuLevelName(cpuDetect()), densityKernelName(densityGetKernel()));
+    printf("Parties par IA : %d (n° %d à %d), graine : %u, fils : %d\n\n", games, first,
+           first + games - 1, baseSeed, threads);
+
+    // Latence par tour de l'IA à tout moment, sans puis avec spéculation
+    if (thinkMs >= 0) {
+        aiQueueStart();
+        printf("Tour simulé du joueur : %d ms, tranche coopérative : %d µs\n", thinkMs, sliceUs);
+        printf("%-11s %6s %14s %10s %14s %10s %10s %10s\n", "IA", "Tours", "Sans spéc. µs",
+               "max µs", "Avec spéc. µs", "max µs", "Tranches", "max µs");
+        for (int a = 0; a < ENTRANT_COUNT; a++) {
+            if (only && strcmp(only, entrants[a].name) != 0)
+                continue;
+            LatencyStats plain, spec, coop;
+            int same = latencySeries(entrants[a].level, &series, thinkMs, sliceUs,
+                                     &plain, &spec, &coop);
+            printf("%-11s %6d %14.1f %10.1f %14.1f %10.1f %10.1f %10.1f%s\n", entrants[a].name,
+                   plain.turns, plain.turns ? plain.sum / plain.turns : 0.0, plain.max,
+                   spec.turns ? spec.sum / spec.turns : 0.0, spec.max,
+                   coop.turns ? coop.sum / coop.turns : 0.0, coop.max,
+                   same ? "" : "  (coups différents !)");
+        }
+        aiQueueStop();
+        poolShutdown();
+        return 0;
+    }
+    printf("%-11s %8s %11s %5s %5s %12s %10s\n", "IA", "Parties", "Coups moy.", "Min", "Max",
+           "Parties/s", "µs/coup");
+
+    for (int a = 0; a < ENTRANT_COUNT; a++) {
+        if (only && strcmp(only, entrants[a].name) != 0)
+            continue;
+
+        uint64_t solverBefore, solvedBefore, solverAfter, solvedAfter;
+        aiSolverStats(&solverBefore, &solvedBefore);
+        aiSetCache(NULL);
+        SeriesStats plain;
+        playSeries(entrants[a].play, &series, &plain);
+        aiSolverStats(&solverAfter, &solvedAfter);
+        printSeries(entrants[a].name, &plain, games);
+
+        if (!entrants[a].usesCache)
+            continue;
+
+        printf("  solveur exact : %llu résolutions (%llu complètes), seuil %.0e\n",
+               (unsigned long long)(solverAfter - solverBefore),
+               (unsigned long long)(solvedAfter - solvedBefore), solverMax);
+
+        // Même série avec le cache de transposition (partagé entre les parties)
+        TTable cache;
+        if (cacheBits > 0 && ttInit(&cache, cacheBits)) {
+            aiSetCache(&cache);
+            SeriesStats cached;
+            playSeries(entrants[a].play, &series, &cached);
+            aiSetCache(NULL);
+
+            char label[32];
+            snprintf(label, sizeof(label), "%s+tt", entrants[a].name);
+            printSeries(label, &cached, games);
+            printf("  cache : %llu consultations, %.1f %% de succès, accélération x%.2f\n",
+                   (unsigned long long)atomic_load(&cache.probes), 100.0 * ttHitRate(&cache),
+                   cached.seconds > 0 ? plain.seconds / cached.seconds : 0.0);
+            ttFree(&cache);
+        } else if (cacheBits > 0) {
+            fprintf(stderr, "Mémoire insuffisante pour le cache\n");
+        }
+
+        // Même série avec la bibliothèque d'ouvertures
+        if (bookPath) {
+            size_t positions = bookOpen(bookPath, &shipConfig);
+            if (positions == 0) {
+                fprintf(stderr, "Bibliothèque d'ouvertures illisible : %s\n", bookPath);
+                continue;
+            }
+            SeriesStats booked;
+            playSeries(entrants[a].play, &series, &booked);
+            uint64_t probes, hits;
+            bookStats(&probes, &hits);
+            bookClose();
+
+            char label[32];
+            snprintf(label, sizeof(label), "%s+book", entrants[a].name);
+            printSeries(label, &booked, games);
+            printf("  ouvertures : %zu positions, %.1f %% de succès, accélération x%.2f\n",
+                   positions, probes ? 100.0 * (double)hits / (double)probes : 0.0,
+                   booked.seconds > 0 ? plain.seconds / booked.seconds : 0.0);
+        }
+    }
+
+    poolShutdown();
+    if (csvOut)
+        fclose(csvOut);
+    return 0;
+}